@@ -21,17 +21,20 @@ AppsContainer::AppsContainer() :
   m_USBTimer(USBTimer(this)),
   m_suspendTimer(SuspendTimer(this)),
   m_backlightDimmingTimer(),
+  m_snapshotArenaStorage{},
+  m_snapshotArena(m_snapshotArenaStorage, k_snapshotArenaSize),
   m_hardwareTestSnapshot(),
   m_onBoardingSnapshot(),
   m_homeSnapshot(),
-  m_calculationSnapshot(),
-  m_rpnSnapshot(),
-  m_graphSnapshot(),
-  m_sequenceSnapshot(),
+  m_calculationSnapshot(&m_snapshotArena),
+  m_rpnSnapshot(&m_snapshotArena),
+  m_graphSnapshot(&m_snapshotArena),
+  m_sequenceSnapshot(&m_snapshotArena),
   m_settingsSnapshot(),
-  m_statisticsSnapshot(),
+  m_statisticsSnapshot(&m_snapshotArena),
   m_probabilitySnapshot(),
-  m_regressionSnapshot()
+  m_regressionSnapshot(&m_snapshotArena),
+  m_codeSnapshot()
 {
   m_emptyBatteryWindow.setFrame(KDRect(0, 0, Ion::Display::Width, Ion::Display::Height));
   Poincare::Expression::setCircuitBreaker(AppsContainer::poincareCircuitBreaker);
@@ -50,35 +53,25 @@ App::Snapshot * AppsContainer::appSnapshotAtIndex(int index) {
   if (index < 0) {
     return nullptr;
   }
-  App::Snapshot * snapshots[] = {
-    &m_homeSnapshot,
-    &m_calculationSnapshot,
-    &m_rpnSnapshot,
-    &m_graphSnapshot,
-    &m_sequenceSnapshot,
-    &m_settingsSnapshot,
-    &m_statisticsSnapshot,
-    &m_probabilitySnapshot,
-    &m_regressionSnapshot,
-    &m_codeSnapshot
-  };
-  assert(sizeof(snapshots)/sizeof(snapshots[0]) == k_numberOfCommonApps);
-  assert(index >= 0 && index < k_numberOfCommonApps);
-  return snapshots[index];
+  return lazySnapshotAtIndex(index)->snapshot();
+}
+
+App::Descriptor * AppsContainer::appDescriptorAtIndex(int index) {
+  return lazySnapshotAtIndex(index)->descriptor();
 }
 
 App::Snapshot * AppsContainer::hardwareTestAppSnapshot() {
-  return &m_hardwareTestSnapshot;
+  return m_hardwareTestSnapshot.snapshot();
 }
 
 App::Snapshot * AppsContainer::onBoardingAppSnapshot() {
-  return &m_onBoardingSnapshot;
+  return m_onBoardingSnapshot.snapshot();
 }
 
 void AppsContainer::reset() {
   Clipboard::sharedClipboard()->reset();
   for (int i = 0; i < k_numberOfCommonApps; i++) {
-    appSnapshotAtIndex(i)->reset();
+    lazySnapshotAtIndex(i)->reset();
   }
 }
 
@@ -97,7 +90,7 @@ VariableBoxController * AppsContainer::variableBoxController() {
 void AppsContainer::suspend(bool checkIfPowerKeyReleased) {
   resetShiftAlphaStatus();
 #if OS_WITH_SOFTWARE_UPDATE_PROMPT
-  if (activeApp()->snapshot()!= onBoardingAppSnapshot() && GlobalPreferences::sharedGlobalPreferences()->showUpdatePopUp()) {
+  if (!m_onBoardingSnapshot.holds(activeApp()->snapshot()) && GlobalPreferences::sharedGlobalPreferences()->showUpdatePopUp()) {
     activeApp()->displayModalViewController(&m_updateController, 0.f, 0.f);
   }
 #endif
@@ -146,7 +139,7 @@ void AppsContainer::switchTo(App::Snapshot * snapshot) {
   if (activeApp() && snapshot != activeApp()->snapshot()) {
     resetShiftAlphaStatus();
   }
-  if (snapshot == hardwareTestAppSnapshot() || snapshot == onBoardingAppSnapshot()) {
+  if (m_hardwareTestSnapshot.holds(snapshot) || m_onBoardingSnapshot.holds(snapshot)) {
     m_window.hideTitleBarView(true);
   } else {
     m_window.hideTitleBarView(false);
@@ -217,6 +210,24 @@ Timer * AppsContainer::containerTimerAtIndex(int i) {
   return timers[i];
 }
 
+Shared::LazySnapshot * AppsContainer::lazySnapshotAtIndex(int index) {
+  Shared::LazySnapshot * snapshots[] = {
+    &m_homeSnapshot,
+    &m_calculationSnapshot,
+    &m_rpnSnapshot,
+    &m_graphSnapshot,
+    &m_sequenceSnapshot,
+    &m_settingsSnapshot,
+    &m_statisticsSnapshot,
+    &m_probabilitySnapshot,
+    &m_regressionSnapshot,
+    &m_codeSnapshot
+  };
+  assert(sizeof(snapshots)/sizeof(snapshots[0]) == k_numberOfCommonApps);
+  assert(index >= 0 && index < k_numberOfCommonApps);
+  return snapshots[index];
+}
+
 void AppsContainer::resetShiftAlphaStatus() {
   Ion::Events::setShiftAlphaStatus(Ion::Events::ShiftAlphaStatus::Default);
   m_window.updateAlphaLock();
@@ -14,6 +14,7 @@
 #include "hardware_test/app.h"
 #include "code/app.h"
 #include "on_boarding/update_controller.h"
+#include "shared/lazy_snapshot.h"
 #include "apps_window.h"
 #include "empty_battery_window.h"
 #include "math_toolbox.h"
@@ -36,6 +37,7 @@ public:
   static bool poincareCircuitBreaker(const Poincare::Expression * e);
   int numberOfApps();
   App::Snapshot * appSnapshotAtIndex(int index);
+  App::Descriptor * appDescriptorAtIndex(int index);
   App::Snapshot * hardwareTestAppSnapshot();
   App::Snapshot * onBoardingAppSnapshot();
   void reset();
@@ -58,6 +60,7 @@ private:
   Timer * containerTimerAtIndex(int i) override;
   bool processEvent(Ion::Events::Event event);
   void resetShiftAlphaStatus();
+  Shared::LazySnapshot * lazySnapshotAtIndex(int index);
   static constexpr int k_numberOfCommonApps = 10;
   static constexpr int k_totalNumberOfApps = 2+k_numberOfCommonApps;
   AppsWindow m_window;
@@ -75,18 +78,25 @@ private:
   USBTimer m_USBTimer;
   SuspendTimer m_suspendTimer;
   BacklightDimmingTimer m_backlightDimmingTimer;
-  HardwareTest::App::Snapshot m_hardwareTestSnapshot;
-  OnBoarding::App::Snapshot m_onBoardingSnapshot;
-  Home::App::Snapshot m_homeSnapshot;
-  Calculation::App::Snapshot m_calculationSnapshot;
-  Rpn::App::Snapshot m_rpnSnapshot;
-  Graph::App::Snapshot m_graphSnapshot;
-  Sequence::App::Snapshot m_sequenceSnapshot;
-  Settings::App::Snapshot m_settingsSnapshot;
-  Statistics::App::Snapshot m_statisticsSnapshot;
-  Probability::App::Snapshot m_probabilitySnapshot;
-  Regression::App::Snapshot m_regressionSnapshot;
-  Code::App::Snapshot m_codeSnapshot;
+  /* Snapshots are only constructed when their app is first launched, see
+   * Shared::LazySnapshot. The apps with the largest snapshots share an arena,
+   * in which inactive snapshots are compacted, see Shared::SnapshotArena. */
+  constexpr static int k_compactableSnapshotSizes[] = {sizeof(Calculation::App::Snapshot), sizeof(Rpn::App::Snapshot), sizeof(Graph::App::Snapshot), sizeof(Sequence::App::Snapshot), sizeof(Statistics::App::Snapshot), sizeof(Regression::App::Snapshot), 0};
+  constexpr static size_t k_snapshotArenaSize = max(k_compactableSnapshotSizes);
+  alignas(double) char m_snapshotArenaStorage[k_snapshotArenaSize];
+  Shared::SnapshotArena m_snapshotArena;
+  Shared::AppLazySnapshot<HardwareTest::App> m_hardwareTestSnapshot;
+  Shared::AppLazySnapshot<OnBoarding::App> m_onBoardingSnapshot;
+  Shared::AppLazySnapshot<Home::App> m_homeSnapshot;
+  Shared::AppCompactableLazySnapshot<Calculation::App> m_calculationSnapshot;
+  Shared::AppCompactableLazySnapshot<Rpn::App> m_rpnSnapshot;
+  Shared::AppCompactableLazySnapshot<Graph::App> m_graphSnapshot;
+  Shared::AppCompactableLazySnapshot<Sequence::App> m_sequenceSnapshot;
+  Shared::AppLazySnapshot<Settings::App> m_settingsSnapshot;
+  Shared::AppCompactableLazySnapshot<Statistics::App> m_statisticsSnapshot;
+  Shared::AppLazySnapshot<Probability::App> m_probabilitySnapshot;
+  Shared::AppCompactableLazySnapshot<Regression::App> m_regressionSnapshot;
+  Shared::AppLazySnapshot<Code::App> m_codeSnapshot;
 };
 
 #endif
@@ -38,6 +38,18 @@ CalculationStore * App::Snapshot::calculationStore() {
   return &m_calculationStore;
 }
 
+size_t App::Snapshot::serialize(char * buffer) {
+  Shared::SnapshotWriter writer(buffer);
+  m_calculationStore.serialize(&writer);
+  return writer.size();
+}
+
+void App::Snapshot::deserialize(const char * buffer, size_t size) {
+  Shared::SnapshotReader reader(buffer, size);
+  m_calculationStore.deserialize(&reader);
+  assert(reader.isAtEnd());
+}
+
 void App::Snapshot::tidy() {
   m_calculationStore.tidy();
 }
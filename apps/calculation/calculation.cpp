@@ -1,4 +1,5 @@
 #include "calculation.h"
+#include <ion/trace.h>
 #include <string.h>
 #include <math.h>
 using namespace Poincare;
@@ -6,8 +7,8 @@ using namespace Poincare;
 namespace Calculation {
 
 Calculation::Calculation() :
-  m_inputText(""),
-  m_outputText(""),
+  m_inputText(),
+  m_outputText(),
   m_input(nullptr),
   m_inputLayout(nullptr),
   m_output(nullptr),
@@ -35,39 +36,65 @@ Calculation::~Calculation() {
 }
 
 Calculation& Calculation::operator=(const Calculation& other) {
-  const char * otherInputText = other.m_inputText;
-  const char * otherOutputText = other.m_outputText;
+  if (this == &other) {
+    return *this;
+  }
+  /* reset moves the records in the store: other's texts are read after it */
   reset();
-  strlcpy(m_inputText, otherInputText, sizeof(m_inputText));
-  strlcpy(m_outputText, otherOutputText, sizeof(m_outputText));
+  m_inputText.setText(other.m_inputText.text());
+  m_outputText.setText(other.m_outputText.text());
   return *this;
 }
 
 void Calculation::reset() {
-  m_inputText[0] = 0;
-  m_outputText[0] = 0;
+  m_inputText.setText("");
+  m_outputText.setText("");
   tidy();
 }
 
-void Calculation::setContent(const char * c, Context * context) {
-  reset();
-  strlcpy(m_inputText, c, sizeof(m_inputText));
-  Evaluation<double> * evaluation = input()->evaluate<double>(*context);
-  evaluation->writeTextInBuffer(m_outputText, sizeof(m_outputText));
+void Calculation::moveFrom(Calculation * other) {
+  tidy();
+  m_inputText.moveFrom(&other->m_inputText);
+  m_outputText.moveFrom(&other->m_outputText);
+  other->tidy();
+}
+
+bool Calculation::setContent(const char * c, Context * context) {
+  ION_TRACE_SCOPE("calculation");
+  /* c may be the text of another calculation, which reset can move */
+  char inputText[::TextField::maxBufferSize()];
+  strlcpy(inputText, c, sizeof(inputText));
+  Expression * input = Expression::parse(inputText);
+  Evaluation<double> * evaluation = input->evaluate<double>(*context);
+  char outputText[2*::TextField::maxBufferSize()];
+  evaluation->writeTextInBuffer(outputText, sizeof(outputText));
   delete evaluation;
+  /* The texts are only replaced if both fit, so that a full store leaves this
+   * calculation untouched. */
+  const Shared::TextRecord * records[] = {&m_inputText, &m_outputText};
+  const char * texts[] = {inputText, outputText};
+  if (!Shared::TextRecord::canReplace(records, texts, 2)) {
+    delete input;
+    return false;
+  }
+  reset();
+  m_inputText.setText(inputText);
+  m_outputText.setText(outputText);
+  m_input = input;
+  return true;
 }
 
 const char * Calculation::inputText() {
-  return m_inputText;
+  return m_inputText.text();
 }
 
 const char * Calculation::outputText() {
-  return m_outputText;
+  return m_outputText.text();
 }
 
 Expression * Calculation::input() {
   if (m_input == nullptr) {
-    m_input = Expression::parse(m_inputText);
+    m_input = Expression::parse(m_inputText.text());
   }
   return m_input;
 }
@@ -83,7 +110,7 @@ Evaluation<double> * Calculation::output(Context * context) {
   if (m_output == nullptr) {
     /* To ensure that the expression 'm_output' is a matrix or a complex, we
      * call 'evaluate'. */
-    Expression * exp = Expression::parse(m_outputText);
+    Expression * exp = Expression::parse(m_outputText.text());
     if (exp != nullptr) {
       m_output = exp->evaluate<double>(*context);
       delete exp;
@@ -108,7 +135,7 @@ bool Calculation::isEmpty() {
    * until the end of the method 'setContent'. Indeed, during 'setContent'
    * method, 'ans' evaluation calls the evaluation of the last calculation
    * only if the calculation being filled is not taken into account.*/
-  if (strlen(m_outputText) == 0) {
+  if (strlen(m_outputText.text()) == 0) {
     return true;
   }
   return false;
@@ -133,4 +160,14 @@ void Calculation::tidy() {
   m_outputLayout = nullptr;
 }
 
+void Calculation::serialize(Shared::SnapshotWriter * writer) {
+  m_inputText.serialize(writer);
+  m_outputText.serialize(writer);
+}
+
+void Calculation::deserialize(Shared::SnapshotReader * reader) {
+  m_inputText.deserialize(reader);
+  m_outputText.deserialize(reader);
+}
+
 }
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "calculation_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF7F7F7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFAFAFA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF8F8F8), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xB7B7B9), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0xB6B6B8),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xB7B7B9), P(0x424248), P(0x5F5F64), P(0xE6E6E7),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64),
+  P(0x424248), P(0xB7B7B9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE5E5E6), P(0x5F5F64), P(0x414147),
+  P(0x5F5F64), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64),
+  P(0x414147), P(0x5F5F64), P(0xE5E5E6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE5E5E6),
+  P(0x5F5F64), P(0x414147), P(0x5F5F64), P(0xE6E6E7), P(0xE6E6E7), P(0x5F5F64),
+  P(0x414147), P(0x5F5F64), P(0xE5E5E6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xE5E5E6), P(0x5F5F64), P(0x414147), P(0x5D5D62), P(0x5D5D62),
+  P(0x414147), P(0x5F5F64), P(0xE5E5E6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE5E5E6), P(0x5D5D62), P(0x414147),
+  P(0x414147), P(0x5D5D62), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5D5D62),
+  P(0x414147), P(0x414147), P(0x5D5D62), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64),
+  P(0x414147), P(0x5D5D62), P(0x5D5D62), P(0x414147), P(0x5F5F64), P(0xE6E6E7),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64),
+  P(0x414147), P(0x5F5F64), P(0xE6E6E7), P(0xE6E6E7), P(0x5F5F64), P(0x414147),
+  P(0x5F5F64), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64),
+  P(0x414147), P(0x5F5F64), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7),
+  P(0x5F5F64), P(0x414147), P(0x5F5F64), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xB6B6B8),
+  P(0x424248), P(0x5F5F64), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xE6E6E7), P(0x5F5F64), P(0x424248), P(0xB6B6B8), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFEB634), P(0xF2F2F2), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xB7B7B9), P(0xE6E6E7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xE6E6E7), P(0xB6B6B8), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF8B134), P(0xEDEDED),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xEDAB3B),
+  P(0xEAEAEA), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xE1AD5A), P(0xF1F1F1), P(0xF2F2F2), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF8B234), P(0xE0CAA9), P(0xFEFEFE), P(0xE5E5E5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD89D40), P(0xFCFBF8), P(0xFFFFFF), P(0xF2F2F2), P(0xE8E8E8),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xE3A134), P(0xE1CEB2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xEAEAEA), P(0xE9E9E9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xE5A334), P(0xD5B486), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xE8E8E8), P(0xE2E2E2), P(0xF1F1F1), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B034), P(0xD59733), P(0xD1B07F), P(0xFEFDFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF2F2F2), P(0xDDDDDD),
+  P(0xE2E2E2), P(0xECECEC), P(0xF1F1F1), P(0xF4F4F4), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFEB634), P(0xF7B134), P(0xEBA734),
+  P(0xD79833), P(0xC6944C), P(0xE1CFB3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0xF0F0F0), P(0xE4E4E4), P(0xDDDDDD), P(0xD9D9D9), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0x4E5058), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18936), P(0xC59248),
+  P(0xCDA56D), P(0xE0CBAD), P(0xFDFBF9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::CalculationIcon = &image;
@@ -11,7 +11,9 @@ CalculationStore::CalculationStore() :
 
 Calculation * CalculationStore::push(const char * text, Context * context) {
   Calculation * result = &m_calculations[m_startIndex];
-  result->setContent(text, context);
+  if (!result->setContent(text, context)) {
+    return nullptr;
+  }
   m_startIndex++;
   if (m_startIndex >= k_maxNumberOfCalculations) {
     m_startIndex = 0;
@@ -63,7 +65,7 @@ void CalculationStore::deleteCalculationAtIndex(int i) {
   int index = absoluteIndexCalculationI;
   for (int k = i; k < numberOfCalc-1; k++) {
     int nextIndex = index+1 >= k_maxNumberOfCalculations ? 0 : index+1;
-    m_calculations[index] = m_calculations[nextIndex];
+    m_calculations[index].moveFrom(&m_calculations[nextIndex]);
     index++;
     if (index == k_maxNumberOfCalculations) {
       index = 0;
@@ -89,4 +91,18 @@ void CalculationStore::tidy() {
   }
 }
 
+void CalculationStore::serialize(Shared::SnapshotWriter * writer) {
+  writer->write(m_startIndex);
+  for (int i = 0; i < k_maxNumberOfCalculations; i++) {
+    m_calculations[i].serialize(writer);
+  }
+}
+
+void CalculationStore::deserialize(Shared::SnapshotReader * reader) {
+  m_startIndex = reader->read<int>();
+  for (int i = 0; i < k_maxNumberOfCalculations; i++) {
+    m_calculations[i].deserialize(reader);
+  }
+}
+
 }
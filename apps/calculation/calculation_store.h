@@ -9,11 +9,15 @@ class CalculationStore {
 public:
   CalculationStore();
   Calculation * calculationAtIndex(int i);
+  /* Returns nullptr, leaving the history unchanged, if the record store is
+   * full */
   Calculation * push(const char * text, Poincare::Context * context);
   void deleteCalculationAtIndex(int i);
   void deleteAll();
   int numberOfCalculations();
   void tidy();
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
   static constexpr int k_maxNumberOfCalculations = 10;
 private:
   int m_startIndex;
@@ -86,7 +86,10 @@ bool EditExpressionController::textFieldDidReceiveEvent(::TextField * textField,
   if (textField->textFieldShouldFinishEditing(event) && textField->isEditing() && strlen(textField->text()) == 0 && m_calculationStore->numberOfCalculations() > 0) {
     App * calculationApp = (App *)app();
     const char * lastTextBody = m_calculationStore->calculationAtIndex(m_calculationStore->numberOfCalculations()-1)->inputText();
-    m_calculationStore->push(lastTextBody, calculationApp->localContext());
+    if (m_calculationStore->push(lastTextBody, calculationApp->localContext()) == nullptr) {
+      app()->displayWarning(I18n::Message::NotEnoughMemory);
+      return true;
+    }
     m_historyController->reload();
     ((ContentView *)view())->mainView()->scrollToCell(0, m_historyController->numberOfRows()-1);
     return true;
@@ -96,7 +99,11 @@ bool EditExpressionController::textFieldDidReceiveEvent(::TextField * textField,
 
 bool EditExpressionController::textFieldDidFinishEditing(::TextField * textField, const char * text, Ion::Events::Event event) {
   App * calculationApp = (App *)app();
-  m_calculationStore->push(textBody(), calculationApp->localContext());
+  if (m_calculationStore->push(textBody(), calculationApp->localContext()) == nullptr) {
+    // The text is kept in the field
+    app()->displayWarning(I18n::Message::NotEnoughMemory);
+    return false;
+  }
   m_historyController->reload();
   ((ContentView *)view())->mainView()->scrollToCell(0, m_historyController->numberOfRows()-1);
   ((ContentView *)view())->textField()->setEditing(true);
@@ -46,3 +46,32 @@ QUIZ_CASE(calculation_store) {
   const char * result3[10] = {"1", "3", "5", "7", "9", "5", "6", "7", "8", "9"};
   assert_store_is(&store, result3);
 }
+
+QUIZ_CASE(calculation_store_full) {
+  GlobalContext globalContext;
+  CalculationStore store;
+  assert(store.push("1+2", &globalContext) != nullptr);
+  assert(store.push("3+4", &globalContext) != nullptr);
+
+  // Another app takes all the room left in the record store
+  Shared::RecordStore * recordStore = Shared::RecordStore::sharedRecordStore();
+  Shared::TextRecord otherText;
+  assert(otherText.edit(recordStore->availableSize()) != nullptr);
+
+  // New calculations are refused and the history is left untouched
+  assert(store.push("5+6", &globalContext) == nullptr);
+  const char * result[10] = {"1+2", "3+4"};
+  assert(store.numberOfCalculations() == 2);
+  assert_store_is(&store, result);
+  assert(strcmp(store.calculationAtIndex(1)->outputText(), "7") == 0);
+
+  // Deleting doesn't need any room
+  store.deleteCalculationAtIndex(0);
+  const char * result1[10] = {"3+4"};
+  assert(store.numberOfCalculations() == 1);
+  assert_store_is(&store, result1);
+
+  otherText.setText("");
+  assert(store.push("5+6", &globalContext) != nullptr);
+  assert(store.numberOfCalculations() == 2);
+}
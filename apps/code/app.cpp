@@ -56,4 +56,13 @@ void App::didBecomeActive(Window * window) {
   displayModalViewController(&m_betaVersionController, 0.5f, 0.5f);
 }
 
+bool App::runTask() {
+  return m_menuController.runPendingScript();
+}
+
+void App::willBecomeInactive() {
+  static_cast<Snapshot *>(snapshot())->program()->stopEditing();
+  ::App::willBecomeInactive();
+}
+
 }
@@ -27,6 +27,8 @@ public:
     Program m_program;
   };
   void didBecomeActive(Window * window) override;
+  void willBecomeInactive() override;
+  bool runTask() override;
 private:
   App(Container * container, Snapshot * snapshot);
   MessageController m_betaVersionController;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "code_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0xFCFCFC), P(0xFBFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA),
+  P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFAFAFA), P(0xFBFBFB), P(0xFDFCFC),
+  P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFDFDFD),
+  P(0xFAF9F9), P(0xF6F5F5), P(0xF4F4F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF5F4F4), P(0xF7F6F6), P(0xFBFAFA), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFBFB),
+  P(0xF6F5F5), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF7F7F7), P(0xFDFDFD),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFBFBFB),
+  P(0xF5F4F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF6F5F5), P(0xFDFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F4F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF7F6F6), P(0xFEFDFD), P(0xFFFFFF), P(0xFEFEFE),
+  P(0xF7F6F6), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFBFAFA), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F5F5),
+  P(0xFDFDFD), P(0xF7F6F6), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4),
+  P(0xF5F4F4), P(0xF6F5F4), P(0xF6F5F5), P(0xF6F5F5), P(0xF6F5F5), P(0xF6F5F4),
+  P(0xF5F4F4), P(0xF5F4F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF9F9F9), P(0xF3F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF6F5F5), P(0xF4F3F3), P(0xEFEEEF),
+  P(0xE9E8E9), P(0xDDDDDF), P(0xD4D4D7), P(0xD1D1D4), P(0xC8C9CC), P(0xCCCDD0),
+  P(0xD3D3D6), P(0xD8D8DA), P(0xE3E3E4), P(0xECEBEC), P(0xF2F1F1), P(0xF6F5F5),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF8F7F7), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xF0EFEF), P(0xD0D0D3), P(0xABACB2),
+  P(0x91939C), P(0x7D818B), P(0x767984), P(0x717580), P(0x70737E), P(0x6B6F7A),
+  P(0x6D717C), P(0x71747F), P(0x737782), P(0x797C87), P(0x848790), P(0x9FA1A8),
+  P(0xCACBCE), P(0xEFEEEF), P(0xF5F4F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF6F5F5), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xE8E7E8), P(0xA0A2A9), P(0x6F737E),
+  P(0x646874), P(0x636773), P(0x646874), P(0x656975), P(0x656975), P(0x656975),
+  P(0x666A76), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x646874),
+  P(0x646874), P(0x6D717C), P(0xA1A3AA), P(0xE8E7E8), P(0xF5F4F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xB0B1B7), P(0x666A76),
+  P(0x656975), P(0x717580), P(0x797D87), P(0x6A6E7A), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x656975), P(0x666A76), P(0xA1A3AA), P(0xF0EFEF),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xEAE9EA), P(0x858891),
+  P(0x636773), P(0x7D808A), P(0xD0D0D3), P(0xE6E5E6), P(0xADAEB4), P(0x696D79),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0x6F737E),
+  P(0xCFD0D3), P(0xF6F5F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xDFDFE1),
+  P(0x7A7D87), P(0x636773), P(0xA4A6AC), P(0xF6F5F5), P(0xF6F5F5), P(0xE2E2E3),
+  P(0x777B85), P(0x656975), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x656975), P(0xAEB0B6), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4),
+  P(0xDEDEE0), P(0x797C86), P(0x636774), P(0x8E9199), P(0xE9E8E9), P(0xF6F5F5),
+  P(0xCBCBCF), P(0x6F737E), P(0x656975), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x646975), P(0xA3A5AC), P(0xF3F2F2), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF5F4F4), P(0xDEDEE0), P(0x797C86), P(0x656975), P(0x696D79), P(0x8E919A),
+  P(0xA0A2A9), P(0x7B7E88), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x656975), P(0xA3A5AC), P(0xF3F2F2), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF5F4F4), P(0xDEDEE0), P(0x787B86), P(0x646874), P(0x656975),
+  P(0x646874), P(0x646874), P(0x646875), P(0x656975), P(0x656975), P(0x656975),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0xA3A5AC), P(0xF3F2F2),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xE1E0E2), P(0x858891), P(0x737782),
+  P(0x747883), P(0x747883), P(0x747883), P(0x747883), P(0x747883), P(0x747883),
+  P(0x747883), P(0x6F737E), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0xA3A5AC),
+  P(0xF3F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF6F5F4), P(0xF4F3F3),
+  P(0xF0EFF0), P(0xEEEEEE), P(0xEEEDEE), P(0xEEEDEE), P(0xEAE9EA), P(0xD8D8DB),
+  P(0xD5D5D8), P(0xD5D5D8), P(0xD5D5D8), P(0xD5D5D8), P(0xD5D5D8), P(0xD5D5D8),
+  P(0xD5D5D8), P(0xD6D6D9), P(0xADAFB5), P(0x676B77), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975),
+  P(0xA3A5AC), P(0xF3F1EF), P(0xF3F0EC), P(0xF3F0EB), P(0xF3F0EB), P(0xF3F0EC),
+  P(0xF4F2F0), P(0xF4F4F5), P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xF2F1F1), P(0xD2D3D5),
+  P(0xA9AAB1), P(0x92949D), P(0x868992), P(0x82858F), P(0x82858F), P(0x83868F),
+  P(0x848790), P(0x848791), P(0x848791), P(0x848791), P(0x848791), P(0x848791),
+  P(0x848791), P(0x848791), P(0x848791), P(0x797D87), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x656975), P(0xA3A5AD), P(0xEEDDBF), P(0xE7BA67), P(0xE7B965), P(0xE7B964),
+  P(0xE8BC6A), P(0xEAC581), P(0xEFDAB5), P(0xF3F0EC), P(0xF4F3F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xECEBEC), P(0xADAEB4),
+  P(0x727581), P(0x646875), P(0x646874), P(0x646874), P(0x646874), P(0x646874),
+  P(0x646874), P(0x646874), P(0x646874), P(0x646874), P(0x646874), P(0x646874),
+  P(0x646874), P(0x646874), P(0x646874), P(0x646874), P(0x656975), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x656975), P(0xA3A6AE), P(0xEDD8B1), P(0xE4AB41), P(0xE4AA3E),
+  P(0xE4AA3E), P(0xE4AA3D), P(0xE4AA3C), P(0xE5AD45), P(0xECCC94), P(0xF3F1ED),
+  P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xABADB3),
+  P(0x686C78), P(0x656975), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x656975), P(0xA3A6AE), P(0xEDD8B2), P(0xE4AC44),
+  P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AA3E), P(0xE5AD47),
+  P(0xEFDBB7), P(0xF4F4F5), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF6F4F4), P(0xD1D1D4),
+  P(0x71747F), P(0x656975), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0xA3A6AE), P(0xEDD8B2),
+  P(0xE4AC44), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F),
+  P(0xE4A93C), P(0xE9BF73), P(0xF3F0EA), P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF3F2F2),
+  P(0xA4A6AC), P(0x646875), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x646975), P(0xA3A6AE),
+  P(0xEDD8B2), P(0xE4AC44), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F),
+  P(0xE4AB3F), P(0xE4AA3E), P(0xE5B04D), P(0xF1E3CC), P(0xF4F4F5), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xECEBEC), P(0x868992), P(0x646874), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975),
+  P(0xB0B2B9), P(0xEED4A5), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40),
+  P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4AA3F), P(0xEED6AB), P(0xF4F4F6),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF5F4F4), P(0xDCDCDE), P(0x767A84), P(0x656975), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975),
+  P(0x6E727E), P(0xCFCECF), P(0xEBC580), P(0xE4AA40), P(0xE4AB41), P(0xE4AB40),
+  P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93C), P(0xEBC98A),
+  P(0xF4F2F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF6F5F5), P(0xCBCBCF), P(0x6A6E79), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656976),
+  P(0x656976), P(0x9EA1AA), P(0xEBDCC3), P(0xE6B151), P(0xE4AB41), P(0xE4AB41),
+  P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93C),
+  P(0xE8BD6C), P(0xF3F0EC), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF6F5F5), P(0xBDBEC3), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656976), P(0x646874),
+  P(0x646875), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x6C707B), P(0x9B9EA7), P(0xE4DDD1), P(0xE9C073), P(0xE4AB41), P(0xE4AB42),
+  P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F),
+  P(0xE4A93C), P(0xE7B65C), P(0xF3EDE3), P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xB7B8BD), P(0x656A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0x70747F),
+  P(0x8A8E98), P(0x9DA0A9), P(0xA1A4AD), P(0xA0A3AC), P(0xA0A3AC), P(0xA0A3AC),
+  P(0xA0A3AC), P(0xA0A3AC), P(0xA0A3AD), P(0xA0A4AD), P(0xA0A4AD), P(0xA0A3AC),
+  P(0xA9ACB4), P(0xCBCBCD), P(0xEADEC8), P(0xE9C175), P(0xE4AC42), P(0xE4AB42),
+  P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F),
+  P(0xE4AA3F), P(0xE4A93D), P(0xE6B457), P(0xF2EADC), P(0xF4F3F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xB7B8BD),
+  P(0x656A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x676B77), P(0x93969F),
+  P(0xD1D0D0), P(0xEBE0CF), P(0xF0DEC0), P(0xEFDCBA), P(0xEFDCBA), P(0xEFDCBA),
+  P(0xEFDCB9), P(0xEFDCB9), P(0xEFDCB9), P(0xEFDCB9), P(0xEFDBB8), P(0xEFDBB8),
+  P(0xEFDBB8), P(0xEFD9B0), P(0xECC989), P(0xE7B456), P(0xE4AC42), P(0xE4AC42),
+  P(0xE4AB42), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F),
+  P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93D), P(0xE6B354), P(0xF1E8D7), P(0xF4F4F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF6F5F4),
+  P(0xBABBC0), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x676B77), P(0x9EA1A8),
+  P(0xE7E0D3), P(0xEDCD91), P(0xE7B860), P(0xE5B150), P(0xE5AF4B), P(0xE5AF4B),
+  P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE47), P(0xE5AD47),
+  P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AC42), P(0xE5AC43), P(0xE4AC43),
+  P(0xE4AC42), P(0xE4AB42), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40),
+  P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93D), P(0xE6B457), P(0xF2E9DB),
+  P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF6F5F5), P(0xC7C8CB), P(0x686C78), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975), P(0x8A8D96),
+  P(0xE5DFD5), P(0xEBC47C), P(0xE5B04C), P(0xE5B04D), P(0xE5B04C), P(0xE5AF4B),
+  P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48),
+  P(0xE5AE47), P(0xE5AD47), P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AC44),
+  P(0xE4AC43), P(0xE4AC42), P(0xE4AB42), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40),
+  P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93C), P(0xE7B65D),
+  P(0xF3EDE4), P(0xF4F3F4), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF6F5F5), P(0xD5D5D8), P(0x717580), P(0x656975), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x696D79),
+  P(0xC2C3C7), P(0xEFD4A4), P(0xE6B14F), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D),
+  P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48),
+  P(0xE5AE48), P(0xE5AE47), P(0xE5AD47), P(0xE5AD46), P(0xE5AD45), P(0xE5AD44),
+  P(0xE5AC44), P(0xE4AC43), P(0xE4AC42), P(0xE4AB42), P(0xE4AB42), P(0xE4AB41),
+  P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F), P(0xE4A93C),
+  P(0xE9C074), P(0xF4F1EE), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xE7E7E8), P(0x7F838C), P(0x646875),
+  P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x656975),
+  P(0x797D87), P(0xDEDAD5), P(0xEAC074), P(0xE6B04D), P(0xE5B14E), P(0xE5B04E),
+  P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49),
+  P(0xE5AE48), P(0xE5AE48), P(0xE5AE47), P(0xE5AD47), P(0xE5AD46), P(0xE5AD45),
+  P(0xE5AD44), P(0xE5AC44), P(0xE4AC43), P(0xE4AC42), P(0xE4AB42), P(0xE4AB42),
+  P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F), P(0xE4AA3F),
+  P(0xE4A93D), P(0xECCE98), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0x979AA1),
+  P(0x646874), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x646874), P(0x81858F), P(0xE5DDCF), P(0xE9BA66), P(0xE6B04E), P(0xE5B14E),
+  P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49),
+  P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47), P(0xE5AD47), P(0xE5AD46),
+  P(0xE5AD45), P(0xE5AD44), P(0xE5AC44), P(0xE4AC43), P(0xE4AC42), P(0xE4AB42),
+  P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F), P(0xE4AB3F),
+  P(0xE4AA3E), P(0xE5AE49), P(0xF0E0C3), P(0xF4F4F5), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4),
+  P(0xBFC0C4), P(0x696D78), P(0x666A76), P(0x666A76), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x646874), P(0x818590), P(0xE5DDCF), P(0xE8BA66), P(0xE6B04E),
+  P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A),
+  P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47), P(0xE5AD47),
+  P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AC44), P(0xE4AC43), P(0xE4AC42),
+  P(0xE4AB42), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40), P(0xE4AB3F),
+  P(0xE4AB3F), P(0xE4A93D), P(0xE8BC6C), P(0xF3EFE8), P(0xF4F3F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF5F4F4), P(0xE8E7E8), P(0x878A93), P(0x646874), P(0x666A76), P(0x666A76),
+  P(0x666A76), P(0x666A76), P(0x646874), P(0x818590), P(0xE5DDCF), P(0xE8BA66),
+  P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B),
+  P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47),
+  P(0xE5AD47), P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AC44), P(0xE4AC43),
+  P(0xE4AC42), P(0xE4AB42), P(0xE4AB42), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40),
+  P(0xE4AB3F), P(0xE4AA3E), P(0xE4AB42), P(0xEED6AC), P(0xF4F4F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xCECED2), P(0x797C86), P(0x646874),
+  P(0x656975), P(0x656975), P(0x656975), P(0x646874), P(0x81858F), P(0xE5DDCF),
+  P(0xE8BA66), P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B),
+  P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE47),
+  P(0xE5AD46), P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AD43), P(0xE5AC43),
+  P(0xE4AC42), P(0xE4AC42), P(0xE4AB41), P(0xE4AB41), P(0xE4AB40), P(0xE4AB40),
+  P(0xE4AB3F), P(0xE4AA3D), P(0xE4AA3D), P(0xE9C279), P(0xF3EEE7), P(0xF4F3F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xD1D2D5),
+  P(0x94969E), P(0x787C86), P(0x71747F), P(0x71747F), P(0x6F737E), P(0x8A8D97),
+  P(0xE6DED0), P(0xE8BA66), P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D),
+  P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5B04C), P(0xE6B355),
+  P(0xE6B355), P(0xE6B354), P(0xE6B253), P(0xE6B252), P(0xE6B252), P(0xE6B251),
+  P(0xE6B151), P(0xE5B150), P(0xE5B150), P(0xE5B14F), P(0xE5B04F), P(0xE5B04E),
+  P(0xE5B04D), P(0xE5B14D), P(0xE6B65A), P(0xEBC98C), P(0xF2EADD), P(0xF4F4F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF5F4F4), P(0xEFEFEF), P(0xDEDEE0), P(0xD6D6D9), P(0xD6D6D8), P(0xD5D6D8),
+  P(0xDCDCDF), P(0xEFE6D7), P(0xE8BA65), P(0xE6B04E), P(0xE5B14E), P(0xE5B04E),
+  P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AE47), P(0xE8BC6A),
+  P(0xF0E2C8), P(0xF1E3CB), P(0xF1E3CA), P(0xF0E3CA), P(0xF0E2CA), P(0xF0E2CA),
+  P(0xF0E2CA), P(0xF0E2CA), P(0xF0E2C9), P(0xF0E3CB), P(0xF1E4CD), P(0xF1E4CD),
+  P(0xF1E4CD), P(0xF1E4CD), P(0xF1E4CD), P(0xF2EADC), P(0xF4F2F1), P(0xF4F3F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xF6F5F5), P(0xF6F5F5),
+  P(0xF6F5F5), P(0xF6F5F6), P(0xF2E9DA), P(0xE8BA65), P(0xE6B04E), P(0xE5B14E),
+  P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49),
+  P(0xE6B354), P(0xE9BF73), P(0xE9C074), P(0xE9BF73), P(0xE9BF73), P(0xE9BF72),
+  P(0xE9BF71), P(0xE9BF71), P(0xE9BE71), P(0xE8BE6F), P(0xEDD5A9), P(0xF4F4F4),
+  P(0xF4F4F5), P(0xF4F4F5), P(0xF4F4F5), P(0xF4F4F5), P(0xF4F4F4), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4), P(0xF2E9DA), P(0xE8BA65), P(0xE6B04E),
+  P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A),
+  P(0xE5AF49), P(0xE5AE48), P(0xE5AD46), P(0xE5AD45), P(0xE5AD44), P(0xE5AC44),
+  P(0xE5AB42), P(0xE5AB40), P(0xE5AC41), P(0xE5AB41), P(0xE4AA3E), P(0xEBCA8D),
+  P(0xF4F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4), P(0xF2E9DA), P(0xE8BA65),
+  P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B),
+  P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47),
+  P(0xE5AD47), P(0xE7B65B), P(0xE8BA66), P(0xE5AF4A), P(0xE5AC43), P(0xE4AB41),
+  P(0xEBCA8E), P(0xF4F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4), P(0xF2E9DA),
+  P(0xE8BA65), P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B),
+  P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48),
+  P(0xE5AD45), P(0xE8BB6A), P(0xF1E5D0), P(0xF3EDE4), P(0xECD19E), P(0xE5AD47),
+  P(0xE4AB41), P(0xEBCA8E), P(0xF4F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4),
+  P(0xF2EADC), P(0xE8BA67), P(0xE6B04E), P(0xE5B14E), P(0xE5B04E), P(0xE5B04D),
+  P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49), P(0xE5AE48),
+  P(0xE5AE48), P(0xE5AD46), P(0xECCE97), P(0xF4F4F6), P(0xF4F4F6), P(0xF2E9DA),
+  P(0xE6B252), P(0xE4AB40), P(0xECCE96), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF3F0EC), P(0xEAC480), P(0xE6B04D), P(0xE5B14E), P(0xE5B04E),
+  P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49), P(0xE5AE49),
+  P(0xE5AE48), P(0xE5AE48), P(0xE5AD45), P(0xE9C178), P(0xF3EDE3), P(0xF4F3F4),
+  P(0xEFDAB6), P(0xE5AF4A), P(0xE4AE47), P(0xEFDBB9), P(0xF4F4F5), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF0F0F0), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4), P(0xF0E0C3), P(0xE7B75D), P(0xE5B04C),
+  P(0xE5B04E), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A), P(0xE5AF49),
+  P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47), P(0xE5AE49), P(0xE9BF72),
+  P(0xEBC887), P(0xE6B456), P(0xE5AB41), P(0xE9C279), P(0xF3EEE6), P(0xF4F3F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF5F4F4), P(0xF2F2F2),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F2F2), P(0xEFDCBA),
+  P(0xE7BB67), P(0xE5B04D), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4B), P(0xE5AF4A),
+  P(0xE5AF49), P(0xE5AE49), P(0xE5AE48), P(0xE5AE48), P(0xE5AE47), P(0xE5AD46),
+  P(0xE5AC42), P(0xE5AB3F), P(0xE5AE48), P(0xEAC47E), P(0xF2E9DB), P(0xF4F3F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF3F2F2), P(0xF5F5F5),
+  P(0xF4F4F4), P(0xF3F2F2), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF2E8D8), P(0xECD09E), P(0xE8BD6C), P(0xE6B354), P(0xE5AF4A),
+  P(0xE5AE49), P(0xE5AE47), P(0xE5AD46), P(0xE5AD46), P(0xE5AD46), P(0xE5AD46),
+  P(0xE5AE49), P(0xE6B457), P(0xE9C279), P(0xEEDAB4), P(0xF3EFE9), P(0xF4F4F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF2F1F1),
+  P(0xF8F8F8), P(0xFAFAFA), P(0xF0EFEF), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F4F4), P(0xF4F3F3), P(0xF3EDE3), P(0xF0E1C8),
+  P(0xEDD5AA), P(0xEBCB8F), P(0xEAC47D), P(0xE9C074), P(0xE9C177), P(0xEAC785),
+  P(0xECCF9A), P(0xEFDBB7), P(0xF1E6D3), P(0xF3F0EC), P(0xF4F4F5), P(0xF4F3F4),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF3F2F2),
+  P(0xF1F1F1), P(0xFDFDFD), P(0xFFFFFF), P(0xF3F3F3), P(0xF1F0F0), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F4),
+  P(0xF4F4F5), P(0xF4F4F4), P(0xF4F3F2), P(0xF4F2F1), P(0xF4F2F0), P(0xF4F2F0),
+  P(0xF4F2F1), P(0xF4F3F3), P(0xF4F4F5), P(0xF4F4F5), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xEFEEEE), P(0xF7F7F7), P(0xFFFFFF), P(0xFFFFFF), P(0xFDFDFD), P(0xF0EFEF),
+  P(0xF1F0F0), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xEEEDED), P(0xF3F3F3), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xEEEEEE), P(0xEEEDED), P(0xF4F2F2), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3),
+  P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF4F3F3), P(0xF3F2F2),
+  P(0xEDECEC), P(0xF2F2F2), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC), P(0xF2F2F2), P(0xECEBEB), P(0xEDEDED),
+  P(0xF1F0F0), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2),
+  P(0xF3F2F2), P(0xF3F2F2), P(0xF3F2F2), P(0xF2F1F1), P(0xF1F0F0), P(0xEDECEC),
+  P(0xEDECEC), P(0xF6F5F5), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF3F3F3), P(0xEEEDED), P(0xECECEC), P(0xECECEC), P(0xECEBEB), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECEBEB), P(0xECECEC), P(0xECECEC), P(0xEFEFEF),
+  P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFDFDFD), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFDFDFD),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::CodeIcon = &image;
@@ -0,0 +1,64 @@
+#include "console_store.h"
+#include <assert.h>
+
+namespace Code {
+
+static constexpr int k_tabWidth = 2;
+
+ConsoleStore::ConsoleStore() :
+  m_startIndex(0),
+  m_numberOfLines(0),
+  m_column(0),
+  m_pendingNewLine(false)
+{
+}
+
+void ConsoleStore::push(const char * text, size_t length) {
+  for (size_t i = 0; i < length; i++) {
+    char c = text[i];
+    if (c == '\r') {
+      continue;
+    }
+    if (m_numberOfLines == 0 || m_pendingNewLine) {
+      openLine();
+    }
+    if (c == '\n') {
+      m_pendingNewLine = true;
+      continue;
+    }
+    if (m_column == k_lineLength) {
+      openLine();
+    }
+    char * line = m_lines[(m_startIndex + m_numberOfLines - 1) % k_numberOfLines];
+    int repeat = c == '\t' ? k_tabWidth - m_column % k_tabWidth : 1;
+    for (int j = 0; j < repeat && m_column < k_lineLength; j++) {
+      line[m_column++] = c == '\t' ? ' ' : c;
+    }
+    line[m_column] = 0;
+  }
+}
+
+void ConsoleStore::clear() {
+  m_startIndex = 0;
+  m_numberOfLines = 0;
+  m_column = 0;
+  m_pendingNewLine = false;
+}
+
+const char * ConsoleStore::lineAtIndex(int i) const {
+  assert(i >= 0 && i < m_numberOfLines);
+  return m_lines[(m_startIndex + i) % k_numberOfLines];
+}
+
+void ConsoleStore::openLine() {
+  if (m_numberOfLines < k_numberOfLines) {
+    m_numberOfLines++;
+  } else {
+    m_startIndex = (m_startIndex + 1) % k_numberOfLines;
+  }
+  m_lines[(m_startIndex + m_numberOfLines - 1) % k_numberOfLines][0] = 0;
+  m_column = 0;
+  m_pendingNewLine = false;
+}
+
+}
@@ -0,0 +1,33 @@
+#ifndef CODE_CONSOLE_STORE_H
+#define CODE_CONSOLE_STORE_H
+
+#include <stddef.h>
+
+namespace Code {
+
+/* ConsoleStore keeps the last lines printed by a script in a ring buffer.
+ * Lines longer than a screen width are wrapped, and once the buffer is full
+ * each new line overwrites the oldest one. */
+
+class ConsoleStore {
+public:
+  ConsoleStore();
+  void push(const char * text, size_t length);
+  void clear();
+  int numberOfLines() const { return m_numberOfLines; }
+  // Line 0 is the oldest one still in the buffer
+  const char * lineAtIndex(int i) const;
+  static constexpr int k_numberOfLines = 64;
+  static constexpr int k_lineLength = 32;
+private:
+  void openLine();
+  char m_lines[k_numberOfLines][k_lineLength+1];
+  int m_startIndex;
+  int m_numberOfLines;
+  int m_column;
+  bool m_pendingNewLine;
+};
+
+}
+
+#endif
@@ -6,9 +6,13 @@ extern "C" {
 #include "py/mphal.h"
 #include "py/compile.h"
 #include "py/runtime.h"
-#include "py/gc.h"
 #include "py/stackctrl.h"
+#include "interrupt_helper.h"
+#include "profiler.h"
 }
+#if PYTHON_PROFILER_DUMP
+#include <stdio.h>
+#endif
 
 namespace Code {
 
@@ -30,75 +34,180 @@ mp_obj_t execute_from_str(const char *str) {
 }
 
 /* mp_hal_stdout_tx_strn_cooked symbol required by micropython at printing
- * needs to access information about where to print (depending on the strings
- * printed before). This 'context' is provided by the global sCurrentView that
- * points to the content view only within the drawRect method (as runPython is
- * called within drawRect). */
+ * needs to access information about where to print. This 'context' is
+ * provided by the global sCurrentView that points to the content view only
+ * while it runs a script. */
 static const ExecutorController::ContentView * sCurrentView = nullptr;
 
 extern "C"
 void mp_hal_stdout_tx_strn_cooked(const char * str, size_t len) {
   assert(sCurrentView != nullptr);
-  sCurrentView->print(str);
+  sCurrentView->print(str, len);
 }
 
-ExecutorController::ContentView::ContentView(Program * program) :
+/* Printing only fills the console store. The screen catches up at the
+ * interpreter's periodic check points, about 20 times per second, so a script
+ * printing in a tight loop isn't slowed down by writing every line to the
+ * LCD. */
+static void flushCurrentView() {
+  assert(sCurrentView != nullptr);
+  sCurrentView->flush();
+}
+
+static void printProfileToCurrentView(void * env, const char * str, size_t len) {
+  mp_hal_stdout_tx_strn_cooked(str, len);
+}
+
+#if PYTHON_PROFILER_DUMP
+static void printProfileToStdout(void * env, const char * str, size_t len) {
+  fwrite(str, 1, len, stdout);
+}
+#endif
+
+ExecutorController::ContentView::ContentView(Program * program, ConsoleStore * consoleStore) :
   View(),
   m_program(program),
-  m_printLocation(KDPointZero)
+  m_consoleStore(consoleStore),
+  m_firstVisibleLine(0),
+  m_hasRun(false),
+  m_needsFlush(false)
 {
 }
 
 void ExecutorController::ContentView::drawRect(KDContext * ctx, KDRect rect) const {
-  assert(ctx == KDIonContext::sharedContext());
-  clearScreen(ctx);
+  if (!m_hasRun) {
+    // The script runs once this blank frame is on screen
+    ctx->fillRect(bounds(), KDColorWhite);
+    return;
+  }
+  drawLines(ctx, true);
+}
 
+void ExecutorController::ContentView::run(bool withProfiler) {
+  assert(!m_hasRun);
+  m_hasRun = true;
   assert(sCurrentView == nullptr);
   sCurrentView = this;
+  // kandinsky draws in the shared context, relative to this view
+  drawingContext();
+  runPython(withProfiler);
+  flush();
+  sCurrentView = nullptr;
+}
 
-  // Reinitialize the print location
-  m_printLocation = KDPointZero;
-  runPython();
+void ExecutorController::ContentView::print(const char * str, size_t length) const {
+  m_consoleStore->push(str, length);
+  m_needsFlush = true;
+}
 
-  sCurrentView = nullptr;
+void ExecutorController::ContentView::flush() const {
+  if (!m_needsFlush) {
+    return;
+  }
+  int numberOfHiddenLines = m_consoleStore->numberOfLines() - numberOfVisibleLines();
+  m_firstVisibleLine = numberOfHiddenLines > 0 ? numberOfHiddenLines : 0;
+  /* Whatever the script drew with kandinsky is left alone, apart from the rows
+   * the console is printed on. */
+  drawLines(drawingContext(), false);
+  m_needsFlush = false;
+}
+
+void ExecutorController::ContentView::reset() {
+  m_consoleStore->clear();
+  m_firstVisibleLine = 0;
+  m_hasRun = false;
+  m_needsFlush = false;
+  markRectAsDirty(bounds());
 }
 
-void ExecutorController::ContentView::print(const char * str) const {
-  KDContext * ctx = KDIonContext::sharedContext();
-  m_printLocation = ctx->drawString(str, m_printLocation);
-  if (bounds().height() < m_printLocation.y()) {
-    clearScreen(ctx);
-    m_printLocation = KDPoint(m_printLocation.x(), 0);
+bool ExecutorController::ContentView::scroll(int delta) {
+  if (!m_hasRun) {
+    return false;
+  }
+  int numberOfHiddenLines = m_consoleStore->numberOfLines() - numberOfVisibleLines();
+  int maxFirstVisibleLine = numberOfHiddenLines > 0 ? numberOfHiddenLines : 0;
+  int firstVisibleLine = m_firstVisibleLine + delta;
+  firstVisibleLine = firstVisibleLine < 0 ? 0 : firstVisibleLine;
+  firstVisibleLine = firstVisibleLine > maxFirstVisibleLine ? maxFirstVisibleLine : firstVisibleLine;
+  if (firstVisibleLine == m_firstVisibleLine) {
+    return false;
   }
+  m_firstVisibleLine = firstVisibleLine;
+  markRectAsDirty(bounds());
+  return true;
 }
 
-void ExecutorController::ContentView::runPython() const {
+void ExecutorController::ContentView::runPython(bool withProfiler) const {
   // Initialized stack limit
   mp_stack_set_limit(40000);
 
-  mp_port_init_stack_top();
+  // execute_from_str's frame, which holds the parse tree, must be scanned
+  char stackTop;
+  mp_port_init_stack_top(&stackTop);
 
-  char * pythonHeap = (char *)malloc(16384);
+  // Give the heap as much memory as is available, within bounds and headroom
+  size_t heapSize = mp_port_heap_size(malloc_max_available(), malloc_max_available_after);
+  char * pythonHeap = heapSize > 0 ? (char *)malloc(heapSize) : nullptr;
+  if (pythonHeap == nullptr) {
+    print("MemoryError", 11);
+    return;
+  }
 
-  gc_init(pythonHeap, pythonHeap + 16384);
+  mp_port_gc_init(pythonHeap, pythonHeap + heapSize);
 
   // Initialize interpreter
   mp_init();
 
+  setCheckpointHandler(flushCurrentView);
+  if (withProfiler) {
+    mp_port_profiler_start();
+  }
   if (execute_from_str(m_program->readOnlyContent())) {
-    mp_hal_stdout_tx_strn_cooked("Error", 0);
+    mp_hal_stdout_tx_strn_cooked("Error", 5);
+  }
+  setCheckpointHandler(nullptr);
+  if (withProfiler) {
+    mp_port_profiler_stop();
+    printProfile();
   }
 
   free(pythonHeap);
 }
 
-void ExecutorController::ContentView::clearScreen(KDContext * ctx) const {
-  ctx->fillRect(bounds(), KDColorWhite);
+void ExecutorController::ContentView::printProfile() const {
+  mp_print_t print = {nullptr, printProfileToCurrentView};
+  // The script output may not end with a new line
+  mp_print_str(&print, "\n");
+  mp_port_profiler_print(&print, k_numberOfProfileLines);
+#if PYTHON_PROFILER_DUMP
+  print = {nullptr, printProfileToStdout};
+  mp_port_profiler_print(&print, MP_PORT_PROFILER_MAX_LINES);
+#endif
+}
+
+void ExecutorController::ContentView::drawLines(KDContext * ctx, bool clearBelow) const {
+  KDCoordinate lineHeight = KDText::charSize().height();
+  KDCoordinate width = bounds().width();
+  KDCoordinate y = 0;
+  for (int i = m_firstVisibleLine; i < m_consoleStore->numberOfLines() && y + lineHeight <= bounds().height(); i++) {
+    KDPoint end = ctx->drawString(m_consoleStore->lineAtIndex(i), KDPoint(0, y));
+    ctx->fillRect(KDRect(end.x(), y, width - end.x(), lineHeight), KDColorWhite);
+    y += lineHeight;
+  }
+  if (clearBelow) {
+    ctx->fillRect(KDRect(0, y, width, bounds().height() - y), KDColorWhite);
+  }
+}
+
+int ExecutorController::ContentView::numberOfVisibleLines() const {
+  return bounds().height() / KDText::charSize().height();
 }
 
 ExecutorController::ExecutorController(Program * program) :
   ViewController(nullptr),
-  m_view(program)
+  m_view(program, &m_consoleStore),
+  m_scriptIsPending(false),
+  m_scriptIsProfiled(false)
 {
 }
 
@@ -106,11 +215,49 @@ View * ExecutorController::view() {
   return &m_view;
 }
 
+void ExecutorController::viewWillAppear() {
+  m_view.reset();
+  m_scriptIsPending = true;
+  m_scriptIsProfiled = false;
+}
+
+void ExecutorController::viewDidDisappear() {
+  m_scriptIsPending = false;
+}
+
+bool ExecutorController::runPendingScript() {
+  if (!m_scriptIsPending) {
+    return false;
+  }
+  m_scriptIsPending = false;
+  m_view.run(m_scriptIsProfiled);
+  return true;
+}
+
+bool ExecutorController::profileScript() {
+  if (m_scriptIsPending) {
+    return false;
+  }
+  m_view.reset();
+  m_scriptIsPending = true;
+  m_scriptIsProfiled = true;
+  return true;
+}
+
 bool ExecutorController::handleEvent(Ion::Events::Event event) {
   if (event == Ion::Events::OK) {
     app()->dismissModalViewController();
     return true;
   }
+  if (event == Ion::Events::Toolbox) {
+    return profileScript();
+  }
+  if (event == Ion::Events::Up) {
+    return m_view.scroll(-1);
+  }
+  if (event == Ion::Events::Down) {
+    return m_view.scroll(1);
+  }
   return false;
 }
 
@@ -2,6 +2,7 @@
 #define CODE_EXECUTOR_CONTROLLER_H
 
 #include <escher.h>
+#include "console_store.h"
 #include "program.h"
 
 namespace Code {
@@ -10,23 +11,43 @@ class ExecutorController : public ViewController {
 public:
   ExecutorController(Program * program);
   View * view() override;
+  void viewWillAppear() override;
+  void viewDidDisappear() override;
   bool handleEvent(Ion::Events::Event event) override;
+  /* The script doesn't run while the executor is being displayed, but from
+   * the run loop once it is on screen. */
+  bool runPendingScript();
+  /* Profiling slows scripts down, so it's opt-in: the Toolbox key runs the
+   * script again under the profiler and appends the report to its output. */
+  bool profileScript();
   class ContentView : public View {
   public:
-    ContentView(Program * program);
+    ContentView(Program * program, ConsoleStore * consoleStore);
     void drawRect(KDContext * ctx, KDRect rect) const override;
-    void print(const char * str) const;
+    void run(bool withProfiler);
+    void print(const char * str, size_t length) const;
+    void flush() const;
+    void reset();
+    bool scroll(int delta);
   private:
-    void runPython() const;
-    void clearScreen(KDContext * ctx) const;
+    constexpr static int k_numberOfProfileLines = 8;
+    void runPython(bool withProfiler) const;
+    void printProfile() const;
+    void drawLines(KDContext * ctx, bool clearBelow) const;
+    int numberOfVisibleLines() const;
     Program * m_program;
-    mutable KDPoint m_printLocation;
+    ConsoleStore * m_consoleStore;
+    mutable int m_firstVisibleLine;
+    mutable bool m_hasRun;
+    mutable bool m_needsFlush;
   };
 private:
+  ConsoleStore m_consoleStore;
   ContentView m_view;
+  bool m_scriptIsPending;
+  bool m_scriptIsProfiled;
 };
 
 }
 
 #endif
-
@@ -55,4 +55,8 @@ void MenuController::willDisplayCellForIndex(HighlightCell * cell, int index) {
   myCell->setMessage(titles[index]);
 }
 
+bool MenuController::runPendingScript() {
+  return m_executorController.runPendingScript();
+}
+
 }
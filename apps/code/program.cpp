@@ -1,9 +1,10 @@
 #include "program.h"
+#include <assert.h>
 
 namespace Code {
 
 Program::Program() :
-  m_buffer("")
+  m_text()
 {
   const char program[] = R"(# This program draws a Mandelbrot fractal set
 # N_iteration: degree of precision
@@ -29,25 +30,42 @@ for x in range(320):
 # Draw a pixel colored in 'col' at position (x,y)
     kandinsky.set_pixel(x,y,col))";
 
-  constexpr size_t len = sizeof(program);
-  static_assert(len < k_bufferSize, "Default program length bigger than buffer size");
-  memcpy(m_buffer, program, len);
+  m_text.setText(program);
 }
 
 const char * Program::readOnlyContent() const {
-  return m_buffer;
+  return m_text.text();
 }
 
 char * Program::editableContent() {
-  return m_buffer;
+  char * buffer = m_text.edit(bufferSize());
+  if (buffer == nullptr) {
+    /* The program is empty and the store is full: the editor is given a
+     * buffer with no room, see bufferSize. */
+    assert(m_text.capacity() == 0);
+    static char sEmptyProgram[1];
+    sEmptyProgram[0] = 0;
+    return sEmptyProgram;
+  }
+  return buffer;
 }
 
 void Program::setContent(const char * program) {
-  memcpy(m_buffer, program, k_bufferSize);
+  m_text.setText(program);
 }
 
 int Program::bufferSize() const {
-  return k_bufferSize;
+  Shared::RecordStore * store = Shared::RecordStore::sharedRecordStore();
+  if (m_text.capacity() == 0 && (store->availableSize() == 0 || store->numberOfRecords() == Shared::RecordStore::k_maxNumberOfRecords)) {
+    // Room for the null terminator only
+    return 1;
+  }
+  /* Once editableContent has grown the record, there is no room left */
+  return m_text.capacity() + store->availableSize();
+}
+
+void Program::stopEditing() {
+  m_text.shrinkToFit();
 }
 
 }
@@ -2,6 +2,7 @@
 #define CODE_PROGRAM_H
 
 #include <escher.h>
+#include "../shared/text_record.h"
 
 namespace Code {
 
@@ -12,9 +13,11 @@ public:
   char * editableContent();
   void setContent(const char * program);
   int bufferSize() const;
+  /* While the program is edited, its record takes all the free room of the
+   * record store. stopEditing gives it back. */
+  void stopEditing();
 private:
-  constexpr static int k_bufferSize = 1024;
-  char m_buffer[k_bufferSize];
+  Shared::TextRecord m_text;
 };
 
 }
@@ -0,0 +1,35 @@
+#include <quiz.h>
+#include <assert.h>
+#include "helper.h"
+
+QUIZ_CASE(code_array_storage) {
+  init_python();
+  // 1000 unboxed floats fit in the heap, 1000 boxed ones don't
+  assert(execute_python(
+    "from array import array\n"
+    "a = array('f', range(1000))\n"
+    "a[10] = a[10] * 2.5\n"
+    "n = len(a)\n"
+    "x = a[10]\n"));
+  assert(python_global_int("n") == 1000);
+  assert(python_global_float("x") == 25.0f);
+  assert(!execute_python("l = [i * 1.5 for i in range(1000)]\n"));
+  deinit_python();
+}
+
+QUIZ_CASE(code_memoryview_shares_buffer) {
+  init_python();
+  assert(execute_python(
+    "from array import array\n"
+    "b = bytearray(4)\n"
+    "m = memoryview(b)\n"
+    "m[1] = 7\n"
+    "x = b[1]\n"
+    "h = array('h', [1, 2, 3])\n"
+    "v = memoryview(h)\n"
+    "h[2] = -4\n"
+    "y = v[2]\n"));
+  assert(python_global_int("x") == 7);
+  assert(python_global_int("y") == -4);
+  deinit_python();
+}
@@ -0,0 +1,278 @@
+#include <quiz.h>
+#include <assert.h>
+#include <math.h>
+#include <string.h>
+#include "helper.h"
+
+extern "C" {
+#include "profiler.h"
+}
+
+/* Micro-benchmarks of the Python interpreter. Each case runs its setup script
+ * in a fresh interpreter, then times its loop script, which is compiled once
+ * so that only its execution is timed. Built with QUIZ_RUN_BENCHMARKS=1, the
+ * test runner prints one BENCH line per case, named code_bench_<suite>_<case>.
+ * A normal test run executes each loop once and checks what it computed. */
+
+static mp_obj_t sLoop;
+
+static void runLoop() {
+  assert(call_python(sLoop));
+}
+
+/* Leaves the interpreter running, so that the caller can read the globals set
+ * by the loop before calling deinit_python. The heap is larger than the
+ * tests', as the allocation loops fragment a 16KB heap until they run out of
+ * memory when nothing is collected beforehand. */
+static void bench(const char * suite, const char * name, const char * setup, const char * loop) {
+  init_python(32768);
+  assert(execute_python(setup));
+  /* The collector doesn't scan sLoop, but it does scan the globals. The global
+   * is bound beforehand, so that storing the loop doesn't allocate. */
+  assert(execute_python("bench_loop = None\n"));
+  sLoop = compile_python(loop);
+  assert(sLoop != MP_OBJ_NULL);
+  mp_store_global(qstr_from_str("bench_loop"), sLoop);
+
+  constexpr static const char * prefix = "code_bench_";
+  char benchName[64];
+  int length = strlcpy(benchName, prefix, sizeof(benchName));
+  length += strlcpy(benchName + length, suite, sizeof(benchName) - length);
+  benchName[length++] = '_';
+  strlcpy(benchName + length, name, sizeof(benchName) - length);
+  quiz_bench(benchName, runLoop);
+}
+
+static void assertRoughlyEqual(mp_float_t a, mp_float_t b) {
+  assert(fabsf(a - b) <= 1E-3f * fabsf(b));
+}
+
+/* Numerical kernels written in Python, against the same functions from the
+ * math module. */
+
+struct Kernel {
+  const char * name;
+  const char * interpreted;
+  const char * native;
+};
+
+static const Kernel sKernels[] = {
+  {"sqrt",
+    "def f(x):\n"
+    "  if x == 0:\n"
+    "    return 0.0\n"
+    "  y = x\n"
+    "  for i in range(20):\n"
+    "    y = (y + x / y) / 2\n"
+    "  return y\n",
+    "from math import sqrt as f\n"},
+  {"sin",
+    "def f(x):\n"
+    "  x = x % 6.2831853\n"
+    "  t = x\n"
+    "  s = x\n"
+    "  for i in range(1, 12):\n"
+    "    t = -t * x * x / ((2 * i) * (2 * i + 1))\n"
+    "    s = s + t\n"
+    "  return s\n",
+    "from math import sin as f\n"},
+  {"exp",
+    "def f(x):\n"
+    "  t = 1.0\n"
+    "  s = 1.0\n"
+    "  for i in range(1, 20):\n"
+    "    t = t * x / i\n"
+    "    s = s + t\n"
+    "  return s\n",
+    "from math import exp as f\n"},
+};
+
+QUIZ_CASE(code_bench_math) {
+  const char * loop =
+    "r = 0.0\n"
+    "for i in range(200):\n"
+    "  r = r + f(i / 100)\n";
+  for (const Kernel & k : sKernels) {
+    char name[16];
+    int length = strlcpy(name, k.name, sizeof(name));
+    strlcpy(name + length, "_python", sizeof(name) - length);
+    bench("math", name, k.interpreted, loop);
+    mp_float_t interpreted = python_global_float("r");
+    deinit_python();
+    strlcpy(name + length, "_native", sizeof(name) - length);
+    bench("math", name, k.native, loop);
+    assertRoughlyEqual(interpreted, python_global_float("r"));
+    deinit_python();
+  }
+}
+
+/* The same loops compiled to bytecode, with @micropython.native and with
+ * @micropython.viper. On platforms without a native emitter, only the
+ * bytecode is timed. */
+
+struct Loop {
+  const char * name;
+  const char * signature;
+  const char * viperSignature;
+  const char * body;
+};
+
+static const Loop sLoops[] = {
+  {"count", "def f(n):\n", "def f(n: int) -> int:\n",
+    "  i = 0\n"
+    "  while i < n:\n"
+    "    i += 1\n"
+    "  return i\n"},
+  {"sum", "def f(n):\n", "def f(n: int) -> int:\n",
+    "  s = 0\n"
+    "  i = 0\n"
+    "  while i < n:\n"
+    "    s += (i * i) & 0xff\n"
+    "    i += 1\n"
+    "  return s\n"},
+  {"fib", "def f(n):\n", "def f(n: int) -> int:\n",
+    "  a = 0\n"
+    "  b = 1\n"
+    "  i = 0\n"
+    "  while i < n:\n"
+    "    t = (a + b) & 0xffff\n"
+    "    a = b\n"
+    "    b = t\n"
+    "    i += 1\n"
+    "  return a\n"},
+};
+
+QUIZ_CASE(code_bench_native) {
+  struct Emitter {
+    const char * name;
+    const char * decorator;
+  };
+  const Emitter emitters[] = {
+    {"bytecode", ""},
+#if MICROPY_EMIT_NATIVE
+    {"native", "@micropython.native\n"},
+    {"viper", "@micropython.viper\n"},
+#endif
+  };
+  for (const Loop & l : sLoops) {
+    mp_int_t expected = 0;
+    for (const Emitter & e : emitters) {
+      bool viper = strcmp(e.name, "viper") == 0;
+      char setup[256];
+      int length = strlcpy(setup, "import micropython\n", sizeof(setup));
+      length += strlcpy(setup + length, e.decorator, sizeof(setup) - length);
+      length += strlcpy(setup + length, viper ? l.viperSignature : l.signature, sizeof(setup) - length);
+      strlcpy(setup + length, l.body, sizeof(setup) - length);
+      char name[24];
+      length = strlcpy(name, l.name, sizeof(name));
+      name[length++] = '_';
+      strlcpy(name + length, e.name, sizeof(name) - length);
+      bench("native", name, setup, "r = f(10000)\n");
+      mp_int_t result = python_global_int("r");
+      deinit_python();
+      assert(&e == emitters || result == expected);
+      expected = result;
+    }
+  }
+}
+
+/* An allocation-heavy loop with several automatic collection thresholds, as
+ * fractions of the heap. */
+
+QUIZ_CASE(code_bench_gc) {
+  struct Threshold {
+    const char * name;
+    const char * setup;
+  };
+  const Threshold thresholds[] = {
+    {"none", "import gc\ngc.threshold(-1)\n"},
+    {"heap_2", "import gc\ngc.threshold((gc.mem_free() + gc.mem_alloc()) // 2)\n"},
+    {"heap_4", "import gc\ngc.threshold((gc.mem_free() + gc.mem_alloc()) // 4)\n"},
+    {"heap_8", "import gc\ngc.threshold((gc.mem_free() + gc.mem_alloc()) // 8)\n"},
+    {"heap_16", "import gc\ngc.threshold((gc.mem_free() + gc.mem_alloc()) // 16)\n"},
+  };
+  const char * loop =
+    "keep = []\n"
+    "r = 0\n"
+    "for i in range(2000):\n"
+    "  t = [i, i + 1, i + 2]\n"
+    "  s = str(i) + 'x'\n"
+    "  if i % 16 == 0:\n"
+    "    keep.append(s)\n"
+    "    if len(keep) > 64:\n"
+    "      keep.pop(0)\n"
+    "  r += len(t) + len(s)\n";
+  for (const Threshold & t : thresholds) {
+    bench("gc", t.name, t.setup, loop);
+    assert(python_global_int("r") == 2000 * (3 + 1) + 10 * 1 + 90 * 2 + 900 * 3 + 1000 * 4);
+    deinit_python();
+  }
+}
+
+/* Functions tabulated with a Python loop, against a single call to
+ * poincare.evaluate. */
+
+struct Function {
+  const char * name;
+  const char * interpreted;
+  const char * expression;
+};
+
+static const Function sFunctions[] = {
+  {"poly", "0.5*x*x+3*x+1", "0.5*x^2+3*x+1"},
+  // poincare.evaluate follows the calculator's angle unit, in degrees by default
+  {"trig", "math.sin(math.radians(x))*math.cos(math.radians(2*x))", "sin(x)*cos(2*x)"},
+  {"log", "math.log(x+1)/(x+1)", "ln(x+1)/(x+1)"},
+};
+
+QUIZ_CASE(code_bench_poincare) {
+  const char * setup =
+    "import math\n"
+    "import poincare\n"
+    "from array import array\n"
+    "xs = array('f', range(100))\n"
+    "r = array('f', xs)\n";
+  for (const Function & f : sFunctions) {
+    char name[16];
+    int length = strlcpy(name, f.name, sizeof(name));
+    char loop[128];
+    int loopLength = strlcpy(loop, "for i in range(len(xs)):\n  x = xs[i]\n  r[i] = ", sizeof(loop));
+    loopLength += strlcpy(loop + loopLength, f.interpreted, sizeof(loop) - loopLength);
+    strlcpy(loop + loopLength, "\nlast = r[-1]\n", sizeof(loop) - loopLength);
+    strlcpy(name + length, "_python", sizeof(name) - length);
+    bench("poincare", name, setup, loop);
+    mp_float_t interpreted = python_global_float("last");
+    deinit_python();
+    loopLength = strlcpy(loop, "r = poincare.evaluate('", sizeof(loop));
+    loopLength += strlcpy(loop + loopLength, f.expression, sizeof(loop) - loopLength);
+    strlcpy(loop + loopLength, "', xs)\nlast = r[-1]\n", sizeof(loop) - loopLength);
+    strlcpy(name + length, "_evaluate", sizeof(name) - length);
+    bench("poincare", name, setup, loop);
+    assertRoughlyEqual(interpreted, python_global_float("last"));
+    deinit_python();
+  }
+}
+
+// A loop calling a function, with and without the profiler
+
+QUIZ_CASE(code_bench_profiler) {
+  const char * setup =
+    "def f(x):\n"
+    "  s = 0\n"
+    "  for i in range(10):\n"
+    "    s += x * i\n"
+    "  return s\n";
+  const char * loop =
+    "r = 0\n"
+    "for j in range(500):\n"
+    "  r += f(j) % 7\n";
+  bench("profiler", "off", setup, loop);
+  mp_int_t reference = python_global_int("r");
+  deinit_python();
+  mp_port_profiler_start();
+  bench("profiler", "on", setup, loop);
+  mp_port_profiler_stop();
+  assert(python_global_int("r") == reference);
+  assert(mp_port_profiler_number_of_lines() > 0);
+  deinit_python();
+}
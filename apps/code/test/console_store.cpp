@@ -0,0 +1,60 @@
+#include <quiz.h>
+#include <string.h>
+#include <assert.h>
+#include "../console_store.h"
+
+using namespace Code;
+
+static void push(ConsoleStore * store, const char * text) {
+  store->push(text, strlen(text));
+}
+
+QUIZ_CASE(code_console_store_lines) {
+  ConsoleStore store;
+  assert(store.numberOfLines() == 0);
+  push(&store, "Hello");
+  push(&store, " world\n");
+  assert(store.numberOfLines() == 1);
+  assert(strcmp(store.lineAtIndex(0), "Hello world") == 0);
+  push(&store, "\n2\r\n");
+  assert(store.numberOfLines() == 3);
+  assert(strcmp(store.lineAtIndex(1), "") == 0);
+  assert(strcmp(store.lineAtIndex(2), "2") == 0);
+  push(&store, "\t3");
+  assert(strcmp(store.lineAtIndex(3), "  3") == 0);
+  store.clear();
+  assert(store.numberOfLines() == 0);
+}
+
+QUIZ_CASE(code_console_store_wraps_long_lines) {
+  ConsoleStore store;
+  char line[ConsoleStore::k_lineLength+1];
+  memset(line, 'a', ConsoleStore::k_lineLength);
+  line[ConsoleStore::k_lineLength] = 0;
+  push(&store, line);
+  push(&store, "\n");
+  // A line exactly as wide as the screen doesn't leave an empty line behind
+  assert(store.numberOfLines() == 1);
+  push(&store, line);
+  push(&store, "bc");
+  assert(store.numberOfLines() == 3);
+  assert(strcmp(store.lineAtIndex(1), line) == 0);
+  assert(strcmp(store.lineAtIndex(2), "bc") == 0);
+}
+
+QUIZ_CASE(code_console_store_drops_oldest_lines) {
+  ConsoleStore store;
+  char text[16];
+  for (int i = 0; i < 10000; i++) {
+    int length = 0;
+    for (int n = i; n > 0 || length == 0; n /= 10) {
+      memmove(text + 1, text, length++);
+      text[0] = '0' + n % 10;
+    }
+    text[length++] = '\n';
+    store.push(text, length);
+  }
+  assert(store.numberOfLines() == ConsoleStore::k_numberOfLines);
+  assert(strcmp(store.lineAtIndex(0), "9936") == 0);
+  assert(strcmp(store.lineAtIndex(ConsoleStore::k_numberOfLines-1), "9999") == 0);
+}
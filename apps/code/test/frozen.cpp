@@ -0,0 +1,30 @@
+#include <quiz.h>
+#include <assert.h>
+#include "helper.h"
+
+QUIZ_CASE(code_frozen_module) {
+  init_python();
+
+  // Frozen modules bring their own qstrs, which don't live on the heap
+  assert(qstr_find_strn("getrandbits", 11) != MP_QSTR_NULL);
+
+  assert(execute_python(
+    "import random\n"
+    "random.seed(3)\n"
+    "a = random.randint(1, 6)\n"
+    "b = random.randrange(10, 20, 5)\n"
+    "c = int(random.random() * 100)\n"
+    "random.seed(3)\n"
+    "d = random.randint(1, 6)\n"));
+  mp_int_t a = python_global_int("a");
+  assert(a >= 1 && a <= 6);
+  mp_int_t b = python_global_int("b");
+  assert(b == 10 || b == 15);
+  mp_int_t c = python_global_int("c");
+  assert(c >= 0 && c < 100);
+  assert(python_global_int("d") == a);
+
+  assert(!execute_python("import notfrozen\n"));
+
+  deinit_python();
+}
@@ -0,0 +1,80 @@
+#include <quiz.h>
+#include <assert.h>
+#include "helper.h"
+
+extern "C" {
+#include "port.h"
+}
+
+static size_t unbounded_max_available_after(size_t size) {
+  return SIZE_MAX;
+}
+
+/* A buddy allocator like memsys5, with one free block of s_largestBlock bytes
+ * and, elsewhere, one of s_otherBlock bytes. */
+static size_t s_largestBlock;
+static size_t s_otherBlock;
+
+static size_t buddy_max_available_after(size_t size) {
+  size_t block = 256;
+  while (block < size) {
+    block *= 2;
+  }
+  if (block > s_largestBlock) {
+    return 0;
+  }
+  size_t leftOfLargest = block < s_largestBlock ? s_largestBlock/2 : 0;
+  return leftOfLargest > s_otherBlock ? leftOfLargest : s_otherBlock;
+}
+
+static size_t heap_size_in_buddy(size_t largestBlock, size_t otherBlock) {
+  s_largestBlock = largestBlock;
+  s_otherBlock = otherBlock;
+  return mp_port_heap_size(largestBlock, buddy_max_available_after);
+}
+
+QUIZ_CASE(code_heap_size) {
+  assert(mp_port_heap_size(SIZE_MAX, unbounded_max_available_after) == MP_PORT_HEAP_MAX_SIZE);
+  assert(mp_port_heap_size(20000, unbounded_max_available_after) == 16384);
+  assert(mp_port_heap_size(MP_PORT_HEAP_MIN_SIZE - 1, unbounded_max_available_after) == 0);
+  assert(mp_port_heap_size(0, unbounded_max_available_after) == 0);
+  // A heap bigger than half the largest block would take all of it
+  assert(heap_size_in_buddy(65536, 0) == 32768);
+  assert(heap_size_in_buddy(16384, 0) == MP_PORT_HEAP_MIN_SIZE);
+  assert(heap_size_in_buddy(MP_PORT_HEAP_MIN_SIZE, 0) == 0);
+  // Unless the headroom is left elsewhere
+  assert(heap_size_in_buddy(65536, MP_PORT_HEAP_HEADROOM) == 65536);
+  assert(heap_size_in_buddy(65536, MP_PORT_HEAP_HEADROOM/2) == 32768);
+  assert(heap_size_in_buddy(131072, 0) == MP_PORT_HEAP_MAX_SIZE);
+}
+
+QUIZ_CASE(code_gc_module) {
+  init_python();
+  assert(execute_python(
+    "import gc\n"
+    "total = gc.mem_free() + gc.mem_alloc()\n"
+    "threshold = gc.threshold()\n"
+    "l = [i for i in range(100)]\n"
+    "l = None\n"
+    "freed = gc.collect()\n"));
+  const mp_port_gc_stats_t * stats = mp_port_gc_stats();
+  mp_int_t total = python_global_int("total");
+  assert(total > 0 && (size_t)total <= stats->heap_size);
+  assert(python_global_int("threshold") == (mp_int_t)stats->heap_size / 4);
+  assert(python_global_int("freed") > 0);
+  assert(stats->collections >= 1);
+  assert(stats->max_pause_us >= stats->last_pause_us);
+  deinit_python();
+}
+
+QUIZ_CASE(code_gc_collects_before_heap_is_full) {
+  init_python();
+  // Each iteration leaves garbage behind: without the threshold, nothing would
+  // be collected until the heap is exhausted.
+  assert(execute_python(
+    "for i in range(200):\n"
+    "  l = [i, i, i, i]\n"));
+  const mp_port_gc_stats_t * stats = mp_port_gc_stats();
+  assert(stats->collections >= 1);
+  deinit_python();
+}
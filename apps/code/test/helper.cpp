@@ -0,0 +1,83 @@
+#include "helper.h"
+#include <assert.h>
+#include <string.h>
+
+extern "C" {
+#include "port.h"
+#include "py/compile.h"
+#include "py/stackctrl.h"
+#include "py/mphal.h"
+}
+
+static char sPythonHeap[32768];
+
+void init_python() {
+  init_python(16384);
+}
+
+void init_python(size_t heapSize) {
+  assert(heapSize <= sizeof(sPythonHeap));
+  mp_stack_set_limit(40000);
+  char stackTop;
+  mp_port_init_stack_top(&stackTop);
+  mp_port_gc_init(sPythonHeap, sPythonHeap + heapSize);
+  mp_init();
+  mp_hal_set_interrupt_char(-1);
+}
+
+void deinit_python() {
+  mp_deinit();
+}
+
+/* The collector only scans the stack up to the top given to the port. Each
+ * entry point below marks its own frame as the top, then calls into the
+ * interpreter from a function that isn't inlined, whose frames are all below
+ * it. */
+
+static mp_obj_t __attribute__((noinline)) compile(const char * str) {
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    mp_lexer_t *lex = mp_lexer_new_from_str_len(0, str, strlen(str), false);
+    mp_parse_tree_t pt = mp_parse(lex, MP_PARSE_FILE_INPUT);
+    mp_obj_t module_fun = mp_compile(&pt, lex->source_name, MP_EMIT_OPT_NONE, false);
+    nlr_pop();
+    return module_fun;
+  }
+  return MP_OBJ_NULL;
+}
+
+static bool __attribute__((noinline)) call(mp_obj_t function) {
+  nlr_buf_t nlr;
+  if (nlr_push(&nlr) == 0) {
+    mp_call_function_0(function);
+    nlr_pop();
+    return true;
+  }
+  return false;
+}
+
+mp_obj_t compile_python(const char * str) {
+  char stackTop;
+  mp_port_init_stack_top(&stackTop);
+  return compile(str);
+}
+
+bool call_python(mp_obj_t function) {
+  char stackTop;
+  mp_port_init_stack_top(&stackTop);
+  return call(function);
+}
+
+bool execute_python(const char * str) {
+  // Nothing is allocated between compiling and calling the function
+  mp_obj_t function = compile_python(str);
+  return function != MP_OBJ_NULL && call_python(function);
+}
+
+mp_int_t python_global_int(const char * name) {
+  return mp_obj_get_int(mp_load_global(qstr_from_str(name)));
+}
+
+mp_float_t python_global_float(const char * name) {
+  return mp_obj_get_float(mp_load_global(qstr_from_str(name)));
+}
@@ -0,0 +1,17 @@
+extern "C" {
+#include "py/runtime.h"
+}
+
+/* Sets up an interpreter with a fresh heap, which is torn down by
+ * deinit_python. The heap is 16KB unless given a size, of at most 32KB. */
+void init_python();
+void init_python(size_t heapSize);
+void deinit_python();
+bool execute_python(const char * str);
+/* compile_python returns MP_OBJ_NULL if str doesn't compile. The function it
+ * returns is only kept alive by the collector once stored in the interpreter,
+ * for instance as a global. */
+mp_obj_t compile_python(const char * str);
+bool call_python(mp_obj_t function);
+mp_int_t python_global_int(const char * name);
+mp_float_t python_global_float(const char * name);
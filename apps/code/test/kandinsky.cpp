@@ -0,0 +1,32 @@
+#include <quiz.h>
+#include <assert.h>
+#include "helper.h"
+
+QUIZ_CASE(code_kandinsky_batch_drawing) {
+  init_python();
+  assert(execute_python(
+    "from kandinsky import *\n"
+    "red = color(255, 0, 0)\n"
+    "fill_rect(10, 10, 30, 20, red)\n"
+    "fill_rect(-10, -10, 400, 400, 0)\n"
+    "draw_line(0, 0, 319, 239, red)\n"
+    "draw_line(5, 5, 5, 5, red)\n"
+    "draw_polyline(((0, 0), (10, 20), [30, 5]), red)\n"
+    "draw_polyline((), red)\n"
+    "from array import array\n"
+    "draw_polyline(array('h', [0, 0, 10, 20, 30, 5]), red)\n"
+    "draw_polyline(array('h'), red)\n"
+    "blit(array('H', [red] * 6), 0, 0, 3, 2)\n"
+    "draw_string('Hi', 0, 0)\n"
+    "draw_string('Hi', 0, 0, red)\n"
+    "draw_string('Hi', 0, 0, red, 0)\n"
+    "blit(b'\\x00\\xf8' * 6, 310, 230, 3, 2)\n"
+    "blit(b'\\x00\\xf8' * 6, 318, 238, 3, 2)\n"));
+  // Buffers must hold width*height 16-bit pixels
+  assert(!execute_python("blit(b'\\x00\\xf8' * 5, 0, 0, 3, 2)\n"));
+  assert(!execute_python("blit(12, 0, 0, 3, 2)\n"));
+  // Points are pairs of coordinates
+  assert(!execute_python("draw_polyline(((0, 0), (1, 2, 3)), 0)\n"));
+  assert(!execute_python("fill_rect(0, 0, 10, 10)\n"));
+  deinit_python();
+}
@@ -0,0 +1,56 @@
+#include <quiz.h>
+#include <assert.h>
+#include <math.h>
+#include "helper.h"
+
+static void assert_python_float_is(const char * name, mp_float_t value) {
+  mp_float_t result = python_global_float(name);
+  assert(fabsf(result - value) <= 1e-5f * (1.0f + fabsf(value)));
+}
+
+QUIZ_CASE(code_math_module) {
+  init_python();
+  assert(execute_python(
+    "import math\n"
+    "a = math.sqrt(2) ** 2\n"
+    "b = math.sin(math.pi / 6)\n"
+    "c = math.exp(1) - math.e\n"
+    "d = math.atan2(1, 1)\n"
+    "e = math.floor(-2.5)\n"
+    "f = math.trunc(-2.5)\n"
+    "g, h = math.frexp(12.0)\n"
+    "i, j = math.modf(3.25)\n"
+    "k = math.ldexp(0.75, 4)\n"
+    "l = math.isfinite(1.0) and not math.isfinite(math.exp(1000))\n"));
+  assert_python_float_is("a", 2.0f);
+  assert_python_float_is("b", 0.5f);
+  assert_python_float_is("c", 0.0f);
+  assert_python_float_is("d", (mp_float_t)M_PI/4);
+  assert(python_global_int("e") == -3);
+  assert(python_global_int("f") == -2);
+  assert_python_float_is("g", 0.75f);
+  assert(python_global_int("h") == 4);
+  assert_python_float_is("i", 0.25f);
+  assert_python_float_is("j", 3.0f);
+  assert_python_float_is("k", 12.0f);
+  assert(python_global_int("l") == 1);
+  assert(!execute_python("math.sqrt(-1)\n"));
+  deinit_python();
+}
+
+QUIZ_CASE(code_cmath_module) {
+  init_python();
+  assert(execute_python(
+    "import cmath\n"
+    "z = cmath.sqrt(-4)\n"
+    "a = z.real\n"
+    "b = z.imag\n"
+    "c = cmath.phase(complex(0, 1))\n"
+    "r, p = cmath.polar(cmath.rect(2, 0.5))\n"));
+  assert_python_float_is("a", 0.0f);
+  assert_python_float_is("b", 2.0f);
+  assert_python_float_is("c", (mp_float_t)M_PI/2);
+  assert_python_float_is("r", 2.0f);
+  assert_python_float_is("p", 0.5f);
+  deinit_python();
+}
@@ -0,0 +1,52 @@
+#include <quiz.h>
+#include <assert.h>
+#include "helper.h"
+
+/* Test cases are always declared, as quiz doesn't see the preprocessor, but
+ * they only check something on platforms with a native emitter. */
+
+#if MICROPY_EMIT_NATIVE
+static const char * sScript =
+  "import micropython\n"
+  "@micropython.native\n"
+  "def f(n):\n"
+  "  s = 0\n"
+  "  for i in range(n):\n"
+  "    s += i\n"
+  "  return s\n"
+  "@micropython.viper\n"
+  "def g(n: int) -> int:\n"
+  "  s = 0\n"
+  "  i = 0\n"
+  "  while i < n:\n"
+  "    s += i\n"
+  "    i += 1\n"
+  "  return s\n"
+  "a = f(100)\n"
+  "b = g(100)\n";
+#endif
+
+QUIZ_CASE(code_native_emitter) {
+#if MICROPY_EMIT_NATIVE
+  init_python();
+  assert(execute_python(sScript));
+  assert(python_global_int("a") == 4950);
+  assert(python_global_int("b") == 4950);
+  assert(!execute_python(
+    "@micropython.viper\n"
+    "def h(x: int) -> int:\n"
+    "  return x + None\n"));
+  deinit_python();
+#endif
+}
+
+QUIZ_CASE(code_native_code_memory_is_recycled) {
+#if MICROPY_EMIT_NATIVE
+  // Each run emits native code, which must not pile up across runs
+  for (int i = 0; i < 500; i++) {
+    init_python();
+    assert(execute_python(sScript));
+    deinit_python();
+  }
+#endif
+}
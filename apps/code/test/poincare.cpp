@@ -0,0 +1,29 @@
+#include <quiz.h>
+#include <assert.h>
+#include <math.h>
+#include "helper.h"
+
+QUIZ_CASE(code_poincare_evaluate) {
+  init_python();
+  assert(execute_python(
+    "import poincare\n"
+    "from array import array\n"
+    "a = poincare.evaluate('x^2+1', array('f', [0, 1, 2]))\n"
+    "n = len(a)\n"
+    "y = a[2]\n"
+    "d = poincare.evaluate('2*x', array('d', [1.5, 3]))\n"
+    "is_double = d == array('d', [3, 6])\n"
+    "l = poincare.evaluate('x*pi', range(5))\n"
+    "m = len(l)\n"
+    "z = l[4]\n"
+    "u = poincare.evaluate('x+A', [1])[0]\n"));
+  assert(python_global_int("n") == 3);
+  assert(python_global_float("y") == 5.0f);
+  assert(python_global_int("is_double") == 1);
+  assert(python_global_int("m") == 5);
+  assert(fabsf(python_global_float("z") - 4.0f*(float)M_PI) < 1e-5f);
+  assert(python_global_float("u") == 1.0f);
+  assert(!execute_python("poincare.evaluate('x+', [1])\n"));
+  assert(!execute_python("poincare.evaluate('x', [1, 'a'])\n"));
+  deinit_python();
+}
@@ -0,0 +1,60 @@
+#include <quiz.h>
+#include <assert.h>
+#include <string.h>
+#include "helper.h"
+
+extern "C" {
+#include "profiler.h"
+}
+
+static const mp_port_profiler_line_t * findLine(const char * function, uint16_t line) {
+  for (size_t i = 0; i < mp_port_profiler_number_of_lines(); i++) {
+    const mp_port_profiler_line_t * l = mp_port_profiler_line(i);
+    if (l->line == line && strcmp(l->function, function) == 0) {
+      return l;
+    }
+  }
+  return nullptr;
+}
+
+QUIZ_CASE(code_profiler_lines) {
+  init_python();
+  mp_port_profiler_start();
+  assert(execute_python(
+    "def f(n):\n"
+    "  s = 0\n"
+    "  for i in range(n):\n"
+    "    s += i\n"
+    "  return s\n"
+    "t = 0\n"
+    "for j in range(10):\n"
+    "  t += f(100)\n"));
+  mp_port_profiler_stop();
+  assert(!mp_port_profiler_is_running());
+  assert(python_global_int("t") == 49500);
+  assert(mp_port_profiler_dropped_bytecodes() == 0);
+
+  // The loop body in f is the busiest line, then the loop itself
+  const mp_port_profiler_line_t * body = findLine("f", 4);
+  const mp_port_profiler_line_t * loop = findLine("f", 3);
+  const mp_port_profiler_line_t * call = findLine("<module>", 8);
+  assert(body != nullptr && loop != nullptr && call != nullptr);
+  assert(body->bytecodes >= 1000);
+  assert(mp_port_profiler_line(0) == body);
+  assert(mp_port_profiler_line(1) == loop);
+  assert(call->bytecodes < loop->bytecodes);
+  // Lines come sorted by decreasing number of bytecodes
+  for (size_t i = 1; i < mp_port_profiler_number_of_lines(); i++) {
+    assert(mp_port_profiler_line(i)->bytecodes <= mp_port_profiler_line(i-1)->bytecodes);
+  }
+  deinit_python();
+}
+
+QUIZ_CASE(code_profiler_records_nothing_once_stopped) {
+  init_python();
+  mp_port_profiler_start();
+  mp_port_profiler_stop();
+  assert(execute_python("for i in range(100):\n  pass\n"));
+  assert(mp_port_profiler_number_of_lines() == 0);
+  deinit_python();
+}
@@ -0,0 +1,38 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "exam_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFBD46), P(0xFFD78E), P(0xFFF1D7), P(0xFFF1D8), P(0xFFD78E),
+  P(0xFFBD46), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB838), P(0xFFCD73),
+  P(0xFFE9C0), P(0xFFFEFB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFEFB), P(0xFFE9C0), P(0xFFCD73), P(0xFFB838), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFC458), P(0xFFDFA5), P(0xFFF9ED), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFF9ED), P(0xFFDFA5), P(0xFFC458),
+  P(0xFFB734), P(0xFFB93A), P(0xFFC65F), P(0xFFDFA5), P(0xFFF9ED), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFF9ED), P(0xFFDFA5), P(0xFFC55C),
+  P(0xFFB734), P(0xFFD68B), P(0xFFF5E2), P(0xFFCC6E), P(0xFFB838), P(0xFFCD73),
+  P(0xFFE9C0), P(0xFFFEFB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFEFB), P(0xFFE9C0), P(0xFFCE74), P(0xFFB838), P(0xFFB734), P(0xFFB734),
+  P(0xFFB836), P(0xFFF5E2), P(0xFFFFFF), P(0xFFEAC3), P(0xFFB734), P(0xFFECCA),
+  P(0xFFC761), P(0xFFBD46), P(0xFFD78E), P(0xFFF2DB), P(0xFFF2DB), P(0xFFD78E),
+  P(0xFFBD46), P(0xFFB837), P(0xFFDB99), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFCD73), P(0xFFFCF8), P(0xFFFDF9), P(0xFFC151), P(0xFFB734), P(0xFFE1AA),
+  P(0xFFFFFF), P(0xFFEED0), P(0xFFD281), P(0xFFC04D), P(0xFFB836), P(0xFFC151),
+  P(0xFFD790), P(0xFFF4E0), P(0xFFE1AB), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFBF4A), P(0xFFBF49), P(0xFFDD9F), P(0xFFB734), P(0xFFB734), P(0xFFB735),
+  P(0xFFDFA6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFE1AA), P(0xFFB735), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB939), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFC967), P(0xFFEAC5), P(0xFFFBF3), P(0xFFFBF4), P(0xFFECC8),
+  P(0xFFCB6D), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734)
+};
+
+constexpr Image image = Image(18, 9, pixels);
+
+const Image * ImageStore::ExamIcon = &image;
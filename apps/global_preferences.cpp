@@ -3,10 +3,10 @@
 static GlobalPreferences s_globalPreferences;
 
 GlobalPreferences::GlobalPreferences() :
-  m_language(I18n::Language::French),
   m_examMode(ExamMode::Desactivate),
-  m_showUpdatePopUp(true),
-  m_brightnessLevel(Ion::Backlight::MaxBrightness)
+  m_brightnessLevel(Ion::Backlight::MaxBrightness),
+  m_language(I18n::Language::French),
+  m_showUpdatePopUp(true)
 {
 }
 
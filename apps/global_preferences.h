@@ -21,10 +21,10 @@ public:
   void setBrightnessLevel(int brightnessLevel);
   constexpr static int NumberOfBrightnessStates = 5;
 private:
-  I18n::Language m_language;
   ExamMode m_examMode;
-  bool m_showUpdatePopUp;
   int m_brightnessLevel;
+  I18n::Language m_language;
+  bool m_showUpdatePopUp;
 };
 
 #endif
@@ -55,6 +55,16 @@ void App::Snapshot::tidy() {
   m_graphRange.setDelegate(nullptr);
 }
 
+void App::Snapshot::serializeModel(SnapshotWriter * writer) {
+  m_functionStore.serialize(writer);
+  m_graphRange.serialize(writer);
+}
+
+void App::Snapshot::deserializeModel(SnapshotReader * reader) {
+  m_functionStore.deserialize(reader);
+  m_graphRange.deserialize(reader);
+}
+
 App::App(Container * container, Snapshot * snapshot) :
   FunctionApp(container, snapshot, &m_inputViewController),
   m_xContext('x',((AppsContainer *)container)->globalContext()),
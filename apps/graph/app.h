@@ -29,6 +29,8 @@ public:
     Shared::InteractiveCurveViewRange * graphRange();
   private:
     void tidy() override;
+    void serializeModel(Shared::SnapshotWriter * writer) override;
+    void deserializeModel(Shared::SnapshotReader * reader) override;
     CartesianFunctionStore m_functionStore;
     Shared::InteractiveCurveViewRange m_graphRange;
   };
@@ -28,4 +28,14 @@ char CartesianFunction::symbol() const {
   return 'x';
 }
 
+void CartesianFunction::serialize(Shared::SnapshotWriter * writer) {
+  Shared::Function::serialize(writer);
+  writer->write(m_displayDerivative);
+}
+
+void CartesianFunction::deserialize(Shared::SnapshotReader * reader) {
+  Shared::Function::deserialize(reader);
+  m_displayDerivative = reader->read<bool>();
+}
+
 }
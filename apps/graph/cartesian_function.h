@@ -13,6 +13,8 @@ public:
   void setDisplayDerivative(bool display);
   double approximateDerivative(double x, Poincare::Context * context) const;
   char symbol() const override;
+  void serialize(Shared::SnapshotWriter * writer) override;
+  void deserialize(Shared::SnapshotReader * reader) override;
 private:
   bool m_displayDerivative;
 };
@@ -59,7 +59,7 @@ void CartesianFunctionStore::removeFunction(Shared::Function * f) {
   assert(i>=0 && i<m_numberOfFunctions);
   m_numberOfFunctions--;
   for (int j = i; j<m_numberOfFunctions; j++) {
-    m_functions[j] = m_functions[j+1];
+    m_functions[j].moveFrom(&m_functions[j+1]);
   }
   CartesianFunction emptyFunction("", KDColorBlack);
   m_functions[m_numberOfFunctions] = emptyFunction;
@@ -114,4 +114,18 @@ void CartesianFunctionStore::removeAll() {
   addEmptyFunction();
 }
 
+void CartesianFunctionStore::serialize(Shared::SnapshotWriter * writer) {
+  writer->write(m_numberOfFunctions);
+  for (int i = 0; i < k_maxNumberOfFunctions; i++) {
+    m_functions[i].serialize(writer);
+  }
+}
+
+void CartesianFunctionStore::deserialize(Shared::SnapshotReader * reader) {
+  m_numberOfFunctions = reader->read<int>();
+  for (int i = 0; i < k_maxNumberOfFunctions; i++) {
+    m_functions[i].deserialize(reader);
+  }
+}
+
 }
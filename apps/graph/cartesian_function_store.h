@@ -20,6 +20,8 @@ public:
   int maxNumberOfFunctions() override;
   char symbol() const override;
   void removeAll() override;
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
   static constexpr int k_maxNumberOfFunctions = 4;
 private:
   const char * firstAvailableName() override;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "graph_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF7F7F7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFAFAFA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x56565B), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF8F8F8), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F3EE),
+  P(0xF6F0E7), P(0xF6F0E5), P(0xF6F1EA), P(0xF5F3F0), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF6F0E5), P(0xF9E6C7), P(0xFBDAA3), P(0xFDD18A), P(0xFECD7E), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F4), P(0xF8EBD6), P(0xFBDAA5),
+  P(0xFECE80), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F1EA), P(0xFADFB4), P(0xFECE80), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF6F1E9), P(0xFBDBA7), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F4F1), P(0xFADFB2), P(0xFFCC7C), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xF0E4D1), P(0xFDCF84), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEB),
+  P(0xF6DBB0), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCA75), P(0xFFC665), P(0xFFC258), P(0xFFBE4D), P(0xFFBC43),
+  P(0xFFB93C), P(0xFFB837), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEDEAE5),
+  P(0xFBD392), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFC86D),
+  P(0xFFC156), P(0xFFBB41), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEEE8DF),
+  P(0xFDCF86), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCB78), P(0xFFC35D), P(0xFFBB41),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEEE8DD),
+  P(0xFDCE81), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCB79), P(0xFFC35C), P(0xFFB93A), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEEE8E0),
+  P(0xFECD80), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFC563), P(0xFFB93C), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEDEAE5),
+  P(0xFDCF85), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCA75), P(0xFFBE4B), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEB),
+  P(0xFBD290), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFC668), P(0xFFB93A), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xF6D9A8), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFC25A), P(0xFFB735), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xF1E4CE), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7A), P(0xFFBF4F), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xEDEBE8), P(0xFECC7D), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC79), P(0xFFBE4B), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xF8D59B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7A), P(0xFFBE4A), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xEFE6D8), P(0xFFCC7A), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFBE4D), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFCCF84), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFC155), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xF2E1C4), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFC562), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFDCD7D), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFC86D), P(0xFFB837), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xF1E3CA), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCB78), P(0xFFBA3E), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xFBCD80), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFBF4E), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xDED6CA), P(0xFFCB79),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFC564), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xF3CB88),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCA75), P(0xFFB93A), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9),
+  P(0xFECA74), P(0xFFCC7B), P(0xFFCC7B), P(0xFFBF4E), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xE6D2AF), P(0xFFCC7B), P(0xFFCC7B), P(0xFFC76A), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x414147), P(0xF6CA7E), P(0xFFCC7B), P(0xFFCC7A), P(0xFFBB41), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0x414147), P(0xFECA74), P(0xFFCC7B), P(0xFFC35C), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFCC7B), P(0xFFCA75), P(0xFFB838),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFCC7B), P(0xFFC051),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFC86C),
+  P(0xFFB735), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xFFBC44), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x434349), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x535358), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDBDBDB), P(0xDBDBDB),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD4D4D4), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD2D2D2), P(0xDBDBDB), P(0xDBDBDB), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xDBDBDB), P(0xFDFDFD), P(0xC9C9C9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xC7C7C7), P(0xFCFCFC), P(0xFFFFFF), P(0xDDDDDD), P(0xD5D5D5),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD2D2D2), P(0xDDDDDD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xC9C9C9), P(0xD5D5D5), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD3D3D3), P(0xC9C9C9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xC5C5C5), P(0xC4C4C4), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xC2C2C2), P(0xC4C4C4), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDEDEDE), P(0xABABAB),
+  P(0xC5C5C5), P(0xD8D8D8), P(0xDBDBDB), P(0xDADADA), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD8D8D8),
+  P(0xC5C5C5), P(0xABABAB), P(0xDEDEDE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFD), P(0xDBDBDB), P(0xBBBBBB), P(0xA7A7A7), P(0x9C9C9C), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9C9C9C), P(0xA7A7A7),
+  P(0xBBBBBB), P(0xDBDBDB), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::GraphIcon = &image;
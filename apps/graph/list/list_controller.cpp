@@ -52,7 +52,9 @@ void ListController::editExpression(Function * function, Ion::Events::Event even
     Shared::Function * myFunction = (Shared::Function *)context;
     InputViewController * myInputViewController = (InputViewController *)sender;
     const char * textBody = myInputViewController->textBody();
-    myFunction->setContent(textBody);
+    if (!myFunction->setContent(textBody)) {
+      myInputViewController->refuseText(I18n::Message::NotEnoughMemory);
+    }
     },
     [](void * context, void * sender){
     });
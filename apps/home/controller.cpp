@@ -48,7 +48,14 @@ Controller::Controller(Responder * parentResponder, ::AppsContainer * container,
 
 bool Controller::handleEvent(Ion::Events::Event event) {
   if (event == Ion::Events::OK || event == Ion::Events::EXE) {
-    m_container->switchTo(m_container->appSnapshotAtIndex(m_selectionDataSource->selectedRow()*k_numberOfColumns+m_selectionDataSource->selectedColumn()+1));
+    ::App::Snapshot * selectedSnapshot = m_container->appSnapshotAtIndex(m_selectionDataSource->selectedRow()*k_numberOfColumns+m_selectionDataSource->selectedColumn()+1);
+    /* The snapshot is null if there was no memory left to compact the one it
+     * shares its room with. */
+    if (selectedSnapshot == nullptr) {
+      app()->displayWarning(I18n::Message::NotEnoughMemory);
+      return true;
+    }
+    m_container->switchTo(selectedSnapshot);
     return true;
   }
   return false;
@@ -101,7 +108,7 @@ void Controller::willDisplayCellAtLocation(HighlightCell * cell, int i, int j) {
     appCell->setVisible(false);
   } else {
     appCell->setVisible(true);
-    ::App::Descriptor * descriptor = m_container->appSnapshotAtIndex((j*k_numberOfColumns+i)+1)->descriptor();
+    ::App::Descriptor * descriptor = m_container->appDescriptorAtIndex(appIndex);
     appCell->setAppDescriptor(descriptor);
   }
 }
@@ -25,7 +25,7 @@ constexpr static char deviationSpanishDefinition[] = {Ion::Charset::SmallSigma,
 constexpr static char deviationGermanDefinition[] = {Ion::Charset::SmallSigma, ' ', ':', ' ', 'S', 't', 'a', 'n', 'd', 'a', 'r', 'd', 'a', 'b', 'w', 'e', 'i', 'c', 'h', 'u', 'n', 'g', 0};
 constexpr static char deviationPortugueseDefinition[] = {Ion::Charset::SmallSigma, ' ', ':', ' ', 'D', 'e','s','v','i','o',' ','p','a','d','r','a','o', 0};
 
-const char * messages[242][5] {
+const char * const messages[243][5] {
   {"Warning", "Attention", "Cuidado", "Achtung", "Atencao"},
   {"Confirm", "Valider", "Confirmar", "Bestatigen", "Confirmar"},
   {"Cancel", "Annuler", "Cancelar", "Abbrechen", "Cancelar"},
@@ -33,6 +33,7 @@ const char * messages[242][5] {
   {"Syntax error", "Attention a la syntaxe", "Error sintactico", "Syntaxfehler", "Erro de sintaxe"},
   {"Math error", "Erreur mathematique", "Error matematico", "Mathematischen Fehler", "Erro matematico"},
   {"Low battery", "Batterie faible", "Bateria baja", "Batterie leer", "Bateria fraca"},
+  {"Not enough memory", "Memoire insuffisante", "Memoria insuficiente", "Nicht genug Speicher", "Memoria insuficiente"},
 
   /* Variables */
   {"Variables", "Variables", "Variables", "Variablen", "Variaveis"},
@@ -321,7 +322,7 @@ constexpr static char leftIntegralFirstLegend[] = {'P', '(', 'X', Ion::Charset::
 constexpr static char finiteIntegralLegend[] = {Ion::Charset::LessEqual, 'X', Ion::Charset::LessEqual, 0};
 
 
-const char * universalMessages[242] {
+const char * const universalMessages[242] {
   "",
   "Python",
   "PYTHON (BETA)",
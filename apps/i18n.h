@@ -13,6 +13,7 @@ namespace I18n {
     SyntaxError,
     MathError,
     LowBattery,
+    NotEnoughMemory,
 
     /* Variables */
     Variables,
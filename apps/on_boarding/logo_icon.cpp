@@ -0,0 +1,669 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "logo_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0x7D7D7E), P(0x080809), P(0x353536), P(0xE6E6E6), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x4F4F50), P(0x070708), P(0x6E6E6F),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x6D6D6E),
+  P(0x070708), P(0x4E4E4F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x4E4E4F), P(0x070708), P(0x6D6D6E), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xA6A6A7), P(0x181819), P(0x0C0C0D),
+  P(0x818182), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x777778), P(0x0A0A0B),
+  P(0x181819), P(0xA6A6A7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x717172), P(0x09090A), P(0x3A3A3B), P(0xF0F0F0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x898989), P(0x101011), P(0x101011), P(0x888888),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF0F0F0), P(0x3A3A3B),
+  P(0x09090A), P(0x717172), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C1), P(0x6A6A6B),
+  P(0x2C2C2D), P(0x080809), P(0x040405), P(0x080809), P(0x2C2C2D), P(0x6A6A6B),
+  P(0xC1C1C1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xB8B8B8),
+  P(0x232324), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x111112), P(0x414142), P(0x8E8E8E),
+  P(0xEFEFEF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x676768), P(0x080809), P(0x535353),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDFDFDF), P(0x2E2E2F),
+  P(0x141415), P(0xC8C8C8), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF2F2F2), P(0x939393), P(0x454546), P(0x161617), P(0x040405),
+  P(0x040405), P(0x212121), P(0x585858), P(0xB2B2B3), P(0xFDFDFD), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x070708), P(0x040405), P(0x040405), P(0x3B3B3C),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x050506), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x050506), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x050506), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x121213),
+  P(0x040405), P(0x040405), P(0x040405), P(0xC1C1C1), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBBBBBB),
+  P(0x040405), P(0x040405), P(0x040405), P(0x121213), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x080809), P(0x040405), P(0x040405), P(0x949494),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD3D3D3), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xD2D2D2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x949494), P(0x040405), P(0x040405), P(0x080809), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD1D1D1), P(0x3D3D3E),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x3D3D3E), P(0xD1D1D1), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x161617), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x161617), P(0xA9A9AA), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCFCFCF),
+  P(0x1C1C1D), P(0x040405), P(0x040405), P(0x7A7A7B), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C1), P(0x1E1E1E), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x39393A), P(0xDDDDDD), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x6B6B6C), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x373738),
+  P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFD), P(0x313132), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x3F3F40), P(0x040405),
+  P(0x040405), P(0x3D3D3E), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x737374),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x727273), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x3F3F40), P(0x040405), P(0x040405), P(0x3F3F40),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xA1A1A2),
+  P(0x0A0A0B), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x0A0A0B), P(0xA1A1A2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0x0E0E0F), P(0x232323), P(0x232323), P(0x232323), P(0x232323), P(0x232323),
+  P(0x232323), P(0x0C0C0D), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x9B9B9B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xBCBCBC), P(0x121213), P(0x040405), P(0x040405), P(0x1F1F1F), P(0xE0E0E0),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCACACA), P(0x0D0D0E), P(0x040405),
+  P(0x040405), P(0x040405), P(0x0E0E0F), P(0x2D2D2E), P(0x212121), P(0x080809),
+  P(0x040405), P(0x040405), P(0x040405), P(0x181819), P(0xD7D7D7), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x9E9E9E),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xA9A9AA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xA2A2A3), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x999999), P(0x040405), P(0x040405), P(0x040405), P(0xE1E1E2), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFBFBFB), P(0x1A1A1B), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x1A1A1B), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE1E1E2), P(0x040405), P(0x040405),
+  P(0x040405), P(0x999999), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xA1A1A2), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x353536),
+  P(0x8F8F8F), P(0xC6C6C6), P(0xD8D8D8), P(0xC6C6C6), P(0x8F8F8F), P(0x353536),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0xA1A1A2), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFBFBFB), P(0xB5B5B5), P(0x262627),
+  P(0x040405), P(0x040405), P(0x0A0A0B), P(0xD3D3D3), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xA7A7A8), P(0x09090A), P(0x040405), P(0x040405), P(0x262627),
+  P(0xE2E2E3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x363637),
+  P(0x040405), P(0x040405), P(0x1F1F1F), P(0xB0B0B1), P(0xFCFCFC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xEFEFEF), P(0x969696), P(0x141415), P(0x040405), P(0x040405),
+  P(0x2D2D2E), P(0xFAFAFA), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x0B0B0C), P(0xCBCBCB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x252526), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF6F6F6), P(0x212121), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xEAEAEA), P(0x080809), P(0x040405), P(0x040405),
+  P(0x8B8B8B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xB4B4B4), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0xB2B2B3), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x8E8E8E),
+  P(0x040405), P(0x040405), P(0x080809), P(0xEAEAEA), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xD1D1D1), P(0x0A0A0B), P(0x040405), P(0x040405), P(0x0F0F10),
+  P(0xA5A5A6), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xA5A5A6), P(0x0F0F10), P(0x040405), P(0x040405),
+  P(0x0A0A0B), P(0xD1D1D1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xEAEAEA), P(0x212121), P(0x040405), P(0x040405), P(0x606060),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x909090), P(0x040405), P(0x040405), P(0x040405),
+  P(0x2F2F30), P(0xE9E9E9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xD9D9D9), P(0x040405), P(0x040405), P(0x060607), P(0xD7D7D7), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD3D3D3),
+  P(0x101011), P(0x040405), P(0x040405), P(0xDADADA), P(0x040405), P(0x040405),
+  P(0x040405), P(0x101011), P(0x040405), P(0x040405), P(0x202020), P(0xE8E8E8),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x919191), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x8B8B8B),
+  P(0x040405), P(0x040405), P(0x050506), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x4A4A4B),
+  P(0x040405), P(0x040405), P(0x353536), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x565656), P(0x040405),
+  P(0x040405), P(0x3A3A3B), P(0x424243), P(0x040405), P(0x040405), P(0x545454),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x363637), P(0x040405), P(0x040405), P(0x4A4A4B), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x3D3D3E), P(0x040405), P(0x040405),
+  P(0x0F0F10), P(0xCFCFCF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCFCFCF),
+  P(0x0F0F10), P(0x040405), P(0x040405), P(0x3D3D3E), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x949494), P(0x040405),
+  P(0x040405), P(0x1E1E1E), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0x737374), P(0x040405), P(0x040405),
+  P(0x040405), P(0x39393A), P(0xF0F0F0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xB6B6B6), P(0x040405), P(0x040405), P(0x2F2F30),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xB7B7B7), P(0x39393A), P(0x777778), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xA4A4A5), P(0x0F0F10), P(0x040405),
+  P(0x040405), P(0x424243), P(0xFBFBFB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0x555555), P(0x040405), P(0x040405), P(0x171718), P(0xEFEFEF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xECECEC), P(0x131314), P(0x040405), P(0x040405), P(0x626263), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xA3A3A4), P(0x040405), P(0x040405), P(0x040405), P(0xD8D8D8),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xEEEEEE),
+  P(0x0A0A0B), P(0x040405), P(0x040405), P(0x999999), P(0xA0A0A0), P(0x040405),
+  P(0x040405), P(0x09090A), P(0xEBEBEB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xDDDDDD), P(0x040405), P(0x040405), P(0x040405),
+  P(0xA3A3A4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C1), P(0x040405),
+  P(0x040405), P(0x040405), P(0xA5A5A6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xA5A5A6), P(0x040405), P(0x040405), P(0x040405),
+  P(0xC1C1C1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xBFBFBF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0x5C5C5C), P(0x040405),
+  P(0x040405), P(0x040405), P(0x454546), P(0xF5F5F5), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC2C2C2), P(0x040405),
+  P(0x040405), P(0x181819), P(0xF7F7F7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xD0D0D0),
+  P(0xA9A9AA), P(0x040405), P(0x040405), P(0x040405), P(0x717172), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xC4C4C4), P(0x1B1B1C), P(0x040405), P(0x040405),
+  P(0x7A7A7B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x737374), P(0x040405), P(0x040405), P(0x272728),
+  P(0xCACACA), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF1F1F1), P(0x0C0C0D), P(0x040405),
+  P(0x040405), P(0x838383), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x979797), P(0x040405), P(0x040405), P(0x0B0B0C), P(0xEFEFEF),
+  P(0xF2F2F2), P(0x0E0E0F), P(0x040405), P(0x040405), P(0x939393), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x858585), P(0x040405),
+  P(0x040405), P(0x0C0C0D), P(0xF1F1F1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x6A6A6B), P(0x040405), P(0x040405), P(0x353536), P(0xFEFEFE), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0x353536),
+  P(0x040405), P(0x040405), P(0x6A6A6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x949494), P(0x040405), P(0x040405), P(0x181819),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xF1F1F1), P(0x474748),
+  P(0x040405), P(0x040405), P(0x040405), P(0x525252), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF1F1F1), P(0x101011), P(0x040405), P(0x040405), P(0x484849), P(0xDADADA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0x757576), P(0x040405), P(0x040405),
+  P(0x040405), P(0xA4A4A5), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xD0D0D0), P(0x969696),
+  P(0x040405), P(0x040405), P(0x0C0C0D), P(0xE3E3E4), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDEDEDE), P(0x09090A), P(0x040405),
+  P(0x040405), P(0xADADAE), P(0xD0D0D0), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x565656), P(0x040405), P(0x040405), P(0x2A2A2B), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x383839), P(0x040405), P(0x040405),
+  P(0x5A5A5A), P(0xFFFFFF), P(0xFFFFFF), P(0x606060), P(0x040405), P(0x040405),
+  P(0x343435), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x2F2F30), P(0x040405), P(0x040405), P(0x565656), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x2C2C2D), P(0x040405), P(0x040405), P(0x8F8F8F),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x8F8F8F), P(0x040405), P(0x040405), P(0x2C2C2D), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xEAEAEA), P(0x202020), P(0x040405),
+  P(0x040405), P(0x5B5B5B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xE7E7E7),
+  P(0x333334), P(0x040405), P(0x040405), P(0x040405), P(0x424243), P(0xFCFCFC),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x868686), P(0x040405), P(0x040405),
+  P(0x040405), P(0x050506), P(0x4D4D4E), P(0x9F9F9F), P(0xECECEC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0x454546), P(0x040405), P(0x040405), P(0x0D0D0E), P(0xD0D0D0), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x262627), P(0x040405), P(0x040405), P(0x626262),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5B5B5B),
+  P(0x040405), P(0x040405), P(0x3E3E3F), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xADADAE), P(0x040405), P(0x040405), P(0x040405),
+  P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD7D7D7), P(0x040405),
+  P(0x040405), P(0x040405), P(0xB8B8B8), P(0xFFFFFF), P(0xFFFFFF), P(0xBEBEBE),
+  P(0x040405), P(0x040405), P(0x040405), P(0xD2D2D2), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xD4D4D4), P(0x040405), P(0x040405), P(0x040405), P(0xADADAE),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x080809), P(0x040405),
+  P(0x040405), P(0xC6C6C6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC6C6C6), P(0x040405), P(0x040405),
+  P(0x080809), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xAEAEAF), P(0x242425),
+  P(0x040405), P(0x040405), P(0x060607), P(0xCFCFCF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xAAAAAB), P(0x242425), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x0D0D0E), P(0xD7D7D7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE),
+  P(0x878787), P(0x080809), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x060607), P(0x444445), P(0x949494), P(0xE7E7E7), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xEBEBEB), P(0x222222), P(0x040405), P(0x040405),
+  P(0x232323), P(0xECECEC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xA8A8A9), P(0x040405),
+  P(0x040405), P(0x050506), P(0xD2D2D2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xCCCCCC), P(0x040405), P(0x040405), P(0x040405), P(0xC9C9C9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF7F7F7), P(0x121213),
+  P(0x040405), P(0x040405), P(0x79797A), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x79797A), P(0x040405), P(0x040405), P(0x1E1E1E), P(0xFCFCFC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFDFDFD), P(0x212121), P(0x040405), P(0x040405), P(0x747475),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x7E7E7F), P(0x040405), P(0x040405),
+  P(0x121213), P(0xF7F7F7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xD8D8D8), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD8D8D8),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0x1D1D1E), P(0x232323),
+  P(0x232323), P(0x232323), P(0x232323), P(0x232323), P(0x202020), P(0x0A0A0B),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x8F8F8F), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0x09090A), P(0x040405), P(0x040405), P(0x040405),
+  P(0x0A0A0B), P(0x040405), P(0x040405), P(0x333334), P(0xF8F8F8), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDBDBDB), P(0x676768), P(0x0F0F10),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x080809),
+  P(0x5C5C5C), P(0xDDDDDD), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCDCDCD),
+  P(0x0B0B0C), P(0x040405), P(0x040405), P(0x484849), P(0xFCFCFC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0x353536), P(0x040405), P(0x040405), P(0x4B4B4C), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x434344), P(0x040405), P(0x040405), P(0x5A5A5A),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x626262), P(0x040405), P(0x040405), P(0x232323), P(0xFEFEFE),
+  P(0xFFFFFF), P(0xFCFCFC), P(0x1E1E1E), P(0x040405), P(0x040405), P(0x79797A),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x7D7D7E), P(0x040405),
+  P(0x040405), P(0x1B1B1C), P(0xFBFBFB), P(0xFFFFFF), P(0xFFFFFF), P(0x262627),
+  P(0x040405), P(0x040405), P(0x616161), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x080809), P(0x040405), P(0x040405), P(0xC6C6C6),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xC6C6C6), P(0x040405), P(0x040405), P(0x080809), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x111112), P(0xA1A1A1),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x818182), P(0xC1C1C1), P(0x060607), P(0x040405), P(0x040405),
+  P(0x757576), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF7F7F7), P(0xB4B4B4), P(0x656566), P(0x19191A), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x0D0D0E), P(0xA3A3A4), P(0xFFFFFF),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xA1A1A1), P(0x040405), P(0x040405), P(0x040405),
+  P(0x777778), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBBBBBB), P(0x040405), P(0x040405),
+  P(0x040405), P(0xBDBDBD), P(0xFFFFFF), P(0xB4B4B4), P(0x040405), P(0x040405),
+  P(0x09090A), P(0xDEDEDE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xB8B8B8), P(0x040405), P(0x040405),
+  P(0x040405), P(0xC8C8C8), P(0xFFFFFF), P(0xBABABA), P(0x040405), P(0x040405),
+  P(0x040405), P(0xD8D8D8), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xDBDBDB), P(0x040405), P(0x040405), P(0x040405), P(0xB4B4B4), P(0xFFFFFF),
+  P(0xCDCDCD), P(0x040405), P(0x040405), P(0x040405), P(0xB8B8B8), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x2C2C2D), P(0x040405),
+  P(0x040405), P(0x8F8F8F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x8F8F8F), P(0x040405), P(0x040405),
+  P(0x2C2C2D), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x363637),
+  P(0xEBEBEB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x09090A), P(0xA4A4A5), P(0xFFFFFF), P(0xFFFFFF), P(0x818182),
+  P(0x040405), P(0x040405), P(0x040405), P(0xBBBBBB), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xC3C3C3), P(0x69696A), P(0x0C0C0D), P(0x040405), P(0x040405),
+  P(0x050506), P(0xBCBCBC), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x6D6D6E),
+  P(0x040405), P(0x040405), P(0x040405), P(0xACACAD), P(0xD0D0D0), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x0F0F10), P(0x040405), P(0x040405), P(0xBCBCBC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBCBCBC), P(0x040405), P(0x040405),
+  P(0x0F0F10), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x464647), P(0x040405), P(0x040405), P(0x343435), P(0xFAFAFA), P(0x2E2E2F),
+  P(0x040405), P(0x040405), P(0x747475), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0x19191A), P(0x040405), P(0x040405), P(0x6E6E6F), P(0xFFFFFF), P(0x5C5C5C),
+  P(0x040405), P(0x040405), P(0x3A3A3B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x3D3D3E), P(0x040405), P(0x040405),
+  P(0x565656), P(0xFFFFFF), P(0x767677), P(0x040405), P(0x040405), P(0x19191A),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x6A6A6B), P(0x040405), P(0x040405), P(0x353536), P(0xFEFEFE), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0x353536),
+  P(0x040405), P(0x040405), P(0x6A6A6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x717172), P(0x040405),
+  P(0x040405), P(0x060607), P(0xC7C7C7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0x161617), P(0xC3C3C3), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFCFCFC), P(0x3F3F40), P(0x040405), P(0x040405), P(0x1D1D1E),
+  P(0xEBEBEB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE3E3E4),
+  P(0x343435), P(0x040405), P(0x040405), P(0x3F3F40), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0x3E3E3F), P(0x040405), P(0x040405), P(0x0F0F10),
+  P(0xA4A4A5), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x343435), P(0x040405), P(0x040405),
+  P(0x7E7E7F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x7E7E7F),
+  P(0x040405), P(0x040405), P(0x343435), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xCDCDCD), P(0x040405), P(0x040405), P(0x040405),
+  P(0x4C4C4D), P(0x040405), P(0x040405), P(0x151516), P(0xEEEEEE), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x6C6C6D), P(0x040405), P(0x040405), P(0x1D1D1E),
+  P(0xEDEDED), P(0x0C0C0D), P(0x040405), P(0x040405), P(0x999999), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x9B9B9B),
+  P(0x040405), P(0x040405), P(0x0A0A0B), P(0xEBEBEB), P(0x212121), P(0x040405),
+  P(0x040405), P(0x6C6C6D), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C1), P(0x040405), P(0x040405), P(0x040405),
+  P(0xA5A5A6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xA5A5A6), P(0x040405), P(0x040405), P(0x040405), P(0xC1C1C1), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF5F5F5), P(0x272728), P(0x040405), P(0x040405), P(0x272728), P(0xF5F5F5),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xC9C9C9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE2E2E3), P(0x151516),
+  P(0x040405), P(0x040405), P(0x515151), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF1F1F1), P(0xB8B8B8), P(0xEFEFEF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xCCCCCC), P(0x040405), P(0x040405), P(0x070708),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE7E7E7), P(0x1C1C1D),
+  P(0x040405), P(0x040405), P(0x101011), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x7E7E7F),
+  P(0x040405), P(0x040405), P(0x19191A), P(0xEEEEEE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xEEEEEE), P(0x181819), P(0x040405), P(0x040405), P(0x7F7F80), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x585858),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x909090),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC4C4C4), P(0x040405),
+  P(0x040405), P(0x040405), P(0x5B5B5B), P(0x040405), P(0x040405), P(0x0B0B0C),
+  P(0xEFEFEF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF0F0F0), P(0x0C0C0D), P(0x040405), P(0x040405), P(0x5B5B5B),
+  P(0x040405), P(0x040405), P(0x040405), P(0xC4C4C4), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x3D3D3E),
+  P(0x040405), P(0x040405), P(0x0F0F10), P(0xCFCFCF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xCFCFCF), P(0x0F0F10), P(0x040405), P(0x040405), P(0x3D3D3E),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC5C5C5), P(0x060607), P(0x040405),
+  P(0x040405), P(0x6E6E6F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xB0B0B1), P(0x040405), P(0x040405), P(0x040405), P(0x999999),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x2F2F30), P(0x040405),
+  P(0x2D2D2E), P(0xF7F7F7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE0E0E1), P(0x040405),
+  P(0x040405), P(0x080809), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xC7C7C7), P(0x09090A), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xE1E1E2), P(0x0A0A0B), P(0x040405), P(0x040405), P(0x4A4A4B),
+  P(0xF5F5F5), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF5F5F5), P(0x49494A), P(0x040405), P(0x040405), P(0x0B0B0C),
+  P(0xE1E1E2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xDCDCDC), P(0x080809), P(0x040405), P(0x040405), P(0x040405),
+  P(0x252526), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0x212121), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x5A5A5A), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5C5C5C), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x212121), P(0xFEFEFE),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xD1D1D1), P(0x0A0A0B), P(0x040405), P(0x040405), P(0x0F0F10),
+  P(0xA5A5A6), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xA5A5A6), P(0x0F0F10), P(0x040405), P(0x040405),
+  P(0x0A0A0B), P(0xD1D1D1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x767677), P(0x040405), P(0x040405), P(0x040405), P(0xBFBFBF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x6B6B6C), P(0x040405),
+  P(0x040405), P(0x0C0C0D), P(0xD6D6D6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x151516), P(0x040405), P(0x040405), P(0x656566), P(0xFCFCFC), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x838383), P(0x040405), P(0x040405), P(0x2D2D2E), P(0x040405), P(0x040405),
+  P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x979797), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x8B8B8B), P(0x040405),
+  P(0x040405), P(0x040405), P(0x2B2B2C), P(0xA8A8A9), P(0xF2F2F2), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF1F1F1), P(0xA6A6A7), P(0x29292A), P(0x040405), P(0x040405),
+  P(0x040405), P(0x8B8B8B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x777778), P(0x040405),
+  P(0x040405), P(0x040405), P(0xB4B4B4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x787879), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0xB8B8B8), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xB9B9B9), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x787879), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xA1A1A2), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x353536), P(0x8F8F8F), P(0xC6C6C6),
+  P(0xD8D8D8), P(0xC6C6C6), P(0x8F8F8F), P(0x353536), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xA1A1A2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF7F7F7), P(0x2A2A2B), P(0x040405), P(0x040405),
+  P(0x212121), P(0xF1F1F1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF7F7F7), P(0x2F2F30), P(0x040405), P(0x040405), P(0x313132), P(0xF8F8F8),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x959595), P(0x040405), P(0x040405), P(0x040405),
+  P(0x3E3E3F), P(0xB7B7B7), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xE1E1E2), P(0x767677), P(0x050506), P(0x040405), P(0x040405), P(0x8C8C8C),
+  P(0x040405), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x636364), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0x6C6C6D), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x060607), P(0x1B1B1C), P(0x1A1A1B), P(0x050506), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x6D6D6E), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0xB2B2B3), P(0x8B8B8B), P(0xCDCDCD), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCFCFCF),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x1E1E1E), P(0xFCFCFC),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC), P(0x1E1E1E), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0xCFCFCF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xA1A1A2), P(0x0A0A0B), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x0A0A0B), P(0xA1A1A2), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC8C8C8),
+  P(0x060607), P(0x040405), P(0x040405), P(0x666667), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x040405), P(0x040405), P(0x040405),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD6D6D6), P(0x0D0D0E), P(0x040405),
+  P(0x040405), P(0x727273), P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0x676768),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x09090A), P(0x272728),
+  P(0x313132), P(0x1B1B1C), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x3B3B3C), P(0xFAFAFA), P(0x050506), P(0x040405), P(0x040405), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF7F7F7), P(0x373738), P(0x040405),
+  P(0x040405), P(0x050506), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x9C9C9C), P(0x171718),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x181819), P(0x9D9D9D), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x050506),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x040405), P(0x040405), P(0x050506), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x2D2D2E), P(0x040405), P(0x040405), P(0x040405),
+  P(0x7B7B7C), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x7B7B7C),
+  P(0x040405), P(0x040405), P(0x040405), P(0x2D2D2E), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD1D1D1), P(0x3D3D3E),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x3D3D3E), P(0xD1D1D1), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x050506), P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x7B7B7C), P(0x040405), P(0x040405), P(0x060607),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x060607),
+  P(0x040405), P(0x040405), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x9B9B9B), P(0x040405), P(0x040405), P(0x060607), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x979797), P(0x131314), P(0x040405), P(0x040405),
+  P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405), P(0x040405),
+  P(0x040405), P(0x5A5A5A), P(0xF0F0F0), P(0xFFFFFF), P(0x6E6E6F), P(0x070708),
+  P(0x4F4F50), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xE1E1E2), P(0x2D2D2E), P(0x060607), P(0x6E6E6F), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF3F3F3), P(0x969696), P(0x4F4F50), P(0x1C1C1D), P(0x070708),
+  P(0x070708), P(0x1D1D1E), P(0x505050), P(0x9A9A9A), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x6E6E6F), P(0x070708), P(0x4C4C4D), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x4C4C4D), P(0x070708), P(0x6E6E6F),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC8C8C8), P(0x272728),
+  P(0x060607), P(0x4C4C4D), P(0xEEEEEE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xEFEFEF), P(0x4C4C4D), P(0x060607), P(0x262627), P(0xC8C8C8),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C1), P(0x6A6A6B), P(0x2C2C2D), P(0x080809),
+  P(0x040405), P(0x080809), P(0x2C2C2D), P(0x6A6A6B), P(0xC1C1C1), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x6E6E6F), P(0x060607), P(0x49494A),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF8F8F8), P(0x464647),
+  P(0x040405), P(0x6A6A6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x838383), P(0x232323), P(0x747475), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x666667), P(0x050506), P(0x636364),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF1F1F1),
+  P(0x979797), P(0x4D4D4E), P(0x1F1F1F), P(0x050506), P(0x040405), P(0x0E0E0F),
+  P(0x323233), P(0x6D6D6E), P(0xCCCCCC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(188, 21, pixels);
+
+const Image * ImageStore::LogoIcon = &image;
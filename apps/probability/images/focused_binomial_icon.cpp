@@ -0,0 +1,122 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_binomial_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0),
+  P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819),
+  P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0), P(0xFFB819), P(0xD4D7E0)
+};
+
+constexpr Image image = Image(35, 19, pixels);
+
+const Image * ImageStore::FocusedBinomialIcon = &image;
@@ -0,0 +1,161 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_calcul3_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xE5CB92), P(0xFABC31), P(0xFBBB2A), P(0xE9C87E), P(0xD5D7DE), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xE6CA8E), P(0xF8BD3B), P(0xDBD2BE), P(0xF9BC36),
+  P(0xF5BF46), P(0xF0C360), P(0xD4D7DF), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xDCD1BB), P(0xFBBB2C),
+  P(0xD9D3C9), P(0xD4D7E0), P(0xFFB819), P(0xFCBA29), P(0xF7BD3D), P(0xE7C986),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xF5BF49), P(0xE5CB92), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xF6BE42), P(0xFCBA27), P(0xDAD3C5), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xE0CEA7), P(0xF8BD37), P(0xD4D7DE),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xF2C155),
+  P(0xF1C25B), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xF5C049), P(0xE4CB95), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFCBA25), P(0xFBBB2B), P(0xDDD1B8), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xDCD1B9), P(0xFABC30), P(0xD5D7DD), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFAB822), P(0xF1C259), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xEEC465),
+  P(0xDAD3C6), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFEB91F), P(0xFBBB28), P(0xDAD3C4),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD7D5D2), P(0xFCBA27), P(0xD7D5D4), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xF7BE40), P(0xECC56F), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xE7C987), P(0xEFC362),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFEB91C), P(0xFCBA27),
+  P(0xD6D6D7), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7DF), P(0xF9BC36), P(0xDCD1BA), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFABC31), P(0xE6CA8B), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xE0CEA9), P(0xF4C04B), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB81A),
+  P(0xF9BC32), P(0xD4D7DF), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xF3C150), P(0xE1CDA2), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFDB922), P(0xE0CEA9), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xDDD1B8), P(0xF9BC36), P(0xD4D7DE), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xF8BD39), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xF4C04A),
+  P(0xE5CA90), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xE8C982),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xE8C984), P(0xF6BF44), P(0xD5D7DE), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB81A), P(0xE2CD9E), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xDDD0B6), P(0xF4C04D), P(0xF8BD3B), P(0xD9D4CA),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB81B), P(0xE3CD9D), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xDED0B2), P(0xF2C257), P(0xFBBB2B),
+  P(0xE6CA8D), P(0xD5D6DB), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB81A), P(0xE9C87F),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD5D6DB), P(0xE9C87E), P(0xF7BE3D),
+  P(0xF8BD39), P(0xE7CA8A), P(0xD6D6D8), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xFFB819),
+  P(0xFFB819), P(0xFFB819), P(0xFFB819), P(0xF8BD38), P(0xE5CA90), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD6D6D9), P(0xD6D5D6), P(0xD4D7DF), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7DF),
+  P(0xD4D7DE), P(0xD4D7DE), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0)
+};
+
+constexpr Image image = Image(39, 23, pixels);
+
+const Image * ImageStore::FocusedCalcul3Icon = &image;
@@ -0,0 +1,122 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "focused_normal_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD5D7DD), P(0xE9C474), P(0xFCB311), P(0xFBB414),
+  P(0xE6C785), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7DF), P(0xEFBE51), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xE7C67E), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xE7C67C),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFEB104),
+  P(0xDCD0B8), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xDAD2C2), P(0xFEB107), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xF3BB3D),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xF1BD4A), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xE0CCA1),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xDCD0B8), P(0xFFB001), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xF5B936), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xF1BD48),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xDDCFB1), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xDAD1C0), P(0xFFB002), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xEFBF53), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xEDC160), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFDB108), P(0xD7D4CF), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD6D5D4), P(0xFDB20B), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xE7C67C), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xE6C680),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xF9B620), P(0xD4D7DE), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7DF), P(0xF8B624), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xE0CCA2), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xE0CCA2), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xF3BB3E), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xF3BB3E), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB001),
+  P(0xDCD0B7), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xDCD0B7),
+  P(0xFFB001), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xF3BB3D),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xF3BB3D), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xE8C577),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xEAC36C), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xF4BA3B),
+  P(0xDFCDA6), P(0xD4D7DF), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD4D7E0), P(0xD5D6D9), P(0xE1CB9B),
+  P(0xF5B936), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xF8B623), P(0xE9C470), P(0xDCD0B5), P(0xD4D7DF), P(0xD4D7E0), P(0xD4D7E0),
+  P(0xE0CC9F), P(0xEAC36D), P(0xF3BB3E), P(0xFDB20B), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFBB414), P(0xF2BB42), P(0xEAC36F)
+};
+
+constexpr Image image = Image(35, 19, pixels);
+
+const Image * ImageStore::FocusedNormalIcon = &image;
@@ -0,0 +1,122 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "normal_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFEFC), P(0xFFD984), P(0xFFB613), P(0xFFB717),
+  P(0xFFDF97), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFE), P(0xFFCD5C), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFDC8F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFDC8D),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB205),
+  P(0xFFF1D2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFF4DD), P(0xFFB208), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFC545),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFCA54), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFE9B7),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFF1D1), P(0xFFB001), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFC33D), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFC952),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFEFCA), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFF4DB), P(0xFFB102), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFCD5F), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFD26D), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB309), P(0xFFF9EC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFBF1), P(0xFFB40C), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFDC8D), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFDD92),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFBB24), P(0xFFFEFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFE), P(0xFFBD29), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFE9B8), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFE9B8), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFC647), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFC647), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB001),
+  P(0xFFF0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFF0D0),
+  P(0xFFB001), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFC545),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFC646), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFDA87),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFD67B), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFC543),
+  P(0xFFEBBD), P(0xFFFFFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFDF7), P(0xFFE7B0),
+  P(0xFFC33E), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFBC28), P(0xFFD880), P(0xFFF0CE), P(0xFFFFFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFE8B5), P(0xFFD67C), P(0xFFC647), P(0xFFB40D), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000), P(0xFFB000),
+  P(0xFFB000), P(0xFFB000), P(0xFFB717), P(0xFFC74B), P(0xFFD77E)
+};
+
+constexpr Image image = Image(35, 19, pixels);
+
+const Image * ImageStore::NormalIcon = &image;
@@ -0,0 +1,122 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "poisson_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819),
+  P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF),
+  P(0xFFB819), P(0xFFFFFF), P(0xFFB819), P(0xFFFFFF), P(0xFFB819)
+};
+
+constexpr Image image = Image(35, 19, pixels);
+
+const Image * ImageStore::PoissonIcon = &image;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "probability_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFBFBFB),
+  P(0xBFBFC1), P(0x838387), P(0x5F5F64), P(0x49494F), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x45454B), P(0x59595E), P(0x858589),
+  P(0xC0C0C2), P(0xFBFBFB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC1C1C3),
+  P(0x5C5C61), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x5C5C61), P(0xC5C5C7), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFDFDFD), P(0x97979B),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x9A9A9D),
+  P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x909093),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x9A9A9E), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBEBEC0),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0xC3C3C5), P(0xFFFFFF), P(0xF9F9F9),
+  P(0x54545A), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x57575D), P(0xFBFBFB),
+  P(0xBABABC), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0xBDBDBF), P(0x7E7E82), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x818185), P(0x57575D), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x5A5A60), P(0x44444A), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x404046), P(0x404046), P(0x3F4046), P(0x404046), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x48484D), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x5F574F),
+  P(0xB69767), P(0xEEBF76), P(0x667083), P(0x646C7C), P(0x595C68), P(0x46474F),
+  P(0x3F3F45), P(0x404046), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x927C5D),
+  P(0xFAC87A), P(0xFFCC7B), P(0xFFCC7B), P(0x667184), P(0x667184), P(0x667184),
+  P(0x656C7B), P(0x53565F), P(0x3E3F46), P(0x404046), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x967F5E),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0x667184), P(0x667184),
+  P(0x667184), P(0x667184), P(0x656C7B), P(0x555862), P(0x3E3E45), P(0x404046),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x776751),
+  P(0xFECB7A), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0x667184),
+  P(0x667184), P(0x667184), P(0x667184), P(0x667184), P(0x656B79), P(0x4A4C54),
+  P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x464346),
+  P(0xF8C572), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0x667184), P(0x667184), P(0x667184), P(0x667184), P(0x667184), P(0x667082),
+  P(0x5F626D), P(0x3D3E44), P(0x404046), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404147), P(0x3F3F45),
+  P(0xC99E58), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCB77), P(0xFABD53),
+  P(0xE6A936), P(0x656A76), P(0x656C7B), P(0x667183), P(0x667184), P(0x667184),
+  P(0x667184), P(0x656C7B), P(0x494A52), P(0x3F3F45), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F4046),
+  P(0x4A4642), P(0xFEC972), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCA75), P(0xFFBB40),
+  P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656A77), P(0x667083),
+  P(0x667184), P(0x667184), P(0x667082), P(0x555863), P(0x3D3D44), P(0x404046),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404147),
+  P(0x3E3E45), P(0xB48E4F), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFBC46),
+  P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656B79), P(0x667184), P(0x667184), P(0x667184), P(0x626875), P(0x3C3C42),
+  P(0x3F4046), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x404046), P(0x3D3D43), P(0xF1BD68), P(0xFFCC7B), P(0xFFCC7B), P(0xFFC460),
+  P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x666E7E), P(0x667184), P(0x667184), P(0x666E7F),
+  P(0x3F3F46), P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x3F3F45), P(0x494645), P(0xFFCB79), P(0xFFCC7B), P(0xFFCC7A),
+  P(0xFFBA3F), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656A77), P(0x667184), P(0x667184),
+  P(0x667184), P(0x484A52), P(0x3E3E44), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x3F3F45), P(0x967B52), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFC667), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x666F80),
+  P(0x667184), P(0x667184), P(0x555A67), P(0x3D3D44), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x404147), P(0x3E3E44), P(0xD3A863), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFBF50), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133),
+  P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656C7B), P(0x667184), P(0x667184), P(0x606777), P(0x3C3D43), P(0x404046),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x3D3D43), P(0xF5C372),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFBA3D), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656A77), P(0x667184), P(0x667184), P(0x656F80), P(0x3B3C42),
+  P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F4046), P(0x4E4A47),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFC971), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x667082), P(0x667184), P(0x667184),
+  P(0x404249), P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F3F45),
+  P(0x7D6B51), P(0xFFCC7B), P(0xFFCC7B), P(0xFFC35D), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x666E7F), P(0x667184),
+  P(0x667184), P(0x4F535E), P(0x3E3E44), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x3E3E45), P(0xB7935A), P(0xFFCC7B), P(0xFFCC7B), P(0xFFBD49), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656C7A),
+  P(0x667184), P(0x667184), P(0x5B606E), P(0x3D3D43), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x404046), P(0x3D3D44), P(0xE0B163), P(0xFFCC7B), P(0xFFCB76), P(0xFFB836),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656976), P(0x667183), P(0x667184), P(0x636B7B), P(0x3C3C42), P(0x404046),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x404046), P(0x3C3C42), P(0xF9C46C), P(0xFFCC7B), P(0xFFC35D),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133),
+  P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x666E7E), P(0x667184), P(0x666F80), P(0x414249),
+  P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x3F3F45), P(0x5C503F), P(0xFFCB76), P(0xFFCC7B),
+  P(0xFFBB42), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656B78), P(0x667184), P(0x667082),
+  P(0x4E505A), P(0x3E3E44), P(0x404147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x404046), P(0x3E3E44), P(0xA8823F), P(0xFFCC7B),
+  P(0xFFC76A), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x666F81),
+  P(0x667184), P(0x5F636F), P(0x3C3C43), P(0x404046), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x3F4046), P(0x413F42), P(0xF1B348),
+  P(0xFFCC7B), P(0xFFBE4A), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656C7A), P(0x667184), P(0x656B79), P(0x464850), P(0x3F3F45), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x404147), P(0x3E3E45), P(0x8A6C3B),
+  P(0xFFC259), P(0xFFC96F), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x667082), P(0x666D7D), P(0x5A5D68), P(0x3D3D43),
+  P(0x404046), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x434142),
+  P(0xE7A835), P(0xFFC86D), P(0xFFBE4D), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656C7A), P(0x666F81), P(0x656975),
+  P(0x474850), P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x3E3E44),
+  P(0xA88039), P(0xFFBA3D), P(0xFFC86E), P(0xFFB735), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133),
+  P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x667081),
+  P(0x656A77), P(0x5F626E), P(0x3F3F45), P(0x404046), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F3F45),
+  P(0x6A593F), P(0xFDB634), P(0xFFC157), P(0xFFBD49), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656B7A), P(0x656D7C), P(0x656975), P(0x545660), P(0x3E3E44), P(0x404046),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F4046),
+  P(0x524A41), P(0xE9A935), P(0xFFB735), P(0xFFC460), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x666E7E), P(0x656975), P(0x656975), P(0x4B4D56),
+  P(0x3F3F45), P(0x404147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x454243), P(0xD79D36), P(0xFFB734), P(0xFFBD49), P(0xFFBB41), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656A78), P(0x656B79), P(0x656975),
+  P(0x646773), P(0x44454D), P(0x3F3F45), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x3F3E44), P(0xBE8E38), P(0xFFB734), P(0xFFB734), P(0xFFBD4A), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656B79),
+  P(0x656975), P(0x656975), P(0x60636E), P(0x404147), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x3F3E44), P(0xAF8439), P(0xFFB734), P(0xFFB734), P(0xFFB93C), P(0xFFB838),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133), P(0xE4A52F),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656A76), P(0x656A76), P(0x656975), P(0x656975), P(0x5C606B), P(0x3F4047),
+  P(0x404046), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x3F3E44), P(0xAB823A), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB838),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF6B133),
+  P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656976), P(0x656975), P(0x656975), P(0x656975),
+  P(0x5B5E68), P(0x3F4046), P(0x404046), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x424044), P(0xB78939), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x5B5E68), P(0x3F4147), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3F4046),
+  P(0x4E4843), P(0xCF9937), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF6B133), P(0xE4A52F), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x5E616C), P(0x424349),
+  P(0x3F4046), P(0x404147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x404046),
+  P(0x7C6540), P(0xEDAC35), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF7B233), P(0xE7A730), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x626671), P(0x4B4C54), P(0x404046), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x404046), P(0x3E3E44), P(0x3B3B41), P(0x38383E), P(0x35363C), P(0x34343B),
+  P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B),
+  P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B),
+  P(0x33343B), P(0x33343B), P(0x33343B), P(0x34343B), P(0x34343B), P(0x34353B),
+  P(0x33353B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B),
+  P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B),
+  P(0x33343B), P(0x33343B), P(0x33343B), P(0x33343B), P(0x34343B), P(0x35353C),
+  P(0x37383E), P(0x3A3B41), P(0x3D3E44), P(0x404046), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x404046), P(0x3F3F45), P(0x3D3D43), P(0x3B3C42), P(0x3B3B41),
+  P(0x3A3B41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41),
+  P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41),
+  P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A40), P(0x3A3B41),
+  P(0x3B3B41), P(0x3A3A40), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41),
+  P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41),
+  P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3A41), P(0x3A3B41),
+  P(0x3A3B41), P(0x3B3C42), P(0x3D3D43), P(0x3F3F45), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414146), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3E3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45),
+  P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x3F3F45), P(0x404046), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x3F3F45), P(0x3E3E43), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x3E3E44), P(0x3F3F44),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x434347),
+  P(0x5A5A5E), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x5E5E61), P(0xABABAC), P(0x3E3E44), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x3E3E43), P(0xADADAF), P(0xF7F7F7), P(0x3C3C40), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x3D3D41), P(0xFAFAFA), P(0xFFFFFF), P(0xB2B2B3), P(0x353539),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x333338), P(0xB6B6B7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x838384), P(0x35353A), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x333338), P(0x878789), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFCFCFC), P(0x7B7B7D), P(0x2D2D31), P(0x3D3D42), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x3D3D42), P(0x2D2D30), P(0x7E7E7F), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xB5B5B6), P(0x3E3E40),
+  P(0x2E2E32), P(0x37373C), P(0x3D3D43), P(0x404046), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x404046), P(0x3D3D43), P(0x37373C),
+  P(0x2E2E32), P(0x404043), P(0xB5B5B6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFAFAFA), P(0xACACAD), P(0x676769), P(0x414144), P(0x2B2B2E), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x232326),
+  P(0x232326), P(0x232326), P(0x232326), P(0x232326), P(0x252528), P(0x3C3C3F),
+  P(0x6F6F71), P(0xB3B3B4), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::ProbabilityIcon = &image;
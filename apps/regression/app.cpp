@@ -64,6 +64,30 @@ uint32_t * App::Snapshot::rangeVersion() {
   return &m_rangeVersion;
 }
 
+size_t App::Snapshot::serialize(char * buffer) {
+  Shared::SnapshotWriter writer(buffer);
+  m_store.serialize(&writer);
+  m_cursor.serialize(&writer);
+  writer.write(m_graphSelectedDotIndex);
+  writer.write(m_modelVersion);
+  writer.write(m_rangeVersion);
+  writer.write((int8_t)activeTab());
+  writer.write((int8_t)selectedTab());
+  return writer.size();
+}
+
+void App::Snapshot::deserialize(const char * buffer, size_t size) {
+  Shared::SnapshotReader reader(buffer, size);
+  m_store.deserialize(&reader);
+  m_cursor.deserialize(&reader);
+  m_graphSelectedDotIndex = reader.read<int>();
+  m_modelVersion = reader.read<uint32_t>();
+  m_rangeVersion = reader.read<uint32_t>();
+  setActiveTab(reader.read<int8_t>());
+  setSelectedTab(reader.read<int8_t>());
+  assert(reader.isAtEnd());
+}
+
 App::App(Container * container, Snapshot * snapshot) :
   TextFieldDelegateApp(container, snapshot, &m_tabViewController),
   m_calculationController(&m_calculationAlternateEmptyViewController, &m_calculationHeader, snapshot->store()),
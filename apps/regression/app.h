@@ -29,6 +29,8 @@ public:
     int * graphSelectedDotIndex();
     uint32_t * modelVersion();
     uint32_t * rangeVersion();
+    size_t serialize(char * buffer) override;
+    void deserialize(const char * buffer, size_t size) override;
   private:
     Store m_store;
     Shared::CurveViewCursor m_cursor;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "regression_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF7F7F7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFAFAFA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF2F2F2), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xCACCD4), P(0x9CA1B0), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xDEDFE3), P(0x8E94A5), P(0xD6D8DD), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x56565B), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xECEDEE), P(0x979CAC), P(0xBFC2CB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF8F8F8), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF4F4F4), P(0xA7ABB9), P(0xA9ADBA), P(0xF4F4F4), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xBDC0CA), P(0x989DAD), P(0xEDEEEF), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xD4D6DB), P(0x8F95A6), P(0xE0E1E5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xE5E6E9), P(0x9197A8), P(0xCCCED5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF1F1F2), P(0x9DA2B1), P(0xB4B7C3), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xB0B4C0), P(0xA0A5B3), P(0xF2F2F2), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xC7CAD2), P(0x9398A9), P(0xE8E8EB), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF8E0B4), P(0xFDC155),
+  P(0xFFB839), P(0xFDC155), P(0xF8E0B4), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xDCDEE2), P(0x8F95A6), P(0xD7D9DE), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF8E1B5), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF8E0B4), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xEBECEE), P(0x969CAC), P(0xC1C4CC), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFEC255),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFEC255),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF4F4F4), P(0xA5A9B7), P(0xAAAEBB), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFFB939), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB939), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xB6BAC4), P(0x989DAD), P(0xE6E6E7),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xFFC356), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFC356), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xCCCED4), P(0x8F95A6), P(0xDADBDE),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFDE5B9), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFDE4B8), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xDDDEE1), P(0x9096A7), P(0xC7CAD1),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xF2F2F2), P(0xFFE6BA), P(0xFFC355),
+  P(0xFFB838), P(0xFFC355), P(0xFFE6BA), P(0xF2F2F2), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xE7E7E8), P(0x9BA0AF), P(0xB3B6C1),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xF2F2F2),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFCFCFC), P(0xF2F2F2), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xF2DAAE), P(0xFCC053), P(0xFFB838), P(0xFCC053), P(0xF2DAAE), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xABAFBB), P(0xA0A5B3),
+  P(0xEAEAEA), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xF2DBAF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF2DAAE), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xC1C4CC), P(0x9398A9),
+  P(0xE1E2E4), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xFDC154), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFDC154), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xD4D6DA), P(0x8E93A5),
+  P(0xD2D4D9), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFFB939), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB939), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xE2E3E5), P(0x949AAA),
+  P(0xBEC1CA), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFC356), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC356), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xEAEAEA), P(0xA2A6B4),
+  P(0xA9AEBA), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFDE5B9), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFDE4B8), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xB5B9C3),
+  P(0x999EAE), P(0xE6E7E8), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xF2F2F2),
+  P(0xFFE6BA), P(0xFFC355), P(0xFFB838), P(0xFFC355), P(0xFFE6BA), P(0xF2F2F2),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xCBCDD3),
+  P(0x8F95A6), P(0xDBDCDF), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xF2F2F2), P(0xFCFCFC), P(0xFFFFFF), P(0xFCFCFC), P(0xF2F2F2),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xDCDDE0),
+  P(0x8F95A6), P(0xCACCD2), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xE6E7E8),
+  P(0x999FAE), P(0xB5B8C2), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xAAAEBA), P(0xA1A6B4), P(0xEAEAEA), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xBFC2CA), P(0x9499AA), P(0xE2E2E4), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xD3D4D9), P(0x8D93A5), P(0xD4D6DA), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xF2DAAE), P(0xFCC053), P(0xFFB838), P(0xFCC053), P(0xF2DAAE),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xE1E2E4), P(0x9398A9), P(0xC0C3CB), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xF2DBAF), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF2DAAE), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xEAEAEA), P(0xA0A5B3), P(0xABAFBB), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFDC154), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFDC154), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xABAFB9), P(0x979CAB), P(0xD5D5D6), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xFFB939), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB939), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xBCBEC5), P(0x8F95A6), P(0xCCCDD0), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xFFC356), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC356), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xCBCCCF), P(0x8E94A5), P(0xBFC1C7), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xFBE3B7),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFBE2B6),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD4D5D6), P(0x969BAA), P(0xAEB1BB), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xE6E6E6), P(0xFFE6BA), P(0xFFC355), P(0xFFB838), P(0xFFC355), P(0xFFE6BA),
+  P(0xE6E6E6), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x414147), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xA2A6B3), P(0x9EA3B0), P(0xD8D8D8), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xE6E6E6), P(0xF9F9F9), P(0xFEFEFE), P(0xF9F9F9),
+  P(0xE6E6E6), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xC5C7CB), P(0x9499A9), P(0xD2D2D4), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD7D7D7), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x434349), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x535358), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDBDBDB), P(0xDBDBDB),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD4D4D4), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD2D2D2), P(0xDBDBDB), P(0xDBDBDB), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xDBDBDB), P(0xFDFDFD), P(0xC9C9C9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xC7C7C7), P(0xFCFCFC), P(0xFFFFFF), P(0xDDDDDD), P(0xD5D5D5),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD2D2D2), P(0xDDDDDD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xC9C9C9), P(0xD5D5D5), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD3D3D3), P(0xC9C9C9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xC5C5C5), P(0xC4C4C4), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xC2C2C2), P(0xC4C4C4), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDEDEDE), P(0xABABAB),
+  P(0xC5C5C5), P(0xD8D8D8), P(0xDBDBDB), P(0xDADADA), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD8D8D8),
+  P(0xC5C5C5), P(0xABABAB), P(0xDEDEDE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFD), P(0xDBDBDB), P(0xBBBBBB), P(0xA7A7A7), P(0x9C9C9C), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9C9C9C), P(0xA7A7A7),
+  P(0xBBBBBB), P(0xDBDBDB), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::RegressionIcon = &image;
@@ -238,4 +238,14 @@ float Store::addMargin(float x, float range, bool isMin) {
   return x+ratio*range;
 }
 
+void Store::serialize(Shared::SnapshotWriter * writer) {
+  InteractiveCurveViewRange::serialize(writer);
+  FloatPairStore::serialize(writer);
+}
+
+void Store::deserialize(Shared::SnapshotReader * reader) {
+  InteractiveCurveViewRange::deserialize(reader);
+  FloatPairStore::deserialize(reader);
+}
+
 }
@@ -19,6 +19,8 @@ public:
 
   // Window
   void setDefault() override;
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
 
   // Calculation
   double numberOfPairs();
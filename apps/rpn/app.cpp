@@ -38,6 +38,18 @@ RpnStore * App::Snapshot::rpnStore() {
   return &m_rpnStore;
 }
 
+size_t App::Snapshot::serialize(char * buffer) {
+  Shared::SnapshotWriter writer(buffer);
+  m_rpnStore.serialize(&writer);
+  return writer.size();
+}
+
+void App::Snapshot::deserialize(const char * buffer, size_t size) {
+  Shared::SnapshotReader reader(buffer, size);
+  m_rpnStore.deserialize(&reader);
+  assert(reader.isAtEnd());
+}
+
 void App::Snapshot::tidy() {
   m_rpnStore.tidy();
 }
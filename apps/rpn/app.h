@@ -23,6 +23,8 @@ public:
     App * unpack(Container * container) override;
     void reset() override;
     Descriptor * descriptor() override;
+    size_t serialize(char * buffer) override;
+    void deserialize(const char * buffer, size_t size) override;
     RpnStore * rpnStore();
   private:
     void tidy() override;
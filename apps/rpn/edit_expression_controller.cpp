@@ -86,7 +86,10 @@ bool EditExpressionController::textFieldDidReceiveEvent(::TextField * textField,
   if (textField->textFieldShouldFinishEditing(event) && textField->isEditing() && strlen(textField->text()) == 0 && m_rpnStore->numberOfRpns() > 0) {
     App * rpnApp = (App *)app();
     const char * lastTextBody = m_rpnStore->rpnAtIndex(m_rpnStore->numberOfRpns()-1)->inputText();
-    m_rpnStore->push(lastTextBody, rpnApp->localContext());
+    if (m_rpnStore->push(lastTextBody, rpnApp->localContext()) == nullptr) {
+      app()->displayWarning(I18n::Message::NotEnoughMemory);
+      return true;
+    }
     m_historyController->reload();
     ((ContentView *)view())->mainView()->scrollToCell(0, m_historyController->numberOfRows()-1);
     return true;
@@ -96,7 +99,11 @@ bool EditExpressionController::textFieldDidReceiveEvent(::TextField * textField,
 
 bool EditExpressionController::textFieldDidFinishEditing(::TextField * textField, const char * text, Ion::Events::Event event) {
   App * rpnApp = (App *)app();
-  m_rpnStore->push(textBody(), rpnApp->localContext());
+  if (m_rpnStore->push(textBody(), rpnApp->localContext()) == nullptr) {
+    // The text is kept in the field
+    app()->displayWarning(I18n::Message::NotEnoughMemory);
+    return false;
+  }
   m_historyController->reload();
   ((ContentView *)view())->mainView()->scrollToCell(0, m_historyController->numberOfRows()-1);
   ((ContentView *)view())->textField()->setEditing(true);
@@ -6,8 +6,8 @@ using namespace Poincare;
 namespace Rpn {
 
 Rpn::Rpn() :
-  m_inputText(""),
-  m_outputText(""),
+  m_inputText(),
+  m_outputText(),
   m_input(nullptr),
   m_inputLayout(nullptr),
   m_output(nullptr),
@@ -35,39 +35,64 @@ Rpn::~Rpn() {
 }
 
 Rpn& Rpn::operator=(const Rpn& other) {
-  const char * otherInputText = other.m_inputText;
-  const char * otherOutputText = other.m_outputText;
+  if (this == &other) {
+    return *this;
+  }
+  /* reset moves the records in the store: other's texts are read after it */
   reset();
-  strlcpy(m_inputText, otherInputText, sizeof(m_inputText));
-  strlcpy(m_outputText, otherOutputText, sizeof(m_outputText));
+  m_inputText.setText(other.m_inputText.text());
+  m_outputText.setText(other.m_outputText.text());
   return *this;
 }
 
 void Rpn::reset() {
-  m_inputText[0] = 0;
-  m_outputText[0] = 0;
+  m_inputText.setText("");
+  m_outputText.setText("");
   tidy();
 }
 
-void Rpn::setContent(const char * c, Context * context) {
-  reset();
-  strlcpy(m_inputText, c, sizeof(m_inputText));
-  Evaluation<double> * evaluation = input()->evaluate<double>(*context);
-  evaluation->writeTextInBuffer(m_outputText, sizeof(m_outputText));
+void Rpn::moveFrom(Rpn * other) {
+  tidy();
+  m_inputText.moveFrom(&other->m_inputText);
+  m_outputText.moveFrom(&other->m_outputText);
+  other->tidy();
+}
+
+bool Rpn::setContent(const char * c, Context * context) {
+  /* c may be the text of another rpn, which reset can move */
+  char inputText[::TextField::maxBufferSize()];
+  strlcpy(inputText, c, sizeof(inputText));
+  Expression * input = Expression::parse(inputText);
+  Evaluation<double> * evaluation = input->evaluate<double>(*context);
+  char outputText[2*::TextField::maxBufferSize()];
+  evaluation->writeTextInBuffer(outputText, sizeof(outputText));
   delete evaluation;
+  /* The texts are only replaced if both fit, so that a full store leaves this
+   * rpn untouched. */
+  const Shared::TextRecord * records[] = {&m_inputText, &m_outputText};
+  const char * texts[] = {inputText, outputText};
+  if (!Shared::TextRecord::canReplace(records, texts, 2)) {
+    delete input;
+    return false;
+  }
+  reset();
+  m_inputText.setText(inputText);
+  m_outputText.setText(outputText);
+  m_input = input;
+  return true;
 }
 
 const char * Rpn::inputText() {
-  return m_inputText;
+  return m_inputText.text();
 }
 
 const char * Rpn::outputText() {
-  return m_outputText;
+  return m_outputText.text();
 }
 
 Expression * Rpn::input() {
   if (m_input == nullptr) {
-    m_input = Expression::parse(m_inputText);
+    m_input = Expression::parse(m_inputText.text());
   }
   return m_input;
 }
@@ -83,7 +108,7 @@ Evaluation<double> * Rpn::output(Context * context) {
   if (m_output == nullptr) {
     /* To ensure that the expression 'm_output' is a matrix or a complex, we
      * call 'evaluate'. */
-    Expression * exp = Expression::parse(m_outputText);
+    Expression * exp = Expression::parse(m_outputText.text());
     if (exp != nullptr) {
       m_output = exp->evaluate<double>(*context);
       delete exp;
@@ -108,7 +133,7 @@ bool Rpn::isEmpty() {
    * until the end of the method 'setContent'. Indeed, during 'setContent'
    * method, 'ans' evaluation calls the evaluation of the last rpn
    * only if the rpn being filled is not taken into account.*/
-  if (strlen(m_outputText) == 0) {
+  if (strlen(m_outputText.text()) == 0) {
     return true;
   }
   return false;
@@ -133,4 +158,14 @@ void Rpn::tidy() {
   m_outputLayout = nullptr;
 }
 
+void Rpn::serialize(Shared::SnapshotWriter * writer) {
+  m_inputText.serialize(writer);
+  m_outputText.serialize(writer);
+}
+
+void Rpn::deserialize(Shared::SnapshotReader * reader) {
+  m_inputText.deserialize(reader);
+  m_outputText.deserialize(reader);
+}
+
 }
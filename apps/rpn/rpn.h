@@ -3,6 +3,7 @@
 
 #include <escher.h>
 #include <poincare.h>
+#include "../shared/text_record.h"
 
 namespace Rpn {
 
@@ -16,18 +17,24 @@ public:
   Rpn& operator=(Rpn&& other) = delete;
   /* c.reset() is the equivalent of c = Rpn() without copy assingment. */
   void reset();
+  /* Moves the texts of other, which is left empty, without needing room in
+   * the record store */
+  void moveFrom(Rpn * other);
   const char * inputText();
   const char * outputText();
   Poincare::Expression * input();
   Poincare::ExpressionLayout * inputLayout();
   Poincare::Evaluation<double> * output(Poincare::Context * context);
   Poincare::ExpressionLayout * outputLayout(Poincare::Context * context);
-  void setContent(const char * c, Poincare::Context * context);
+  /* Returns false, leaving the rpn unchanged, if the record store is full */
+  bool setContent(const char * c, Poincare::Context * context);
   bool isEmpty();
   void tidy();
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
 private:
-  char m_inputText[::TextField::maxBufferSize()];
-  char m_outputText[2*::TextField::maxBufferSize()];
+  Shared::TextRecord m_inputText;
+  Shared::TextRecord m_outputText;
   Poincare::Expression * m_input;
   Poincare::ExpressionLayout * m_inputLayout;
   Poincare::Evaluation<double> * m_output;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "rpn_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF7F7F7), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFAFAFA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x838383), P(0x575757), P(0xD1D1D1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF6F6F6), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0x636363),
+  P(0x636363), P(0x636363), P(0x636363), P(0x636363), P(0x636363), P(0x636363),
+  P(0x636363), P(0x636363), P(0x636363), P(0xB3B3B3), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF2F2F2), P(0x272727), P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x9E9E9E), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF7F7F7), P(0x868686),
+  P(0x717171), P(0x232323), P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x000000), P(0x000000), P(0x808080), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0xDCDCDC),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF8F8F8), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE0E0E0),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0xD0D0D0),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD4D4D4), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000),
+  P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD4D4D4),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000),
+  P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000),
+  P(0xD4D4D4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000),
+  P(0x000000), P(0x727272), P(0x898989), P(0x898989), P(0x898989), P(0x898989),
+  P(0x898989), P(0x898989), P(0x898989), P(0xD1D1D1), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x9E9E9E), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x000000), P(0x000000), P(0x747474), P(0x8C8C8C), P(0x8C8C8C),
+  P(0x8C8C8C), P(0x8C8C8C), P(0x8C8C8C), P(0x8C8C8C), P(0x8C8C8C), P(0xD3D3D3),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD0D0D0),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD4D4D4), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000),
+  P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD4D4D4),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000),
+  P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000),
+  P(0xD4D4D4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000),
+  P(0x000000), P(0xD4D4D4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x000000), P(0x000000), P(0xD0D0D0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x000000), P(0x000000), P(0xD4D4D4), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE0E0E0), P(0x5A5A5A),
+  P(0x5A5A5A), P(0x5A5A5A), P(0x000000), P(0x000000), P(0x494949), P(0x5A5A5A),
+  P(0x5A5A5A), P(0xB7B7B7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x9E9E9E),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE0E0E0),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0xAAAAAA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x9E9E9E), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC),
+  P(0xFCFCFC), P(0xFCFCFC), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF2F2F2), P(0x9E9E9E), P(0x646464), P(0x474747), P(0x2D2D2D),
+  P(0x4E4E4E), P(0x707070), P(0xE5E5E5), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x030303), P(0xA8A8A8), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFD07B), P(0xFFCD74), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x000000), P(0x555555), P(0xBABABA),
+  P(0xE5E5E5), P(0xFFFFFF), P(0xBFBFBF), P(0x646464), P(0x000000), P(0x070707),
+  P(0xD8D8D8), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFC151), P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD1D1D1), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x383838),
+  P(0x000000), P(0xA7A7A7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC151), P(0xFFFFFF), P(0xFFE8BE),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x696969), P(0x000000), P(0x848484), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC151), P(0xFFFFFF),
+  P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x444444), P(0x000000), P(0xA5A5A5), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC151),
+  P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xD7D7D7), P(0x000000), P(0x000000), P(0xDFDFDF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFC151), P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x4C4C4C), P(0x000000), P(0x595959), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFEAC5), P(0xFFEAC5), P(0xFFEAC5), P(0xFFEAC5),
+  P(0xFFEAC5), P(0xFFEAC5), P(0xFFFFFF), P(0xFFF8EC), P(0xFFEAC5), P(0xFFEAC5),
+  P(0xFFEAC5), P(0xFFEAC5), P(0xFFEAC5), P(0xFFCD74), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x737373), P(0x000000), P(0x202020), P(0xEFEFEF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFFBF4), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFCE75), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x7A7A7A), P(0x000000), P(0x1B1B1B), P(0xD0D0D0),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB839), P(0xFFB839),
+  P(0xFFB839), P(0xFFB839), P(0xFFB839), P(0xFFC356), P(0xFFFFFF), P(0xFFE8BE),
+  P(0xFFB839), P(0xFFB839), P(0xFFB839), P(0xFFB839), P(0xFFB839), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x787878), P(0x000000), P(0x222222), P(0xD1D1D1),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC151), P(0xFFFFFF),
+  P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x6C6C6C), P(0x000000), P(0x2E2E2E), P(0xDCDCDC),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFC151),
+  P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF9F9F9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFBFBFB), P(0x575757), P(0x000000), P(0x343434), P(0xE8E8E8),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFC151), P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFEB634), P(0xF2F2F2), P(0xF5F5F5),
+  P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xD9D9D9), P(0x303030), P(0x000000), P(0x303030), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFC151), P(0xFFFFFF), P(0xFFE8BE), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF8B134), P(0xEDEDED),
+  P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xA8A8A8), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x030303), P(0x0B0B0B), P(0x131313), P(0x1B1B1B),
+  P(0x1E1E1E), P(0xC2C2C2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFC151), P(0xFFF3DD), P(0xFFE6B9), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xEDAB3B),
+  P(0xEAEAEA), P(0xF5F5F5), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xA5A5A5), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000), P(0x000000),
+  P(0x000000), P(0x000000), P(0xC2C2C2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xE1AD5A), P(0xF1F1F1), P(0xF2F2F2), P(0xF9F9F9), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF8F8F8),
+  P(0xF8F8F8), P(0xF8F8F8), P(0xF8F8F8), P(0xF8F8F8), P(0xF8F8F8), P(0xF8F8F8),
+  P(0xF8F8F8), P(0xF8F8F8), P(0xF8F8F8), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF8B234), P(0xE0CAA9), P(0xFEFEFE), P(0xE5E5E5), P(0xF9F9F9), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0xF5F5F5), P(0xF5F5F5), P(0x656975),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD89D40), P(0xFCFBF8), P(0xFFFFFF), P(0xF2F2F2), P(0xEBEBEB),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9),
+  P(0xF9F9F9), P(0xF9F9F9), P(0xF9F9F9), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xE3A134), P(0xE1CEB2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xEAEAEA), P(0xE9E9E9), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xE5A334), P(0xD5B486), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xE8E8E8), P(0xE2E2E2), P(0xF1F1F1), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xF6B034), P(0xD59733), P(0xD1B07F), P(0xFEFDFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF2F2F2), P(0xDDDDDD),
+  P(0xE2E2E2), P(0xECECEC), P(0xF1F1F1), P(0xF4F4F4), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x656975), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFEB634), P(0xF7B134), P(0xEBA734),
+  P(0xD79833), P(0xC6944C), P(0xE1CFB3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFEFEFE), P(0xF0F0F0), P(0xE4E4E4), P(0xDDDDDD), P(0xD9D9D9), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8),
+  P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0xD8D8D8), P(0x4E5058), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733),
+  P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18733), P(0xC18936), P(0xC59248),
+  P(0xCDA56D), P(0xE0CBAD), P(0xFDFBF9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::RpnIcon = &image;
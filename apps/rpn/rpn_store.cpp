@@ -11,7 +11,9 @@ RpnStore::RpnStore() :
 
 Rpn * RpnStore::push(const char * text, Context * context) {
   Rpn * result = &m_rpns[m_startIndex];
-  result->setContent(text, context);
+  if (!result->setContent(text, context)) {
+    return nullptr;
+  }
   m_startIndex++;
   if (m_startIndex >= k_maxNumberOfRpns) {
     m_startIndex = 0;
@@ -63,7 +65,7 @@ void RpnStore::deleteRpnAtIndex(int i) {
   int index = absoluteIndexRpnI;
   for (int k = i; k < numberOfCalc-1; k++) {
     int nextIndex = index+1 >= k_maxNumberOfRpns ? 0 : index+1;
-    m_rpns[index] = m_rpns[nextIndex];
+    m_rpns[index].moveFrom(&m_rpns[nextIndex]);
     index++;
     if (index == k_maxNumberOfRpns) {
       index = 0;
@@ -89,4 +91,18 @@ void RpnStore::tidy() {
   }
 }
 
+void RpnStore::serialize(Shared::SnapshotWriter * writer) {
+  writer->write(m_startIndex);
+  for (int i = 0; i < k_maxNumberOfRpns; i++) {
+    m_rpns[i].serialize(writer);
+  }
+}
+
+void RpnStore::deserialize(Shared::SnapshotReader * reader) {
+  m_startIndex = reader->read<int>();
+  for (int i = 0; i < k_maxNumberOfRpns; i++) {
+    m_rpns[i].deserialize(reader);
+  }
+}
+
 }
@@ -9,11 +9,15 @@ class RpnStore {
 public:
   RpnStore();
   Rpn * rpnAtIndex(int i);
+  /* Returns nullptr, leaving the history unchanged, if the record store is
+   * full */
   Rpn * push(const char * text, Poincare::Context * context);
   void deleteRpnAtIndex(int i);
   void deleteAll();
   int numberOfRpns();
   void tidy();
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
   static constexpr int k_maxNumberOfRpns = 10;
 private:
   int m_startIndex;
@@ -53,6 +53,16 @@ void App::Snapshot::tidy() {
   m_graphRange.setDelegate(nullptr);
 }
 
+void App::Snapshot::serializeModel(Shared::SnapshotWriter * writer) {
+  m_sequenceStore.serialize(writer);
+  m_graphRange.serialize(writer);
+}
+
+void App::Snapshot::deserializeModel(Shared::SnapshotReader * reader) {
+  m_sequenceStore.deserialize(reader);
+  m_graphRange.deserialize(reader);
+}
+
 App::App(Container * container, Snapshot * snapshot) :
   FunctionApp(container, snapshot, &m_inputViewController),
   m_nContext(((AppsContainer *)container)->globalContext()),
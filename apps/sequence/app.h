@@ -31,6 +31,8 @@ public:
     CurveViewRange * graphRange();
   private:
     void tidy() override;
+    void serializeModel(Shared::SnapshotWriter * writer) override;
+    void deserializeModel(Shared::SnapshotReader * reader) override;
     SequenceStore m_sequenceStore;
     CurveViewRange m_graphRange;
   };
@@ -108,7 +108,9 @@ void ListController::editExpression(Sequence * sequence, int sequenceDefinition,
         Sequence * mySequence = (Sequence *)context;
         InputViewController * myInputViewController = (InputViewController *)sender;
         const char * textBody = myInputViewController->textBody();
-        mySequence->setContent(textBody);
+        if (!mySequence->setContent(textBody)) {
+          myInputViewController->refuseText(I18n::Message::NotEnoughMemory);
+        }
         },
         [](void * context, void * sender){
       });
@@ -119,7 +121,9 @@ void ListController::editExpression(Sequence * sequence, int sequenceDefinition,
       Sequence * mySequence = (Sequence *)context;
       InputViewController * myInputViewController = (InputViewController *)sender;
       const char * textBody = myInputViewController->textBody();
-      mySequence->setFirstInitialConditionContent(textBody);
+      if (!mySequence->setFirstInitialConditionContent(textBody)) {
+        myInputViewController->refuseText(I18n::Message::NotEnoughMemory);
+      }
       },
       [](void * context, void * sender){
     });
@@ -130,7 +134,9 @@ void ListController::editExpression(Sequence * sequence, int sequenceDefinition,
       Sequence * mySequence = (Sequence *)context;
       InputViewController * myInputViewController = (InputViewController *)sender;
       const char * textBody = myInputViewController->textBody();
-      mySequence->setSecondInitialConditionContent(textBody);
+      if (!mySequence->setSecondInitialConditionContent(textBody)) {
+        myInputViewController->refuseText(I18n::Message::NotEnoughMemory);
+      }
       },
       [](void * context, void * sender){
     });
@@ -13,8 +13,8 @@ namespace Sequence {
 Sequence::Sequence(const char * text, KDColor color) :
   Function(text, color),
   m_type(Type::Explicite),
-  m_firstInitialConditionText(""),
-  m_secondInitialConditionText(""),
+  m_firstInitialConditionText(),
+  m_secondInitialConditionText(),
   m_firstInitialConditionExpression(nullptr),
   m_secondInitialConditionExpression(nullptr),
   m_firstInitialConditionLayout(nullptr),
@@ -66,21 +66,28 @@ Sequence::~Sequence() {
 }
 
 Sequence& Sequence::operator=(const Sequence& other) {
-  /* We temporarely store other's required features to be able to access them
-   * after setType (which erase all contents and index buffer) even in case of
-   * self assignement */
-  const char * contentText = other.text();
-  const char * firstInitialText = other.m_firstInitialConditionText;
-  const char * secondInitialText = other.m_secondInitialConditionText;
+  /* setType erases all contents and moves records in the store, so other's
+   * texts are fetched again afterwards. Self assignment is a no-op. */
+  if (this == &other) {
+    return *this;
+  }
   Function::operator=(other);
   setType(other.m_type);
-  setContent(contentText);
-  setFirstInitialConditionContent(firstInitialText);
-  setSecondInitialConditionContent(secondInitialText);
+  setContent(other.text());
+  setFirstInitialConditionContent(other.m_firstInitialConditionText.text());
+  setSecondInitialConditionContent(other.m_secondInitialConditionText.text());
   resetBuffer();
   return *this;
 }
 
+void Sequence::moveFrom(Sequence * other) {
+  Function::moveFrom(other);
+  m_type = other->m_type;
+  m_firstInitialConditionText.moveFrom(&other->m_firstInitialConditionText);
+  m_secondInitialConditionText.moveFrom(&other->m_secondInitialConditionText);
+  resetBuffer();
+}
+
 uint32_t Sequence::checksum() {
   char data[k_dataLengthInBytes/sizeof(char)] = {};
   strlcpy(data, text(), TextField::maxBufferSize());
@@ -93,11 +100,11 @@ uint32_t Sequence::checksum() {
 }
 
 const char * Sequence::firstInitialConditionText() {
-  return m_firstInitialConditionText;
+  return m_firstInitialConditionText.text();
 }
 
 const char * Sequence::secondInitialConditionText() {
-  return m_secondInitialConditionText;
+  return m_secondInitialConditionText.text();
 }
 
 Sequence::Type Sequence::type() {
@@ -135,14 +142,14 @@ void Sequence::setType(Type type) {
 
 Poincare::Expression * Sequence::firstInitialConditionExpression() const {
   if (m_firstInitialConditionExpression == nullptr) {
-    m_firstInitialConditionExpression = Poincare::Expression::parse(m_firstInitialConditionText);
+    m_firstInitialConditionExpression = Poincare::Expression::parse(m_firstInitialConditionText.text());
   }
   return m_firstInitialConditionExpression;
 }
 
 Poincare::Expression * Sequence::secondInitialConditionExpression() const {
   if (m_secondInitialConditionExpression == nullptr) {
-    m_secondInitialConditionExpression = Poincare::Expression::parse(m_secondInitialConditionText);
+    m_secondInitialConditionExpression = Poincare::Expression::parse(m_secondInitialConditionText.text());
   }
   return m_secondInitialConditionExpression;
 }
@@ -161,13 +168,18 @@ Poincare::ExpressionLayout * Sequence::secondInitialConditionLayout() {
   return m_secondInitialConditionLayout;
 }
 
-void Sequence::setContent(const char * c) {
-  Function::setContent(c);
+bool Sequence::setContent(const char * c) {
+  if (!Function::setContent(c)) {
+    return false;
+  }
   resetBuffer();
+  return true;
 }
 
-void Sequence::setFirstInitialConditionContent(const char * c) {
-  strlcpy(m_firstInitialConditionText, c, sizeof(m_firstInitialConditionText));
+bool Sequence::setFirstInitialConditionContent(const char * c) {
+  if (!m_firstInitialConditionText.setText(c)) {
+    return false;
+  }
   if (m_firstInitialConditionExpression != nullptr) {
     delete m_firstInitialConditionExpression;
     m_firstInitialConditionExpression = nullptr;
@@ -177,10 +189,13 @@ void Sequence::setFirstInitialConditionContent(const char * c) {
     m_firstInitialConditionLayout = nullptr;
   }
   resetBuffer();
+  return true;
 }
 
-void Sequence::setSecondInitialConditionContent(const char * c) {
-  strlcpy(m_secondInitialConditionText, c, sizeof(m_secondInitialConditionText));
+bool Sequence::setSecondInitialConditionContent(const char * c) {
+  if (!m_secondInitialConditionText.setText(c)) {
+    return false;
+  }
   if (m_secondInitialConditionExpression != nullptr) {
     delete m_secondInitialConditionExpression;
     m_secondInitialConditionExpression = nullptr;
@@ -190,6 +205,7 @@ void Sequence::setSecondInitialConditionContent(const char * c) {
     m_secondInitialConditionLayout = nullptr;
   }
   resetBuffer();
+  return true;
 }
 
 char Sequence::symbol() const {
@@ -260,9 +276,9 @@ bool Sequence::isEmpty() {
     case Type::Explicite:
       return Function::isEmpty();
     case Type::SingleRecurrence:
-      return Function::isEmpty() && strlen(m_firstInitialConditionText) == 0;
+      return Function::isEmpty() && strlen(m_firstInitialConditionText.text()) == 0;
     default:
-      return Function::isEmpty() && strlen(m_firstInitialConditionText) == 0 && strlen(m_secondInitialConditionText) == 0;
+      return Function::isEmpty() && strlen(m_firstInitialConditionText.text()) == 0 && strlen(m_secondInitialConditionText.text()) == 0;
   }
 }
 
@@ -388,6 +404,20 @@ void Sequence::tidy() {
   }
 }
 
+void Sequence::serialize(SnapshotWriter * writer) {
+  Function::serialize(writer);
+  writer->write(m_type);
+  m_firstInitialConditionText.serialize(writer);
+  m_secondInitialConditionText.serialize(writer);
+}
+
+void Sequence::deserialize(SnapshotReader * reader) {
+  Function::deserialize(reader);
+  m_type = reader->read<Type>();
+  m_firstInitialConditionText.deserialize(reader);
+  m_secondInitialConditionText.deserialize(reader);
+}
+
 void Sequence::resetBuffer() const {
   m_indexBufferFloat[0] = -1;
   m_indexBufferFloat[1] = -1;
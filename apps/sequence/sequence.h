@@ -28,9 +28,10 @@ public:
   Poincare::Expression * secondInitialConditionExpression() const;
   Poincare::ExpressionLayout * firstInitialConditionLayout();
   Poincare::ExpressionLayout * secondInitialConditionLayout();
-  void setContent(const char * c) override;
-  void setFirstInitialConditionContent(const char * c);
-  void setSecondInitialConditionContent(const char * c);
+  void moveFrom(Sequence * other);
+  bool setContent(const char * c) override;
+  bool setFirstInitialConditionContent(const char * c);
+  bool setSecondInitialConditionContent(const char * c);
   int numberOfElements();
   Poincare::ExpressionLayout * nameLayout();
   Poincare::ExpressionLayout * definitionName();
@@ -46,6 +47,8 @@ public:
   }
   double sumOfTermsBetweenAbscissa(double start, double end, Poincare::Context * context);
   void tidy() override;
+  void serialize(Shared::SnapshotWriter * writer) override;
+  void deserialize(Shared::SnapshotReader * reader) override;
 private:
   constexpr static int k_maxRecurrentRank = 10000;
   constexpr static double k_maxNumberOfTermsInSum = 100000.0;
@@ -54,8 +57,8 @@ private:
   char symbol() const override;
   template<typename T> T templatedEvaluateAtAbscissa(T x, Poincare::Context * context) const;
   Type m_type;
-  char m_firstInitialConditionText[TextField::maxBufferSize()];
-  char m_secondInitialConditionText[TextField::maxBufferSize()];
+  Shared::TextRecord m_firstInitialConditionText;
+  Shared::TextRecord m_secondInitialConditionText;
   mutable Poincare::Expression * m_firstInitialConditionExpression;
   mutable Poincare::Expression * m_secondInitialConditionExpression;
   Poincare::ExpressionLayout * m_firstInitialConditionLayout;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "sequence_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFCFCFC), P(0xF9F9F9), P(0xF7F7F7), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF9F9F9),
+  P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFAFAFA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFAFAFA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFC),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFCFCFC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFCFCFC), P(0xF8F8F8), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x57575C), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF8F8F8), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF6F6F6), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0x414147),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0x414147), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0x414147),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0x414147), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC), P(0xECECEC),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B), P(0xFFCC7B),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x414147), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0x414147), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0x414147),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734), P(0xFFB734),
+  P(0xFFB734), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0x434349), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x535358), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDBDBDB), P(0xDBDBDB),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD4D4D4), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD2D2D2), P(0xDBDBDB), P(0xDBDBDB), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xDBDBDB), P(0xFDFDFD), P(0xC9C9C9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xC7C7C7), P(0xFCFCFC), P(0xFFFFFF), P(0xDDDDDD), P(0xD5D5D5),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD2D2D2), P(0xDDDDDD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xC9C9C9), P(0xD5D5D5), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD3D3D3), P(0xC9C9C9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xC5C5C5), P(0xC4C4C4), P(0xDBDBDB), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xDBDBDB), P(0xC2C2C2), P(0xC4C4C4), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDEDEDE), P(0xABABAB),
+  P(0xC5C5C5), P(0xD8D8D8), P(0xDBDBDB), P(0xDADADA), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9),
+  P(0xD9D9D9), P(0xD9D9D9), P(0xD9D9D9), P(0xDADADA), P(0xDBDBDB), P(0xD8D8D8),
+  P(0xC5C5C5), P(0xABABAB), P(0xDEDEDE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFD), P(0xDBDBDB), P(0xBBBBBB), P(0xA7A7A7), P(0x9C9C9C), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A),
+  P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9A9A9A), P(0x9C9C9C), P(0xA7A7A7),
+  P(0xBBBBBB), P(0xDBDBDB), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::SequenceIcon = &image;
@@ -52,7 +52,7 @@ void SequenceStore::removeFunction(Shared::Function * f) {
   assert(i>=0 && i<m_numberOfFunctions);
   m_numberOfFunctions--;
   for (int j = i; j<m_numberOfFunctions; j++) {
-    m_sequences[j] = m_sequences[j+1];
+    m_sequences[j].moveFrom(&m_sequences[j+1]);
   }
   Sequence emptySequence("", KDColorBlack);
   m_sequences[m_numberOfFunctions] = emptySequence;
@@ -106,4 +106,18 @@ void SequenceStore::removeAll() {
   m_numberOfFunctions = 0;
 }
 
+void SequenceStore::serialize(Shared::SnapshotWriter * writer) {
+  writer->write(m_numberOfFunctions);
+  for (int i = 0; i < k_maxNumberOfSequences; i++) {
+    m_sequences[i].serialize(writer);
+  }
+}
+
+void SequenceStore::deserialize(Shared::SnapshotReader * reader) {
+  m_numberOfFunctions = reader->read<int>();
+  for (int i = 0; i < k_maxNumberOfSequences; i++) {
+    m_sequences[i].deserialize(reader);
+  }
+}
+
 }
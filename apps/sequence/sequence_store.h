@@ -21,6 +21,8 @@ public:
   const char * firstAvailableName() override;
   char symbol() const override;
   void removeAll() override;
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
   static constexpr int k_maxNumberOfSequences = 2;
   static constexpr const char * k_sequenceNames[k_maxNumberOfSequences] = {
     "u", "v"//, "w"
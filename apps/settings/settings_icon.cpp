@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "settings_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFD),
+  P(0xD8DAE0), P(0xB3B7C3), P(0x9DA2B1), P(0x9096A7), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8E94A5), P(0x9A9FAF), P(0xB4B8C4),
+  P(0xD9DBE1), P(0xFCFCFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD9DBE1),
+  P(0x9BA1B0), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x9BA1B0), P(0xDCDDE3), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0xC0C3CD),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0xC1C4CE),
+  P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBBBFC9),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0xC2C5CE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xD7D9E0),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0xDBDCE2), P(0xFFFFFF), P(0xFBFCFC),
+  P(0x979CAC), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x999EAE), P(0xFCFCFD),
+  P(0xD5D7DD), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0xD7D9DF), P(0xB0B4C1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0xB2B6C2), P(0x999EAE), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x9AA0AF), P(0x8D93A4), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F), P(0x898FA1),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8F95A6), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x898FA1), P(0x8A90A1), P(0xC1C5CE), P(0xEDEEF1), P(0xFCFCFD), P(0xEDEEF1),
+  P(0xC1C5CE), P(0x8A90A1), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x898FA1), P(0x8A90A1), P(0xE2E3E7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xE2E3E7), P(0x8A90A1), P(0x898FA1), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x868C9E), P(0xC0C3CC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBFC2CB), P(0x868C9E),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x898FA1), P(0x82899B), P(0xECEDF0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xEDEEF0),
+  P(0x82899B), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0xDBDCDE), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE0E0E1), P(0xD2D3D6), P(0xFDFDFE), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFE), P(0xD2D3D6), P(0xE0E0E1), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xDBDCDE), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x5E6678),
+  P(0x586072), P(0x586072), P(0x586072), P(0x555D6F), P(0x505869), P(0xE6E7E9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xE7E8EA), P(0x505869), P(0x555D6F), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x5E6678), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x878D9F), P(0x7F8597),
+  P(0xBABEC7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xB9BDC6), P(0x7F8597), P(0x878D9F), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1),
+  P(0x82899B), P(0x7C8394), P(0xDEDFE3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xDEDFE3), P(0x7C8394), P(0x82899B), P(0x898FA1),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x868C9E), P(0x7E8496), P(0x7A8091), P(0xB6BAC3), P(0xEAEBEE),
+  P(0xFBFCFC), P(0xEAEBEE), P(0xB6BAC3), P(0x7A8091), P(0x7E8496), P(0x868C9E),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x858B9D), P(0x7E8496), P(0x777E90),
+  P(0x72798B), P(0x717789), P(0x72798B), P(0x777E90), P(0x7E8496), P(0x858B9D),
+  P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x868C9E),
+  P(0x82899B), P(0x7F8597), P(0x7E8496), P(0x7F8597), P(0x82899B), P(0x868C9E),
+  P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F), P(0x898FA1),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F),
+  P(0x898FA1), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x898FA1), P(0x8A90A1), P(0xC1C5CE), P(0xEDEEF1), P(0xFCFCFD),
+  P(0xEDEEF1), P(0xC1C5CE), P(0x8A90A1), P(0x898FA1), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x898FA1), P(0x8A90A1), P(0xE2E3E7), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xE2E3E7), P(0x8A90A1), P(0x898FA1),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8A90A2), P(0x868C9E), P(0xC0C3CC), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBFC2CB),
+  P(0x868C9E), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x82899B), P(0xECEDF0), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xEDEEF0), P(0x82899B), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0xDBDCDE), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE0E0E1), P(0xD2D3D6), P(0xFDFDFE),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFDFDFE), P(0xD2D3D6), P(0xD5D7D9), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x5E6678), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x555D6F), P(0x505869),
+  P(0xE6E7E9), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xE7E8EA), P(0x505869), P(0x5B6375), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x878D9F),
+  P(0x7F8597), P(0xBABEC7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xB9BDC6), P(0x7F8597), P(0x878D9F),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x898FA1), P(0x82899B), P(0x7C8394), P(0xDEDFE3), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xDEDFE3), P(0x7C8394), P(0x82899B),
+  P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8A90A2), P(0x868C9E), P(0x7E8496), P(0x7A8091), P(0xB6BAC3),
+  P(0xEAEBEE), P(0xFBFCFC), P(0xEAEBEE), P(0xB6BAC3), P(0x7A8091), P(0x7E8496),
+  P(0x868C9E), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x858B9D), P(0x7E8496),
+  P(0x777E90), P(0x72798B), P(0x717789), P(0x72798B), P(0x777E90), P(0x7E8496),
+  P(0x858B9D), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1),
+  P(0x868C9E), P(0x82899B), P(0x7F8597), P(0x7E8496), P(0x7F8597), P(0x82899B),
+  P(0x868C9E), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F),
+  P(0x898FA1), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F), P(0x898FA1),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x898FA1), P(0x8A90A1), P(0xC1C5CE), P(0xEDEEF1), P(0xFCFCFD), P(0xEDEEF1),
+  P(0xC1C5CE), P(0x8A90A1), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x898FA1), P(0x8A90A1), P(0xE2E3E7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xE2E3E7), P(0x8A90A1), P(0x898FA1), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x868C9E), P(0xC0C3CC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBFC2CB), P(0x868C9E),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x898FA1), P(0x82899B), P(0xECEDF0), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xEDEEF0),
+  P(0x82899B), P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0xDBDCDE), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE0E0E1), P(0xD2D3D6), P(0xFDFDFE), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFDFDFE), P(0xD2D3D6), P(0xE0E0E1), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6), P(0xE6E6E6),
+  P(0xDBDCDE), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x5E6678), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x555D6F), P(0x505869), P(0xE6E7E9),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xE7E8EA), P(0x505869), P(0x555D6F), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x5E6678), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x878D9F), P(0x7F8597),
+  P(0xBABEC7), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xB9BDC6), P(0x7F8597), P(0x878D9F), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x888EA0), P(0x858B9D), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1),
+  P(0x82899B), P(0x7C8394), P(0xDEDFE3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xDEDFE3), P(0x7C8394), P(0x82899B), P(0x898FA1),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x848B9C), P(0x818799),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x868C9E), P(0x7E8496), P(0x7A8091), P(0xB6BAC3), P(0xEAEBEE),
+  P(0xFBFCFC), P(0xEAEBEE), P(0xB6BAC3), P(0x7A8091), P(0x7E8496), P(0x868C9E),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x83899A),
+  P(0x8C92A0), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x858B9D), P(0x7E8496), P(0x777E90),
+  P(0x72798B), P(0x717789), P(0x72798B), P(0x777E90), P(0x7E8496), P(0x858B9D),
+  P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8E94A2), P(0xBFC2CA), P(0x868C9E), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x898FA1), P(0x868C9E),
+  P(0x82899B), P(0x7F8597), P(0x7E8496), P(0x7F8597), P(0x82899B), P(0x868C9E),
+  P(0x898FA1), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x858B9D), P(0xC2C5CC), P(0xF9F9FA), P(0x757B8C), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8A90A2), P(0x898FA1), P(0x878D9F), P(0x878D9F), P(0x878D9F), P(0x898FA1),
+  P(0x8A90A2), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x757B8C), P(0xFBFBFC), P(0xFFFFFF), P(0xC5C8CE), P(0x767D8F),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x737A8C), P(0xC7CAD0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xA1A6B0), P(0x767D8F), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x737A8C), P(0xA5A9B3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFDFDFD), P(0x9BA0AA), P(0x697183), P(0x848A9C), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x848A9C), P(0x687082), P(0x9DA1AC), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xC7C9CF), P(0x6D7484),
+  P(0x6A7183), P(0x7A8193), P(0x858B9D), P(0x8A90A2), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8B91A3),
+  P(0x8B91A3), P(0x8B91A3), P(0x8B91A3), P(0x8A90A2), P(0x858B9D), P(0x7A8193),
+  P(0x6A7183), P(0x6F7686), P(0xC7C9CF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFBFBFC), P(0xC0C3CA), P(0x8C919E), P(0x6F7685), P(0x5E6677), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x586072),
+  P(0x586072), P(0x586072), P(0x586072), P(0x586072), P(0x596173), P(0x6B7282),
+  P(0x9297A3), P(0xC5C8CE), P(0xFBFBFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::SettingsIcon = &image;
@@ -29,4 +29,14 @@ double CurveViewCursor::clipped(double x, bool canBeInfinite) {
   return clippedX;
 }
 
+void CurveViewCursor::serialize(SnapshotWriter * writer) {
+  writer->write(m_x);
+  writer->write(m_y);
+}
+
+void CurveViewCursor::deserialize(SnapshotReader * reader) {
+  m_x = reader->read<double>();
+  m_y = reader->read<double>();
+}
+
 }
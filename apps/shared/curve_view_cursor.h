@@ -1,6 +1,8 @@
 #ifndef SHARED_CURVE_VIEW_CURSOR_H
 #define SHARED_CURVE_VIEW_CURSOR_H
 
+#include "snapshot_serializer.h"
+
 namespace Shared {
 
 class CurveViewCursor {
@@ -9,6 +11,8 @@ public:
   double x();
   double y();
   void moveTo(double x, double y);
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
 private:
   static double clipped(double f, bool canBeInfinite);
   constexpr static double k_maxFloat = 1E+8;
@@ -82,4 +82,19 @@ double FloatPairStore::defaultValue(int i) {
   return 0.0;
 }
 
+void FloatPairStore::serialize(SnapshotWriter * writer) {
+  writer->write(m_numberOfPairs);
+  for (int i = 0; i < 2; i++) {
+    writer->writeBytes(m_data[i], m_numberOfPairs*sizeof(double));
+  }
+}
+
+void FloatPairStore::deserialize(SnapshotReader * reader) {
+  m_numberOfPairs = reader->read<int>();
+  assert(m_numberOfPairs >= 0 && m_numberOfPairs <= k_maxNumberOfPairs);
+  for (int i = 0; i < 2; i++) {
+    reader->readBytes(m_data[i], m_numberOfPairs*sizeof(double));
+  }
+}
+
 }
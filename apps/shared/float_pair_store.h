@@ -2,6 +2,7 @@
 #define SHARED_FLOAT_PAIR_STORE_H
 
 #include <stdint.h>
+#include "snapshot_serializer.h"
 
 namespace Shared {
 
@@ -18,6 +19,8 @@ public:
   void resetColumn(int i);
   double sumOfColumn(int i);
   uint32_t storeChecksum();
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
   constexpr static int k_maxNumberOfPairs = 100;
 protected:
   virtual double defaultValue(int i);
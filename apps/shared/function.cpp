@@ -9,10 +9,10 @@ namespace Shared {
 
 Function::Function(const char * name, KDColor color) :
   m_expression(nullptr),
-  m_text{0},
   m_name(name),
-  m_color(color),
   m_layout(nullptr),
+  m_text(),
+  m_color(color),
   m_active(true)
 {
 }
@@ -22,20 +22,31 @@ Function& Function::operator=(const Function& other) {
   m_color = other.m_color;
   m_name = other.m_name;
   m_active = other.m_active;
-  setContent(other.m_text);
+  setContent(other.text());
   return *this;
 }
 
 uint32_t Function::checksum() {
   char data[k_dataLengthInBytes/sizeof(char)] = {};
-  strlcpy(data, m_text, TextField::maxBufferSize());
+  strlcpy(data, text(), TextField::maxBufferSize());
   data[k_dataLengthInBytes-2] = m_name != nullptr ? m_name[0] : 0;
   data[k_dataLengthInBytes-1] = m_active ? 1 : 0;
   return Ion::crc32((uint32_t *)data, k_dataLengthInBytes/sizeof(uint32_t));
 }
 
-void Function::setContent(const char * c) {
-  strlcpy(m_text, c, sizeof(m_text));
+void Function::moveFrom(Function * other) {
+  tidy();
+  m_color = other->m_color;
+  m_name = other->m_name;
+  m_active = other->m_active;
+  m_text.moveFrom(&other->m_text);
+  other->tidy();
+}
+
+bool Function::setContent(const char * c) {
+  if (!m_text.setText(c)) {
+    return false;
+  }
   if (m_layout != nullptr) {
     delete m_layout;
     m_layout = nullptr;
@@ -44,6 +55,7 @@ void Function::setContent(const char * c) {
     delete m_expression;
     m_expression = nullptr;
   }
+  return true;
 }
 
 void Function::setColor(KDColor color) {
@@ -62,7 +74,7 @@ Function::~Function() {
 }
 
 const char * Function::text() const {
-  return m_text;
+  return m_text.text();
 }
 
 const char * Function::name() const {
@@ -71,7 +83,7 @@ const char * Function::name() const {
 
 Poincare::Expression * Function::expression() const {
   if (m_expression == nullptr) {
-    m_expression = Expression::parse(m_text);
+    m_expression = Expression::parse(text());
   }
   return m_expression;
 }
@@ -84,7 +96,7 @@ Poincare::ExpressionLayout * Function::layout() {
 }
 
 bool Function::isDefined() {
-  return m_text[0] != 0;
+  return text()[0] != 0;
 }
 
 bool Function::isActive() {
@@ -96,7 +108,7 @@ void Function::setActive(bool active) {
 }
 
 bool Function::isEmpty() {
-  return m_text[0] == 0;
+  return text()[0] == 0;
 }
 
 template<typename T>
@@ -119,6 +131,21 @@ void Function::tidy() {
   }
 }
 
+void Function::serialize(SnapshotWriter * writer) {
+  // Names are string literals, which don't move
+  writer->write(m_name);
+  m_text.serialize(writer);
+  writer->write(m_color);
+  writer->write(m_active);
+}
+
+void Function::deserialize(SnapshotReader * reader) {
+  m_name = reader->read<const char *>();
+  m_text.deserialize(reader);
+  m_color = reader->read<KDColor>();
+  m_active = reader->read<bool>();
+}
+
 }
 
 template float Shared::Function::templatedEvaluateAtAbscissa<float>(float, Poincare::Context*) const;
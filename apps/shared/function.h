@@ -4,6 +4,7 @@
 #include <poincare.h>
 #include <kandinsky.h>
 #include <escher.h>
+#include "text_record.h"
 
 namespace Shared {
 
@@ -25,7 +26,11 @@ public:
   bool isActive();
   void setActive(bool active);
   virtual bool isEmpty();
-  virtual void setContent(const char * c);
+  /* Returns false, leaving the text unchanged, if the record store is full */
+  virtual bool setContent(const char * c);
+  /* Moves other into this function, leaving its texts empty. Unlike a copy,
+   * this never needs room in the record store. */
+  void moveFrom(Function * other);
   void setColor(KDColor m_color);
   virtual float evaluateAtAbscissa(float x, Poincare::Context * context) const {
     return templatedEvaluateAtAbscissa(x, context);
@@ -34,16 +39,19 @@ public:
     return templatedEvaluateAtAbscissa(x, context);
   }
   virtual void tidy();
+  virtual void serialize(SnapshotWriter * writer);
+  virtual void deserialize(SnapshotReader * reader);
 private:
   constexpr static size_t k_dataLengthInBytes = (TextField::maxBufferSize()+2)*sizeof(char)+2;
   static_assert((k_dataLengthInBytes & 0x3) == 0, "The function data size is not a multiple of 4 bytes (cannot compute crc)"); // Assert that dataLengthInBytes is a multiple of 4
   template<typename T> T templatedEvaluateAtAbscissa(T x, Poincare::Context * context) const;
   virtual char symbol() const = 0;
+  // Pointers first, then the two-byte and one-byte members, to avoid padding
   mutable Poincare::Expression * m_expression;
-  char m_text[TextField::maxBufferSize()];
   const char * m_name;
-  KDColor m_color;
   Poincare::ExpressionLayout * m_layout;
+  TextRecord m_text;
+  KDColor m_color;
   bool m_active;
 };
 
@@ -1,5 +1,6 @@
 #include "function_app.h"
 #include "../apps_container.h"
+#include <assert.h>
 
 using namespace Poincare;
 
@@ -46,6 +47,32 @@ void FunctionApp::Snapshot::reset() {
   setActiveTab(0);
 }
 
+size_t FunctionApp::Snapshot::serialize(char * buffer) {
+  SnapshotWriter writer(buffer);
+  m_cursor.serialize(&writer);
+  m_interval.serialize(&writer);
+  writer.write(m_modelVersion);
+  writer.write(m_rangeVersion);
+  writer.write(m_angleUnitVersion);
+  writer.write((int8_t)activeTab());
+  writer.write((int8_t)selectedTab());
+  serializeModel(&writer);
+  return writer.size();
+}
+
+void FunctionApp::Snapshot::deserialize(const char * buffer, size_t size) {
+  SnapshotReader reader(buffer, size);
+  m_cursor.deserialize(&reader);
+  m_interval.deserialize(&reader);
+  m_modelVersion = reader.read<uint32_t>();
+  m_rangeVersion = reader.read<uint32_t>();
+  m_angleUnitVersion = reader.read<Expression::AngleUnit>();
+  setActiveTab(reader.read<int8_t>());
+  setSelectedTab(reader.read<int8_t>());
+  deserializeModel(&reader);
+  assert(reader.isAtEnd());
+}
+
 FunctionApp::FunctionApp(Container * container, Snapshot * snapshot, ViewController * rootViewController) :
   TextFieldDelegateApp(container, snapshot, rootViewController)
 {
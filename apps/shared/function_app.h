@@ -21,7 +21,12 @@ public:
     Poincare::Expression::AngleUnit * angleUnitVersion();
     Interval * interval();
     void reset() override;
+    size_t serialize(char * buffer) override;
+    void deserialize(const char * buffer, size_t size) override;
   protected:
+    // The function store and the graph range of the app
+    virtual void serializeModel(SnapshotWriter * writer) = 0;
+    virtual void deserializeModel(SnapshotReader * reader) = 0;
     CurveViewCursor m_cursor;
     Interval m_interval;
   private:
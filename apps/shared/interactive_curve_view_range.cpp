@@ -235,4 +235,14 @@ float InteractiveCurveViewRange::clipped(float x, bool isMax) {
   return clippedX;
 }
 
+void InteractiveCurveViewRange::serialize(SnapshotWriter * writer) {
+  MemoizedCurveViewRange::serialize(writer);
+  writer->write(m_yAuto);
+}
+
+void InteractiveCurveViewRange::deserialize(SnapshotReader * reader) {
+  MemoizedCurveViewRange::deserialize(reader);
+  m_yAuto = reader->read<bool>();
+}
+
 }
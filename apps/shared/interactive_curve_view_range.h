@@ -22,6 +22,9 @@ public:
   void setYMin(float f) override;
   void setYMax(float f) override;
   void setYAuto(bool yAuto);
+  // The cursor and the delegate are set by the snapshot's constructor
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
 
   // Window
   void zoom(float ratio, float x, float y);
@@ -82,4 +82,28 @@ void Interval::computeElements() {
   m_needCompute = false;
 }
 
+void Interval::serialize(SnapshotWriter * writer) {
+  writer->write(m_start);
+  writer->write(m_end);
+  writer->write(m_step);
+  writer->write(m_needCompute);
+  // Elements may have been edited one by one, so they are kept as well
+  if (!m_needCompute) {
+    writer->write(m_numberOfElements);
+    writer->writeBytes(m_intervalBuffer, m_numberOfElements*sizeof(double));
+  }
+}
+
+void Interval::deserialize(SnapshotReader * reader) {
+  m_start = reader->read<double>();
+  m_end = reader->read<double>();
+  m_step = reader->read<double>();
+  m_needCompute = reader->read<bool>();
+  if (!m_needCompute) {
+    m_numberOfElements = reader->read<int>();
+    assert(m_numberOfElements >= 0 && m_numberOfElements <= k_maxNumberOfElements);
+    reader->readBytes(m_intervalBuffer, m_numberOfElements*sizeof(double));
+  }
+}
+
 }
@@ -1,6 +1,8 @@
 #ifndef SHARED_VALUES_INTERVAL_H
 #define SHARED_VALUES_INTERVAL_H
 
+#include "snapshot_serializer.h"
+
 namespace Shared {
 
 class Interval {
@@ -18,6 +20,8 @@ public:
   void setEnd(double f);
   void setStep(double f);
   void setElement(int i, double f);
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
   // TODO: decide the max number of elements after optimization
   constexpr static int k_maxNumberOfElements = 100;
 private:
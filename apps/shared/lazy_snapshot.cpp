@@ -0,0 +1,99 @@
+#include "lazy_snapshot.h"
+extern "C" {
+#include <assert.h>
+#include <stdlib.h>
+}
+
+namespace Shared {
+
+int LazySnapshot::s_numberOfConstructedSnapshots = 0;
+
+App::Snapshot * LazySnapshot::snapshot() {
+  if (m_snapshot == nullptr) {
+    uint32_t loadStart = Ion::Timing::microseconds();
+    m_snapshot = load();
+    if (m_snapshot != nullptr && m_constructionRank == 0) {
+      m_constructionRank = ++s_numberOfConstructedSnapshots;
+      m_constructionTime = Ion::Timing::microseconds() - loadStart;
+    }
+  }
+  return m_snapshot;
+}
+
+void LazySnapshot::reset() {
+  if (m_snapshot != nullptr) {
+    m_snapshot->reset();
+  }
+}
+
+bool SnapshotArena::acquire(CompactableLazySnapshot * owner) {
+  if (m_occupant != nullptr && m_occupant != owner) {
+    if (!m_occupant->compact()) {
+      return false;
+    }
+  }
+  m_occupant = owner;
+  return true;
+}
+
+void SnapshotArena::release(CompactableLazySnapshot * owner) {
+  if (m_occupant == owner) {
+    m_occupant = nullptr;
+  }
+}
+
+CompactableLazySnapshot::~CompactableLazySnapshot() {
+  // The state is only left here if the snapshot could not be expanded
+  free(m_compactData);
+  m_arena->release(this);
+}
+
+void CompactableLazySnapshot::reset() {
+  if (isCompacted()) {
+    m_needsReset = true;
+    return;
+  }
+  LazySnapshot::reset();
+}
+
+App::Snapshot * CompactableLazySnapshot::load() {
+  assert(snapshotSize() <= m_arena->size());
+  if (!m_arena->acquire(this)) {
+    return nullptr;
+  }
+  App::Snapshot * snapshot = construct();
+  if (!isCompacted()) {
+    return snapshot;
+  }
+  snapshot->deserialize(m_compactData, m_compactSize);
+  free(m_compactData);
+  m_compactData = nullptr;
+  m_compactSize = 0;
+  m_isCompacted = false;
+  if (m_needsReset) {
+    m_needsReset = false;
+    snapshot->reset();
+  }
+  return snapshot;
+}
+
+bool CompactableLazySnapshot::compact() {
+  assert(m_snapshot != nullptr && !isCompacted());
+  size_t compactSize = m_snapshot->serialize(nullptr);
+  char * compactData = nullptr;
+  if (compactSize > 0) {
+    compactData = (char *)malloc(compactSize);
+    if (compactData == nullptr) {
+      return false;
+    }
+  }
+  m_snapshot->serialize(compactData);
+  destroy();
+  m_snapshot = nullptr;
+  m_compactData = compactData;
+  m_compactSize = compactSize;
+  m_isCompacted = true;
+  return true;
+}
+
+}
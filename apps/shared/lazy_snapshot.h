@@ -0,0 +1,172 @@
+#ifndef SHARED_LAZY_SNAPSHOT_H
+#define SHARED_LAZY_SNAPSHOT_H
+
+#include <escher.h>
+#include <stddef.h>
+#include <new>
+
+namespace Shared {
+
+/* A LazySnapshot reserves the room of an app's snapshot but only constructs
+ * the snapshot, in place, the first time it is asked for, i.e. when the app is
+ * first launched. Apps that are never opened don't pay for their stores and
+ * ranges at boot. The descriptor doesn't need the snapshot, so the home screen
+ * can list all the apps without constructing any of them.
+ * Each construction is recorded: its rank among all the snapshot constructions,
+ * the time it took and the size of the constructed snapshot. */
+
+class LazySnapshot {
+public:
+  LazySnapshot() :
+    m_snapshot(nullptr),
+    m_constructionRank(0),
+    m_constructionTime(0)
+  {
+  }
+  LazySnapshot(const LazySnapshot& other) = delete;
+  LazySnapshot& operator=(const LazySnapshot& other) = delete;
+  App::Snapshot * snapshot();
+  // Does not construct the snapshot: false if it isn't in memory
+  bool holds(const App::Snapshot * snapshot) const { return snapshot != nullptr && snapshot == m_snapshot; }
+  bool isConstructed() const { return m_constructionRank > 0; }
+  /* Resetting a snapshot that was never constructed is a no-op: it will be
+   * constructed in its initial state anyway. */
+  virtual void reset();
+  virtual App::Descriptor * descriptor() = 0;
+  virtual size_t snapshotSize() const = 0;
+  // 1 for the first snapshot constructed, 0 if not constructed yet
+  int constructionRank() const { return m_constructionRank; }
+  // In microseconds, 0 if not constructed yet
+  uint32_t constructionTime() const { return m_constructionTime; }
+  static int numberOfConstructedSnapshots() { return s_numberOfConstructedSnapshots; }
+protected:
+  /* Returns the snapshot in memory, constructing it if it is asked for the
+   * first time. Returns nullptr if there was no room for it. */
+  virtual App::Snapshot * load() = 0;
+  App::Snapshot * m_snapshot;
+private:
+  static int s_numberOfConstructedSnapshots;
+  int m_constructionRank;
+  uint32_t m_constructionTime;
+};
+
+template<class A>
+class AppLazySnapshot : public LazySnapshot {
+public:
+  ~AppLazySnapshot() {
+    if (m_snapshot != nullptr) {
+      typedSnapshot()->~Snapshot();
+    }
+  }
+  typename A::Descriptor * descriptor() override {
+    static typename A::Descriptor descriptor;
+    return &descriptor;
+  }
+  size_t snapshotSize() const override { return sizeof(typename A::Snapshot); }
+private:
+  App::Snapshot * load() override {
+    return new (m_storage) typename A::Snapshot();
+  }
+  typename A::Snapshot * typedSnapshot() { return reinterpret_cast<typename A::Snapshot *>(m_storage); }
+  alignas(typename A::Snapshot) char m_storage[sizeof(typename A::Snapshot)];
+};
+
+/* The snapshots of the apps with the largest stores share one arena instead of
+ * each reserving its own room. Only one of them is in the arena at a time. When
+ * another one is needed, the snapshot in the arena is compacted: it serializes
+ * the state it can't rebuild into a heap buffer, see App::Snapshot::serialize,
+ * and is destroyed. Texts are records of the shared store, so that state is
+ * mostly small values and record handles. When its app is launched again, the
+ * snapshot is constructed back in the arena and deserializes its state.
+ * Apps are only launched from the home screen, so the snapshot in the arena is
+ * never the active app's one when another snapshot asks for the arena. */
+
+class CompactableLazySnapshot;
+
+class SnapshotArena {
+public:
+  SnapshotArena(char * storage, size_t size) :
+    m_storage(storage),
+    m_size(size),
+    m_occupant(nullptr)
+  {
+  }
+  SnapshotArena(const SnapshotArena& other) = delete;
+  SnapshotArena& operator=(const SnapshotArena& other) = delete;
+  char * storage() const { return m_storage; }
+  size_t size() const { return m_size; }
+  /* Compacts the snapshot in the arena, if any, and hands the arena to owner.
+   * Returns false if the current snapshot could not be compacted. */
+  bool acquire(CompactableLazySnapshot * owner);
+  void release(CompactableLazySnapshot * owner);
+private:
+  char * m_storage;
+  size_t m_size;
+  CompactableLazySnapshot * m_occupant;
+};
+
+class CompactableLazySnapshot : public LazySnapshot {
+  friend class SnapshotArena;
+public:
+  CompactableLazySnapshot(SnapshotArena * arena) :
+    LazySnapshot(),
+    m_arena(arena),
+    m_compactData(nullptr),
+    m_compactSize(0),
+    m_isCompacted(false),
+    m_needsReset(false)
+  {
+  }
+  ~CompactableLazySnapshot();
+  bool isCompacted() const { return m_isCompacted; }
+  // Size of the serialized state, 0 if the snapshot is not compacted
+  size_t compactSize() const { return m_compactSize; }
+  /* A compacted snapshot is reset when it is expanded: the arena may hold the
+   * active app's snapshot in the meantime. */
+  void reset() override;
+protected:
+  virtual App::Snapshot * construct() = 0;
+  virtual void destroy() = 0;
+  char * arenaStorage() const { return m_arena->storage(); }
+private:
+  App::Snapshot * load() override;
+  bool compact();
+  SnapshotArena * m_arena;
+  char * m_compactData;
+  size_t m_compactSize;
+  bool m_isCompacted;
+  bool m_needsReset;
+};
+
+template<class A>
+class AppCompactableLazySnapshot : public CompactableLazySnapshot {
+public:
+  using CompactableLazySnapshot::CompactableLazySnapshot;
+  ~AppCompactableLazySnapshot() {
+    /* A compacted snapshot is expanded to be destroyed, so that the records
+     * it holds go back to the store. */
+    if (isCompacted()) {
+      snapshot();
+    }
+    if (m_snapshot != nullptr) {
+      destroy();
+    }
+  }
+  typename A::Descriptor * descriptor() override {
+    static typename A::Descriptor descriptor;
+    return &descriptor;
+  }
+  size_t snapshotSize() const override { return sizeof(typename A::Snapshot); }
+private:
+  App::Snapshot * construct() override {
+    return new (arenaStorage()) typename A::Snapshot();
+  }
+  void destroy() override {
+    typedSnapshot()->~Snapshot();
+  }
+  typename A::Snapshot * typedSnapshot() { return reinterpret_cast<typename A::Snapshot *>(arenaStorage()); }
+};
+
+}
+
+#endif
@@ -85,4 +85,22 @@ void MemoizedCurveViewRange::setYMax(float yMax) {
   m_yGridUnit = computeGridUnit(Axis::Y, m_yMin, m_yMax);
 }
 
+void MemoizedCurveViewRange::serialize(SnapshotWriter * writer) {
+  writer->write(m_xMin);
+  writer->write(m_xMax);
+  writer->write(m_yMin);
+  writer->write(m_yMax);
+  writer->write(m_xGridUnit);
+  writer->write(m_yGridUnit);
+}
+
+void MemoizedCurveViewRange::deserialize(SnapshotReader * reader) {
+  m_xMin = reader->read<float>();
+  m_xMax = reader->read<float>();
+  m_yMin = reader->read<float>();
+  m_yMax = reader->read<float>();
+  m_xGridUnit = reader->read<float>();
+  m_yGridUnit = reader->read<float>();
+}
+
 }
@@ -2,6 +2,7 @@
 #define SHARED_MEMOIZED_CURVE_VIEW_RANGE_H
 
 #include "curve_view_range.h"
+#include "snapshot_serializer.h"
 
 namespace Shared {
 
@@ -19,6 +20,8 @@ public:
   virtual void setXMax(float f);
   virtual void setYMin(float f);
   virtual void setYMax(float f);
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
 
 protected:
   // Window bounds of the data
@@ -0,0 +1,116 @@
+#include "record_store.h"
+#include <string.h>
+#include <assert.h>
+
+namespace Shared {
+
+static RecordStore sRecordStore;
+
+RecordStore * RecordStore::sharedRecordStore() {
+  return &sRecordStore;
+}
+
+RecordStore::Handle RecordStore::create(size_t size) {
+  assert(size > 0);
+  if (size > availableSize()) {
+    return k_invalidHandle;
+  }
+  for (int i = 0; i < k_maxNumberOfRecords; i++) {
+    Record * r = &m_records[i];
+    if (!r->isUsed) {
+      r->offset = m_usedSize;
+      r->size = size;
+      r->isUsed = true;
+      memset(m_pool + m_usedSize, 0, size);
+      m_usedSize += size;
+      return i+1;
+    }
+  }
+  return k_invalidHandle;
+}
+
+void RecordStore::destroy(Handle handle) {
+  Record * r = record(handle);
+  char * end = m_pool + r->offset + r->size;
+  memmove(m_pool + r->offset, end, m_pool + m_usedSize - end);
+  for (int i = 0; i < k_maxNumberOfRecords; i++) {
+    if (m_records[i].isUsed && m_records[i].offset > r->offset) {
+      m_records[i].offset -= r->size;
+    }
+  }
+  m_usedSize -= r->size;
+  r->isUsed = false;
+}
+
+bool RecordStore::resize(Handle handle, size_t size) {
+  assert(size > 0);
+  Record * r = record(handle);
+  if (size > r->size && size - r->size > availableSize()) {
+    return false;
+  }
+  int delta = (int)size - (int)r->size;
+  char * end = m_pool + r->offset + r->size;
+  memmove(end + delta, end, m_pool + m_usedSize - end);
+  for (int i = 0; i < k_maxNumberOfRecords; i++) {
+    if (m_records[i].isUsed && m_records[i].offset > r->offset) {
+      m_records[i].offset += delta;
+    }
+  }
+  r->size = size;
+  m_usedSize += delta;
+  return true;
+}
+
+bool RecordStore::setData(Handle handle, const void * data, size_t size) {
+  const char * source = (const char *)data;
+  const Record * r = record(handle);
+  /* Data stored after this record moves along with it when it is resized */
+  bool sourceMoves = source >= m_pool + r->offset + r->size && source < m_pool + m_usedSize;
+  int delta = (int)size - (int)r->size;
+  if (!resize(handle, size)) {
+    return false;
+  }
+  if (sourceMoves) {
+    source += delta;
+  }
+  memmove(m_pool + r->offset, source, size);
+  return true;
+}
+
+char * RecordStore::data(Handle handle) {
+  return m_pool + record(handle)->offset;
+}
+
+const char * RecordStore::data(Handle handle) const {
+  return m_pool + record(handle)->offset;
+}
+
+size_t RecordStore::size(Handle handle) const {
+  return record(handle)->size;
+}
+
+size_t RecordStore::availableSize() const {
+  return k_poolSize - m_usedSize;
+}
+
+int RecordStore::numberOfRecords() const {
+  int numberOfRecords = 0;
+  for (int i = 0; i < k_maxNumberOfRecords; i++) {
+    numberOfRecords += m_records[i].isUsed;
+  }
+  return numberOfRecords;
+}
+
+RecordStore::Record * RecordStore::record(Handle handle) {
+  assert(handle != k_invalidHandle && handle <= k_maxNumberOfRecords);
+  assert(m_records[handle-1].isUsed);
+  return &m_records[handle-1];
+}
+
+const RecordStore::Record * RecordStore::record(Handle handle) const {
+  assert(handle != k_invalidHandle && handle <= k_maxNumberOfRecords);
+  assert(m_records[handle-1].isUsed);
+  return &m_records[handle-1];
+}
+
+}
@@ -0,0 +1,57 @@
+#ifndef SHARED_RECORD_STORE_H
+#define SHARED_RECORD_STORE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* RecordStore keeps variable-length records in a fixed pool shared by all the
+ * apps. Records are packed at the beginning of the pool: growing, shrinking or
+ * destroying a record moves the ones after it, so the pool never fragments and
+ * all the free room is in one block at its end.
+ * Records are referred to by handles, which stay valid when records move. The
+ * pointers returned by data() are only valid until the store is modified. */
+
+class RecordStore {
+public:
+  typedef uint16_t Handle;
+  constexpr static Handle k_invalidHandle = 0;
+  constexpr static size_t k_poolSize = 8192;
+  constexpr static int k_maxNumberOfRecords = 64;
+  constexpr RecordStore() :
+    m_pool{},
+    m_records{},
+    m_usedSize(0)
+  {
+  }
+  static RecordStore * sharedRecordStore();
+  /* Returns k_invalidHandle if there isn't enough room. New records are
+   * zero-filled. */
+  Handle create(size_t size);
+  void destroy(Handle handle);
+  bool resize(Handle handle, size_t size);
+  /* Resizes the record and copies data into it. data may point inside the
+   * pool, even to a record that moves because of the resizing. */
+  bool setData(Handle handle, const void * data, size_t size);
+  char * data(Handle handle);
+  const char * data(Handle handle) const;
+  size_t size(Handle handle) const;
+  size_t availableSize() const;
+  int numberOfRecords() const;
+private:
+  struct Record {
+    uint16_t offset;
+    uint16_t size;
+    bool isUsed;
+  };
+  Record * record(Handle handle);
+  const Record * record(Handle handle) const;
+  char m_pool[k_poolSize];
+  Record m_records[k_maxNumberOfRecords];
+  uint16_t m_usedSize;
+};
+
+}
+
+#endif
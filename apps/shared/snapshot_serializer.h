@@ -0,0 +1,67 @@
+#ifndef SHARED_SNAPSHOT_SERIALIZER_H
+#define SHARED_SNAPSHOT_SERIALIZER_H
+
+#include <stddef.h>
+#include <string.h>
+extern "C" {
+#include <assert.h>
+}
+
+namespace Shared {
+
+/* The state of an inactive snapshot is written field by field, see
+ * App::Snapshot::serialize. Only plain values are written: the snapshot builds
+ * its pointers, expressions and layouts again. A writer without buffer only
+ * adds up the size of the fields. */
+
+class SnapshotWriter {
+public:
+  SnapshotWriter(char * buffer) :
+    m_buffer(buffer),
+    m_size(0)
+  {
+  }
+  bool isSizing() const { return m_buffer == nullptr; }
+  size_t size() const { return m_size; }
+  template<typename T> void write(const T & value) {
+    writeBytes(&value, sizeof(T));
+  }
+  void writeBytes(const void * data, size_t size) {
+    if (m_buffer != nullptr) {
+      memcpy(m_buffer + m_size, data, size);
+    }
+    m_size += size;
+  }
+private:
+  char * m_buffer;
+  size_t m_size;
+};
+
+class SnapshotReader {
+public:
+  SnapshotReader(const char * buffer, size_t size) :
+    m_buffer(buffer),
+    m_size(size),
+    m_offset(0)
+  {
+  }
+  bool isAtEnd() const { return m_offset == m_size; }
+  template<typename T> T read() {
+    T value;
+    readBytes(&value, sizeof(T));
+    return value;
+  }
+  void readBytes(void * data, size_t size) {
+    assert(m_offset + size <= m_size);
+    memcpy(data, m_buffer + m_offset, size);
+    m_offset += size;
+  }
+private:
+  const char * m_buffer;
+  size_t m_size;
+  size_t m_offset;
+};
+
+}
+
+#endif
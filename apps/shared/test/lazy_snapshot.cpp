@@ -0,0 +1,144 @@
+#include <quiz.h>
+#include <assert.h>
+#include <string.h>
+#include "../lazy_snapshot.h"
+#include "../text_record.h"
+
+using namespace Shared;
+
+static int sNumberOfConstructions = 0;
+static int sNumberOfResets = 0;
+static int sNumberOfDestructions = 0;
+
+class TestApp {
+public:
+  class Descriptor : public ::App::Descriptor {
+  };
+  class Snapshot : public ::App::Snapshot {
+  public:
+    Snapshot() : m_value(42) { sNumberOfConstructions++; }
+    ~Snapshot() { sNumberOfDestructions++; }
+    ::App * unpack(Container * container) override { return nullptr; }
+    void reset() override { sNumberOfResets++; }
+    Descriptor * descriptor() override {
+      static Descriptor descriptor;
+      return &descriptor;
+    }
+    int m_value;
+  };
+};
+
+QUIZ_CASE(shared_lazy_snapshot_constructs_on_first_use) {
+  {
+    AppLazySnapshot<TestApp> a;
+    AppLazySnapshot<TestApp> b;
+    assert(a.descriptor() != nullptr);
+    assert(a.snapshotSize() == sizeof(TestApp::Snapshot));
+    a.reset();
+    assert(!a.isConstructed() && a.constructionRank() == 0 && a.constructionTime() == 0);
+    assert(sNumberOfConstructions == 0 && sNumberOfResets == 0);
+    assert(!a.holds(nullptr));
+
+    int initialRank = LazySnapshot::numberOfConstructedSnapshots();
+    ::App::Snapshot * s = b.snapshot();
+    assert(sNumberOfConstructions == 1 && static_cast<TestApp::Snapshot *>(s)->m_value == 42);
+    assert(b.snapshot() == s && sNumberOfConstructions == 1);
+    assert(b.holds(s) && !a.holds(s));
+    assert(b.constructionRank() == initialRank + 1);
+    a.snapshot();
+    assert(a.constructionRank() == initialRank + 2);
+
+    a.reset();
+    assert(sNumberOfResets == 1);
+  }
+  assert(sNumberOfDestructions == 2);
+}
+
+static int sNumberOfStoreDestructions = 0;
+
+class StoreApp {
+public:
+  class Descriptor : public ::App::Descriptor {
+  };
+  class Snapshot : public ::App::Snapshot {
+  public:
+    Snapshot() : m_self(this), m_values{}, m_numberOfValues(0) {}
+    ~Snapshot() { sNumberOfStoreDestructions++; }
+    ::App * unpack(Container * container) override { return nullptr; }
+    void reset() override {
+      m_numberOfValues = 0;
+      m_text.setText("");
+    }
+    Descriptor * descriptor() override {
+      static Descriptor descriptor;
+      return &descriptor;
+    }
+    size_t serialize(char * buffer) override {
+      SnapshotWriter writer(buffer);
+      writer.write(m_numberOfValues);
+      writer.writeBytes(m_values, m_numberOfValues*sizeof(int));
+      m_text.serialize(&writer);
+      return writer.size();
+    }
+    void deserialize(const char * buffer, size_t size) override {
+      SnapshotReader reader(buffer, size);
+      m_numberOfValues = reader.read<int>();
+      reader.readBytes(m_values, m_numberOfValues*sizeof(int));
+      m_text.deserialize(&reader);
+      assert(reader.isAtEnd());
+    }
+    Snapshot * m_self;
+    int m_values[200];
+    int m_numberOfValues;
+    TextRecord m_text;
+  };
+};
+
+QUIZ_CASE(shared_lazy_snapshot_compacts_inactive_snapshots) {
+  RecordStore * records = RecordStore::sharedRecordStore();
+  int initialNumberOfRecords = records->numberOfRecords();
+  {
+    alignas(double) char storage[sizeof(StoreApp::Snapshot)];
+    SnapshotArena arena(storage, sizeof(storage));
+    AppCompactableLazySnapshot<StoreApp> a(&arena);
+    AppCompactableLazySnapshot<StoreApp> b(&arena);
+
+    StoreApp::Snapshot * s = static_cast<StoreApp::Snapshot *>(a.snapshot());
+    assert(s->m_self == s);
+    s->m_values[0] = 7;
+    s->m_values[2] = 8;
+    s->m_numberOfValues = 3;
+    assert(s->m_text.setText("1+2"));
+
+    // b takes the arena, a is serialized and destroyed
+    StoreApp::Snapshot * t = static_cast<StoreApp::Snapshot *>(b.snapshot());
+    assert(sNumberOfStoreDestructions == 1);
+    assert(t == s && t->m_numberOfValues == 0 && strcmp(t->m_text.text(), "") == 0);
+    assert(a.isCompacted() && !b.isCompacted());
+    assert(!a.holds(s) && b.holds(t));
+    assert(a.compactSize() == sizeof(int) + 3*sizeof(int) + sizeof(RecordStore::Handle));
+    assert(a.isConstructed());
+    // The text was handed over, not destroyed
+    assert(records->numberOfRecords() == initialNumberOfRecords + 1);
+    t->m_numberOfValues = 1;
+    assert(t->m_text.setText("3"));
+
+    // a is constructed again with its state
+    s = static_cast<StoreApp::Snapshot *>(a.snapshot());
+    assert(sNumberOfStoreDestructions == 2);
+    assert(b.isCompacted() && !a.isCompacted());
+    assert(s->m_self == s && s->m_values[0] == 7 && s->m_values[2] == 8 && s->m_numberOfValues == 3);
+    assert(strcmp(s->m_text.text(), "1+2") == 0);
+    assert(records->numberOfRecords() == initialNumberOfRecords + 2);
+
+    // Resetting a compacted snapshot is deferred until it is expanded
+    b.reset();
+    assert(s->m_numberOfValues == 3);
+    t = static_cast<StoreApp::Snapshot *>(b.snapshot());
+    assert(t->m_numberOfValues == 0 && strcmp(t->m_text.text(), "") == 0);
+    assert(records->numberOfRecords() == initialNumberOfRecords + 1);
+  }
+  // The compacted snapshot is destroyed as well, and gives its text back
+  assert(sNumberOfStoreDestructions == 5);
+  assert(records->numberOfRecords() == initialNumberOfRecords);
+}
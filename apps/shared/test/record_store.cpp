@@ -0,0 +1,117 @@
+#include <quiz.h>
+#include <string.h>
+#include <assert.h>
+#include "../record_store.h"
+#include "../text_record.h"
+
+using namespace Shared;
+
+static RecordStore sStore;
+
+static void setText(RecordStore::Handle h, const char * text) {
+  bool didSet = sStore.setData(h, text, strlen(text)+1);
+  assert(didSet);
+}
+
+QUIZ_CASE(shared_record_store_compacts) {
+  size_t initialSize = sStore.availableSize();
+  RecordStore::Handle a = sStore.create(4);
+  RecordStore::Handle b = sStore.create(4);
+  RecordStore::Handle c = sStore.create(4);
+  assert(a != RecordStore::k_invalidHandle && b != a && c != b);
+  setText(a, "aaa");
+  setText(b, "bbb");
+  setText(c, "ccc");
+  assert(sStore.availableSize() == initialSize - 12);
+
+  // Growing a record moves the following ones
+  setText(a, "aaaaaaaaaa");
+  assert(strcmp(sStore.data(b), "bbb") == 0);
+  assert(strcmp(sStore.data(c), "ccc") == 0);
+  assert(sStore.data(b) == sStore.data(a) + 11);
+
+  // Destroying a record leaves no hole behind
+  sStore.destroy(b);
+  assert(sStore.numberOfRecords() == 2);
+  assert(sStore.data(c) == sStore.data(a) + 11);
+  assert(strcmp(sStore.data(c), "ccc") == 0);
+  assert(sStore.availableSize() == initialSize - 15);
+
+  // Copying a record that moves during the resizing
+  setText(a, "a");
+  setText(a, sStore.data(c));
+  assert(strcmp(sStore.data(a), "ccc") == 0);
+  assert(strcmp(sStore.data(c), "ccc") == 0);
+
+  sStore.destroy(a);
+  sStore.destroy(c);
+  assert(sStore.availableSize() == initialSize);
+}
+
+QUIZ_CASE(shared_record_store_full) {
+  RecordStore::Handle a = sStore.create(RecordStore::k_poolSize);
+  assert(a != RecordStore::k_invalidHandle);
+  assert(sStore.availableSize() == 0);
+  assert(sStore.create(1) == RecordStore::k_invalidHandle);
+  assert(!sStore.resize(a, RecordStore::k_poolSize+1));
+  assert(sStore.resize(a, 1));
+  assert(sStore.availableSize() == RecordStore::k_poolSize-1);
+  sStore.destroy(a);
+}
+
+QUIZ_CASE(shared_text_record) {
+  RecordStore * store = RecordStore::sharedRecordStore();
+  size_t initialSize = store->availableSize();
+  {
+    TextRecord t;
+    assert(strcmp(t.text(), "") == 0);
+    assert(t.capacity() == 0);
+    assert(t.setText("1+2"));
+    assert(strcmp(t.text(), "1+2") == 0);
+    assert(store->availableSize() == initialSize - 4);
+
+    char * buffer = t.edit(32);
+    assert(buffer != nullptr && t.capacity() == 32);
+    strlcpy(buffer + 3, "+3", 29);
+    t.shrinkToFit();
+    assert(strcmp(t.text(), "1+2+3") == 0);
+    assert(t.capacity() == 6);
+
+    // Empty texts take no room
+    assert(t.setText(""));
+    assert(store->availableSize() == initialSize);
+    assert(t.setText("abc"));
+  }
+  assert(store->availableSize() == initialSize);
+}
+
+QUIZ_CASE(shared_text_record_full_store) {
+  RecordStore * store = RecordStore::sharedRecordStore();
+  size_t initialSize = store->availableSize();
+  {
+    TextRecord t;
+    TextRecord u;
+    assert(t.setText("1+2"));
+    assert(u.edit(store->availableSize()) != nullptr);
+    assert(store->availableSize() == 0);
+
+    // A text that doesn't fit is refused and the previous one is kept
+    assert(!t.setText("1+2+3"));
+    assert(strcmp(t.text(), "1+2") == 0);
+    assert(t.setText("4"));
+
+    // Room given back by the replaced records counts
+    const TextRecord * records[] = {&t};
+    const char * fitting[] = {"5"};
+    const char * tooLong[] = {"5+6+7"};
+    assert(TextRecord::canReplace(records, fitting, 1));
+    assert(!TextRecord::canReplace(records, tooLong, 1));
+
+    // Moving a text needs no room
+    strlcpy(u.edit(u.capacity()), "abc", 4);
+    t.moveFrom(&u);
+    assert(strcmp(t.text(), "abc") == 0);
+    assert(strcmp(u.text(), "") == 0);
+  }
+  assert(store->availableSize() == initialSize);
+}
@@ -0,0 +1,116 @@
+#include "text_record.h"
+#include <string.h>
+#include <assert.h>
+
+namespace Shared {
+
+TextRecord::~TextRecord() {
+  setText("");
+}
+
+const char * TextRecord::text() const {
+  if (m_handle == RecordStore::k_invalidHandle) {
+    return "";
+  }
+  return store()->data(m_handle);
+}
+
+bool TextRecord::setText(const char * text) {
+  size_t size = strlen(text) + 1;
+  if (size == 1) {
+    if (m_handle != RecordStore::k_invalidHandle) {
+      store()->destroy(m_handle);
+      m_handle = RecordStore::k_invalidHandle;
+    }
+    return true;
+  }
+  if (m_handle == RecordStore::k_invalidHandle) {
+    m_handle = store()->create(size);
+    if (m_handle == RecordStore::k_invalidHandle) {
+      return false;
+    }
+  }
+  return store()->setData(m_handle, text, size);
+}
+
+bool TextRecord::canReplace(const TextRecord * const records[], const char * const texts[], int numberOfTexts) {
+  RecordStore * store = RecordStore::sharedRecordStore();
+  size_t availableSize = store->availableSize();
+  int numberOfAvailableRecords = RecordStore::k_maxNumberOfRecords - store->numberOfRecords();
+  size_t size = 0;
+  int numberOfRecords = 0;
+  for (int i = 0; i < numberOfTexts; i++) {
+    if (records[i]->m_handle != RecordStore::k_invalidHandle) {
+      availableSize += records[i]->capacity();
+      numberOfAvailableRecords++;
+    }
+    size_t length = strlen(texts[i]);
+    if (length > 0) {
+      size += length + 1;
+      numberOfRecords++;
+    }
+  }
+  return size <= availableSize && numberOfRecords <= numberOfAvailableRecords;
+}
+
+void TextRecord::moveFrom(TextRecord * other) {
+  assert(other != this);
+  setText("");
+  m_handle = other->m_handle;
+  other->m_handle = RecordStore::k_invalidHandle;
+}
+
+char * TextRecord::edit(size_t capacity) {
+  if (capacity == 0) {
+    return nullptr;
+  }
+  if (m_handle == RecordStore::k_invalidHandle) {
+    m_handle = store()->create(capacity);
+    if (m_handle == RecordStore::k_invalidHandle) {
+      return nullptr;
+    }
+  } else if (capacity > store()->size(m_handle)) {
+    if (!store()->resize(m_handle, capacity)) {
+      return nullptr;
+    }
+    /* Resizing does not clear the new room */
+    char * buffer = store()->data(m_handle);
+    size_t length = strlen(buffer);
+    memset(buffer + length, 0, capacity - length);
+  }
+  return store()->data(m_handle);
+}
+
+void TextRecord::shrinkToFit() {
+  if (m_handle == RecordStore::k_invalidHandle) {
+    return;
+  }
+  size_t size = strlen(store()->data(m_handle)) + 1;
+  if (size == 1) {
+    setText("");
+  } else {
+    store()->resize(m_handle, size);
+  }
+}
+
+void TextRecord::serialize(SnapshotWriter * writer) {
+  writer->write(m_handle);
+  if (!writer->isSizing()) {
+    m_handle = RecordStore::k_invalidHandle;
+  }
+}
+
+void TextRecord::deserialize(SnapshotReader * reader) {
+  // The empty text of a new record has no room to give back
+  assert(m_handle == RecordStore::k_invalidHandle);
+  m_handle = reader->read<RecordStore::Handle>();
+}
+
+size_t TextRecord::capacity() const {
+  if (m_handle == RecordStore::k_invalidHandle) {
+    return 0;
+  }
+  return store()->size(m_handle);
+}
+
+}
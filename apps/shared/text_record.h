@@ -0,0 +1,48 @@
+#ifndef SHARED_TEXT_RECORD_H
+#define SHARED_TEXT_RECORD_H
+
+#include "record_store.h"
+#include "snapshot_serializer.h"
+
+namespace Shared {
+
+/* TextRecord is a null-terminated string stored in the shared RecordStore. It
+ * only takes the room its text needs: an empty text has no record at all.
+ * The pointer returned by text() is invalidated by any change to the store. */
+
+class TextRecord {
+public:
+  constexpr TextRecord() : m_handle(RecordStore::k_invalidHandle) {}
+  ~TextRecord();
+  TextRecord(const TextRecord& other) = delete;
+  TextRecord(TextRecord&& other) = delete;
+  TextRecord& operator=(const TextRecord& other) = delete;
+  TextRecord& operator=(TextRecord&& other) = delete;
+  const char * text() const;
+  /* If the store is full, the text is left unchanged and false is returned. */
+  bool setText(const char * text);
+  /* Whether the texts would fit in the store once the records they replace
+   * are emptied, so that several texts can be replaced at once or not at
+   * all. */
+  static bool canReplace(const TextRecord * const records[], const char * const texts[], int numberOfTexts);
+  /* Takes the record of other, which is left empty. Unlike a copy, this never
+   * needs room in the store. */
+  void moveFrom(TextRecord * other);
+  /* To edit the text in place, its record can be grown beyond the text
+   * length. edit returns the buffer, or nullptr if there was no room at all.
+   * shrinkToFit gives the unused room back to the store. */
+  char * edit(size_t capacity);
+  void shrinkToFit();
+  size_t capacity() const;
+  /* The record is handed over to the serialized state rather than copied: the
+   * text is left empty and the record is kept in the store. */
+  void serialize(SnapshotWriter * writer);
+  void deserialize(SnapshotReader * reader);
+private:
+  RecordStore * store() const { return RecordStore::sharedRecordStore(); }
+  RecordStore::Handle m_handle;
+};
+
+}
+
+#endif
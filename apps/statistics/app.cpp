@@ -71,6 +71,32 @@ BoxView::Quantile * App::Snapshot::selectedBoxQuantile() {
   return &m_selectedBoxQuantile;
 }
 
+size_t App::Snapshot::serialize(char * buffer) {
+  Shared::SnapshotWriter writer(buffer);
+  m_store.serialize(&writer);
+  writer.write(m_storeVersion);
+  writer.write(m_barVersion);
+  writer.write(m_rangeVersion);
+  writer.write(m_selectedHistogramBarIndex);
+  writer.write(m_selectedBoxQuantile);
+  writer.write((int8_t)activeTab());
+  writer.write((int8_t)selectedTab());
+  return writer.size();
+}
+
+void App::Snapshot::deserialize(const char * buffer, size_t size) {
+  Shared::SnapshotReader reader(buffer, size);
+  m_store.deserialize(&reader);
+  m_storeVersion = reader.read<uint32_t>();
+  m_barVersion = reader.read<uint32_t>();
+  m_rangeVersion = reader.read<uint32_t>();
+  m_selectedHistogramBarIndex = reader.read<int>();
+  m_selectedBoxQuantile = reader.read<BoxView::Quantile>();
+  setActiveTab(reader.read<int8_t>());
+  setSelectedTab(reader.read<int8_t>());
+  assert(reader.isAtEnd());
+}
+
 App::App(Container * container, Snapshot * snapshot) :
   TextFieldDelegateApp(container, snapshot, &m_tabViewController),
   m_calculationController(&m_calculationAlternateEmptyViewController, &m_calculationHeader, snapshot->store()),
@@ -31,6 +31,8 @@ public:
     uint32_t * rangeVersion();
     int * selectedHistogramBarIndex();
     BoxView::Quantile * selectedBoxQuantile();
+    size_t serialize(char * buffer) override;
+    void deserialize(const char * buffer, size_t size) override;
   private:
     Store m_store;
     uint32_t m_storeVersion;
@@ -0,0 +1,525 @@
+// This file is auto-generated by Inliner. Do not edit manually.
+#include "stat_icon.h"
+
+#define P(c) KDColor::RGB24(c)
+
+const KDColor pixels[] = {
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFBFBFC),
+  P(0xCBCCD0), P(0x9B9DA5), P(0x7D818B), P(0x6C6F7B), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x696D78), P(0x787C86), P(0x9C9FA6),
+  P(0xCCCED2), P(0xFBFBFC), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCDCED2),
+  P(0x7B7E88), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x7B7E88), P(0xD0D1D5), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFDFDFD), P(0xABADB4),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0xADAFB5),
+  P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xA5A7AE),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0xADB0B6), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xCACCD0),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0xCFD0D4), P(0xFFFFFF), P(0xFAFAFB),
+  P(0x757883), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x777B85), P(0xFBFBFC),
+  P(0xC7C8CD), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0xC9CBCF), P(0x9799A1), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x999CA4), P(0x777B85), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x7A7D87), P(0x676B77), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x6A6E7A), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x686C77),
+  P(0xBCBDC3), P(0xF4F4F5), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xF5F5F6), P(0xBCBDC3),
+  P(0x686C77), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x646874),
+  P(0xBCBEC3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xB7B9BF), P(0x646874), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x646874),
+  P(0x626672), P(0xF9F9FA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF9F9F9), P(0x626672), P(0x646874), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x636773), P(0x5F636F), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xEBE9EC), P(0x5F636F), P(0x636773),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x626672), P(0x5C606C), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFEFEFE), P(0xEDEBEE), P(0xE5E2E7), P(0x5C616D),
+  P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x626672), P(0x5B5F6B), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFCFCFD), P(0xEAE7EC), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x5B5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFAFAFA), P(0xE8E5EA), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0x5A5F6B), P(0x626672), P(0x686C77), P(0xBCBDC3), P(0xF4F4F5),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF5F5F6), P(0xBCBDC3), P(0x686C77), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF7F6F8), P(0xE6E3E8), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x5A5F6B), P(0x616571), P(0xBCBEC3), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xB7B9BF),
+  P(0x646874), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672),
+  P(0x5A5F6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF4F3F5), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x595E6A), P(0x5F636F), P(0xF9F9FA),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xF9F9F9), P(0x626672), P(0x646874), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x626672), P(0x5A5F6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xF0EEF1), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x585D69), P(0x5C606C),
+  P(0xF1F0F2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x5F636F), P(0x636773), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x626672), P(0x5A5F6B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFEFEFE), P(0xEDEBEE), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68),
+  P(0x595D6A), P(0xE6E3E8), P(0xFAF9FA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5C616D), P(0x626672), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFCFCFC), P(0xEAE7EC), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE8E6EA), P(0xFDFDFD), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5B5F6B), P(0x626672),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFAFAFA), P(0xE8E5EA), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xECEAEE),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B),
+  P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x676B77), P(0xB6B8BD), P(0xEBEBEC), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xEBEBEC), P(0xB6B8BD), P(0x676B77), P(0x626672), P(0x5A5F6B),
+  P(0xFFFFFF), P(0xF7F6F8), P(0xE6E3E8), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xF2F1F3), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x646874), P(0xB6B8BD), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xB2B4B9), P(0x616571),
+  P(0x5A5F6B), P(0xF4F3F5), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xF8F7F8), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x646874), P(0x626672), P(0xF0F0F0), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xEFEFF0),
+  P(0x5F636F), P(0x5A5E6A), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE7E4E9), P(0xFCFBFC),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x636773), P(0x5F636F), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F4F5),
+  P(0xE5E3E7), P(0x5C606C), P(0x595D69), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68),
+  P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xEAE8EC), P(0xFEFEFE), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5C606C),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF3F3F3),
+  P(0xE8E6EA), P(0xE5E2E7), P(0x595E6A), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xEFEDF0), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672),
+  P(0x5B5F6B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF1F0F1),
+  P(0xE6E4E8), P(0xE5E2E7), P(0xE5E2E7), P(0x585C68), P(0x585C68), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xF5F4F6), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B),
+  P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x626672), P(0x5A5F6B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xEEECEF),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE6E3E8),
+  P(0xFAF9FA), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x626672), P(0x5A5F6B), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF4F4F4), P(0xEAE8EC),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68),
+  P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE8E6EA), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B), P(0xF5F5F5), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF2F2F3), P(0xE8E5E9),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xECEAEE), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B), P(0xF5F5F5),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF0EFF0), P(0xE6E3E8),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68),
+  P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xF2F1F3),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672), P(0x5A5F6B),
+  P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xF5F5F5), P(0xECEBEE), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xF8F7F8), P(0xFFFFFF), P(0xFFFFFF), P(0x5A5F6B), P(0x626672),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x626672),
+  P(0x5A5F6B), P(0xF5F5F5), P(0xF5F5F5), P(0xF4F3F4), P(0xE9E7EB), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE7E4E9), P(0xFCFBFC), P(0xFFFFFF), P(0x5A5F6B),
+  P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x626672), P(0x5A5F6B), P(0xF5F5F5), P(0xF2F1F2), P(0xE7E4E9), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xEAE8EC), P(0xFEFEFE),
+  P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x626672), P(0x5A5F6B), P(0xEFEEF0), P(0xE6E3E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68),
+  P(0x585C68), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x575C68), P(0x585C68), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xEFEDF0), P(0x5A5F6B), P(0x626672), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x626672), P(0x5C606C), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0x595D69), P(0x595D69), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0x595D69), P(0x595D69),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7), P(0xE5E2E7),
+  P(0xE5E2E7), P(0xE5E2E7), P(0x5C606C), P(0x626672), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x636773), P(0x5E626E), P(0x575B67),
+  P(0x525763), P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460),
+  P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x525763),
+  P(0x575B67), P(0x5C606C), P(0x5C606C), P(0x575B67), P(0x525763), P(0x505460),
+  P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460),
+  P(0x505460), P(0x505460), P(0x505460), P(0x525763), P(0x575B67), P(0x5C606C),
+  P(0x5C606C), P(0x575B67), P(0x525763), P(0x505460), P(0x505460), P(0x505460),
+  P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460), P(0x505460),
+  P(0x505460), P(0x525763), P(0x575B67), P(0x5E626E), P(0x636773), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x646874), P(0x626672),
+  P(0x5E626E), P(0x5C606C), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B),
+  P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B),
+  P(0x5C606C), P(0x5E626E), P(0x616571), P(0x616571), P(0x5E626E), P(0x5C606C),
+  P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B),
+  P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5C606C), P(0x5E626E),
+  P(0x616571), P(0x616571), P(0x5E626E), P(0x5C606C), P(0x5A5F6B), P(0x5A5F6B),
+  P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B), P(0x5A5F6B),
+  P(0x5A5F6B), P(0x5A5F6B), P(0x5C606C), P(0x5E626E), P(0x626672), P(0x646874),
+  P(0x656975), P(0x656975), P(0x656975), P(0x646874), P(0x656975), P(0x656975),
+  P(0x646874), P(0x636773), P(0x626672), P(0x626672), P(0x626672), P(0x626672),
+  P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672),
+  P(0x626672), P(0x626672), P(0x636773), P(0x646874), P(0x646874), P(0x636773),
+  P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672),
+  P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672),
+  P(0x636773), P(0x646874), P(0x646874), P(0x636773), P(0x626672), P(0x626672),
+  P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x626672),
+  P(0x626672), P(0x626672), P(0x626672), P(0x626672), P(0x636773), P(0x646874),
+  P(0x656975), P(0x656975), P(0x656975), P(0x636772), P(0x616570), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x61646F), P(0x61636D),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x63666F),
+  P(0x74767D), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x77797F), P(0xB6B6B9), P(0x616570), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x616470), P(0xB9B9BB), P(0xF8F8F9), P(0x5A5B63), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x5B5C63), P(0xFBFBFB), P(0xFFFFFF), P(0xBDBDBF), P(0x565962),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x545660), P(0xC0C0C2), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0x939398), P(0x565962), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x545660), P(0x97979B), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFDFDFD), P(0x8D8D91), P(0x4D4E57), P(0x60646F), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x60636F), P(0x4C4E56), P(0x8F8F93), P(0xFDFDFD), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xBFBFC1), P(0x58585E),
+  P(0x4E4F57), P(0x595C66), P(0x61646F), P(0x646874), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975), P(0x656975),
+  P(0x656975), P(0x656975), P(0x656975), P(0x646874), P(0x60646F), P(0x595C66),
+  P(0x4E4F57), P(0x5A5A60), P(0xBFBFC1), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFBFBFB), P(0xB7B7BA), P(0x7C7C80), P(0x5B5B60), P(0x48484D), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x414147),
+  P(0x414147), P(0x414147), P(0x414147), P(0x414147), P(0x424248), P(0x57575C),
+  P(0x838386), P(0xBDBDC0), P(0xFBFBFB), P(0xFFFFFF), P(0xFFFFFF), P(0xFFFFFF),
+  P(0xFFFFFF), P(0xFFFFFF)
+};
+
+constexpr Image image = Image(55, 56, pixels);
+
+const Image * ImageStore::StatIcon = &image;
@@ -218,4 +218,18 @@ int Store::minIndex(double * bufferValues, int bufferLength) {
   return index;
 }
 
+void Store::serialize(Shared::SnapshotWriter * writer) {
+  MemoizedCurveViewRange::serialize(writer);
+  FloatPairStore::serialize(writer);
+  writer->write(m_barWidth);
+  writer->write(m_firstDrawnBarAbscissa);
+}
+
+void Store::deserialize(Shared::SnapshotReader * reader) {
+  MemoizedCurveViewRange::deserialize(reader);
+  FloatPairStore::deserialize(reader);
+  m_barWidth = reader->read<double>();
+  m_firstDrawnBarAbscissa = reader->read<double>();
+}
+
 }
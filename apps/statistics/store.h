@@ -22,6 +22,8 @@ public:
   double numberOfBars();
   // return true if the window has scrolled
   bool scrollToSelectedBarIndex(int index);
+  void serialize(Shared::SnapshotWriter * writer);
+  void deserialize(Shared::SnapshotReader * reader);
 
   // Calculation
   double sumOfOccurrences();
@@ -18,8 +18,18 @@ include build/toolchain.$(TOOLCHAIN).mak
 OS_WITH_ONBOARDING_APP ?= 1
 OS_WITH_SOFTWARE_UPDATE_PROMPT ?= 1
 QUIZ_USE_CONSOLE ?= 0
+QUIZ_RUN_BENCHMARKS ?= 0
+PYTHON_PROFILER_DUMP ?= 0
+LIBA_HEAP_TRACE ?= 0
+ION_TRACE ?= 0
+POINCARE_JIT ?= 0
 
 SFLAGS += -DDEBUG=$(DEBUG)
 SFLAGS += -DOS_WITH_ONBOARDING_APP=$(OS_WITH_ONBOARDING_APP)
 SFLAGS += -DOS_WITH_SOFTWARE_UPDATE_PROMPT=$(OS_WITH_SOFTWARE_UPDATE_PROMPT)
 SFLAGS += -DQUIZ_USE_CONSOLE=$(QUIZ_USE_CONSOLE)
+SFLAGS += -DQUIZ_RUN_BENCHMARKS=$(QUIZ_RUN_BENCHMARKS)
+SFLAGS += -DPYTHON_PROFILER_DUMP=$(PYTHON_PROFILER_DUMP)
+SFLAGS += -DLIBA_HEAP_TRACE=$(LIBA_HEAP_TRACE)
+SFLAGS += -DION_TRACE=$(ION_TRACE)
+SFLAGS += -DPOINCARE_JIT=$(POINCARE_JIT)
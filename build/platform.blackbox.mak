@@ -3,3 +3,5 @@ USE_LIBA ?= 0
 EXE = bin
 OS_WITH_ONBOARDING_APP ?= 0
 OS_WITH_SOFTWARE_UPDATE_PROMPT ?= 0
+POINCARE_JIT ?= 1
+PYTHON_PROFILER_DUMP ?= 1
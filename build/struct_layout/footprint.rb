@@ -0,0 +1,178 @@
+#!/usr/bin/env ruby
+
+# Takes clang-generated record layouts (-fdump-record-layouts) in stdin
+# Outputs a footprint report: for each record, its size, the bytes lost to
+# padding and its largest members
+#
+# Usage: footprint.rb [--pointer-size N] [--top N] [RootClass]
+# If RootClass is given, only the records it contains are reported.
+
+class Record
+  attr_accessor :name, :size, :data_size, :entries
+
+  def initialize(name)
+    @name = name
+    @size = 0
+    @data_size = 0
+    @entries = []
+  end
+end
+
+class Entry
+  attr_accessor :offset, :type, :name, :kind
+
+  def initialize(offset, type, name, kind)
+    @offset = offset
+    @type = type
+    @name = name
+    @kind = kind # :field, :base or :vtable
+  end
+end
+
+BUILTIN_SIZES = {
+  "_Bool" => 1, "bool" => 1, "char" => 1, "signed char" => 1, "unsigned char" => 1,
+  "int8_t" => 1, "uint8_t" => 1,
+  "short" => 2, "unsigned short" => 2, "int16_t" => 2, "uint16_t" => 2,
+  "KDCoordinate" => 2, "KDColor" => 2,
+  "int" => 4, "unsigned int" => 4, "float" => 4, "int32_t" => 4, "uint32_t" => 4,
+  "long long" => 8, "unsigned long long" => 8, "double" => 8,
+  "int64_t" => 8, "uint64_t" => 8,
+}
+
+def strip_keyword(type)
+  type.sub(/^(const |volatile |mutable )*/, "").sub(/^(class|struct|union|enum) /, "")
+end
+
+def parse_records(input)
+  records = {}
+  current = nil
+  input.each_line do |line|
+    if line.start_with?("*** Dumping AST Record Layout")
+      current = nil
+      next
+    end
+    if line =~ /^\s*\|\s*\[sizeof=([0-9]+), dsize=([0-9]+)/
+      current.size = $1.to_i
+      current.data_size = $2.to_i
+      records[current.name] = current
+      current = nil
+      next
+    end
+    # Example : "         4 |   struct KDRect m_frame"
+    # Bit-fields are written "8:0-3 |"
+    m = line.match(/^\s*([0-9]+)(:[0-9-]+)?\s\|(\s+)(.*)$/)
+    next if m.nil?
+    offset = m[1].to_i
+    depth = (m[3].size-1)/2
+    text = m[4]
+    if depth == 0
+      current = Record.new(strip_keyword(text)) if offset == 0
+      next
+    end
+    next if current.nil? || depth != 1
+    if text =~ /^\((.*) vtable pointer\)$/
+      current.entries << Entry.new(offset, nil, "vtable pointer", :vtable)
+    elsif text =~ /^(.*) \((primary base|base|virtual base)\)$/
+      current.entries << Entry.new(offset, strip_keyword($1), $1, :base)
+    elsif text =~ /^(.*[^ ]) ([A-Za-z_][A-Za-z0-9_]*)$/
+      current.entries << Entry.new(offset, $1, $2, :field)
+    end
+  end
+  records
+end
+
+class Footprint
+  def initialize(records, pointer_size)
+    @records = records
+    @pointer_size = pointer_size
+  end
+
+  # Size of a type, or nil if it can't be told from the layouts
+  def type_size(type)
+    return @pointer_size if type =~ /[*&]$/ || type =~ /\(\*\)/
+    if type =~ /^(.*?) ((\[[0-9]+\])+)$/
+      element_size = type_size($1)
+      return nil if element_size.nil?
+      return $2.scan(/[0-9]+/).map(&:to_i).inject(element_size, :*)
+    end
+    name = strip_keyword(type)
+    return @records[name].size if @records.has_key?(name)
+    BUILTIN_SIZES[name]
+  end
+
+  def entry_size(entry)
+    case entry.kind
+    when :vtable
+      @pointer_size
+    when :base
+      # Members of the derived class may be laid out in a base's tail padding
+      base = @records[entry.type]
+      base.nil? ? nil : base.data_size
+    else
+      type_size(entry.type)
+    end
+  end
+
+  # Bytes between members, and after the last one, that hold no data.
+  # Members of unknown size are assumed to reach the next member.
+  def padding(record)
+    entries = record.entries.sort_by(&:offset)
+    padding = 0
+    entries.each_with_index do |entry, i|
+      size = entry_size(entry)
+      next_offset = (i+1 < entries.size) ? entries[i+1].offset : record.size
+      next if size.nil? || entry.offset + size >= next_offset
+      padding += next_offset - (entry.offset + size)
+    end
+    padding
+  end
+
+  def hot_members(record, count)
+    record.entries.select { |e| e.kind == :field }
+      .map { |e| [e, type_size(e.type)] }
+      .reject { |e, size| size.nil? }
+      .sort_by { |e, size| -size }
+      .first(count)
+  end
+
+  # The records reachable from root through members and bases
+  def contained_records(root)
+    found = {}
+    stack = [root]
+    until stack.empty?
+      name = stack.pop
+      next if found.has_key?(name) || !@records.has_key?(name)
+      found[name] = @records[name]
+      @records[name].entries.each do |entry|
+        next if entry.type.nil? || entry.type =~ /[*&]$/
+        stack.push(strip_keyword(entry.type.sub(/ (\[[0-9]+\])+$/, "")))
+      end
+    end
+    found.values
+  end
+
+  def report(records, top)
+    puts "%8s %6s  %s" % ["SIZE", "PAD", "RECORD (largest members)"]
+    records.sort_by { |r| -r.size }.first(top).each do |record|
+      members = hot_members(record, 3).map { |e, size| "#{e.name} #{size}" }.join(", ")
+      puts "%8d %6d  %s (%s)" % [record.size, padding(record), record.name, members]
+    end
+    total = records.map { |r| padding(r) }.inject(0, :+)
+    puts "Padding in the #{records.size} records: #{total} bytes"
+  end
+end
+
+pointer_size = 4
+top = 40
+root = nil
+while arg = ARGV.shift
+  case arg
+  when "--pointer-size" then pointer_size = ARGV.shift.to_i
+  when "--top" then top = ARGV.shift.to_i
+  else root = arg
+  end
+end
+
+records = parse_records(STDIN)
+footprint = Footprint.new(records, pointer_size)
+footprint.report(root.nil? ? records.values : footprint.contained_records(root), top)
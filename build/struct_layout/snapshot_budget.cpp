@@ -0,0 +1,25 @@
+#include "../../apps/apps_container.h"
+
+/* Compiling this file fails if the snapshot of an app is bigger than
+ * SNAPSHOT_BUDGET bytes. Sizes are those of the target the compiler builds
+ * for, so the budget is meant to be checked with the device toolchain. The
+ * compiler names the snapshot in the failing instantiation, and recent ones
+ * also print the comparison with its size. */
+
+template<typename Snapshot, size_t Size = sizeof(Snapshot), size_t Budget = SNAPSHOT_BUDGET>
+struct SnapshotBudget {
+  static_assert(Size <= Budget, "An app snapshot exceeds SNAPSHOT_BUDGET");
+};
+
+template struct SnapshotBudget<HardwareTest::App::Snapshot>;
+template struct SnapshotBudget<OnBoarding::App::Snapshot>;
+template struct SnapshotBudget<Home::App::Snapshot>;
+template struct SnapshotBudget<Calculation::App::Snapshot>;
+template struct SnapshotBudget<Rpn::App::Snapshot>;
+template struct SnapshotBudget<Graph::App::Snapshot>;
+template struct SnapshotBudget<Sequence::App::Snapshot>;
+template struct SnapshotBudget<Settings::App::Snapshot>;
+template struct SnapshotBudget<Statistics::App::Snapshot>;
+template struct SnapshotBudget<Probability::App::Snapshot>;
+template struct SnapshotBudget<Regression::App::Snapshot>;
+template struct SnapshotBudget<Code::App::Snapshot>;
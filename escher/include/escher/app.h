@@ -35,6 +35,13 @@ public:
     /* reset all instances to their initial values */
     virtual void reset();
     virtual Descriptor * descriptor() = 0;
+    /* An inactive snapshot may be destroyed to give its room to another one.
+     * serialize writes the state it couldn't rebuild into buffer and returns
+     * its size, or only computes the size if buffer is nullptr. Once written,
+     * the state belongs to the buffer and the snapshot is to be destroyed.
+     * deserialize restores it into a newly constructed snapshot. */
+    virtual size_t serialize(char * buffer);
+    virtual void deserialize(const char * buffer, size_t size);
   private:
     /* tidy clean all dynamically-allocated data */
     virtual void tidy();
@@ -54,6 +61,9 @@ public:
 
   virtual void didBecomeActive(Window * window);
   virtual void willBecomeInactive();
+  /* Runs the computation the app deferred to the run loop, if any. Returns
+   * whether there was one. */
+  virtual bool runTask();
   virtual int numberOfTimers();
   virtual Timer * timerAtIndex(int i);
 protected:
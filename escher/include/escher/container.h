@@ -31,11 +31,17 @@ protected:
   virtual Window * window() = 0;
 private:
   void step();
+  void runTask() override;
   int numberOfTimers() override;
   Timer * timerAtIndex(int i) override;
   virtual int numberOfContainerTimers();
   virtual Timer * containerTimerAtIndex(int i);
+  bool coalesceEvent(Ion::Events::Event event);
+  /* A long burst of queued events still gets the screen redrawn every few
+   * events, so that the display keeps up with it. */
+  constexpr static int k_maxNumberOfCoalescedEvents = 8;
   App * m_activeApp;
+  int m_numberOfCoalescedEvents;
 };
 
 #endif
@@ -1,6 +1,7 @@
 #ifndef ESCHER_INPUT_VIEW_CONTROLLER_H
 #define ESCHER_INPUT_VIEW_CONTROLLER_H
 
+#include <escher/i18n.h>
 #include <escher/modal_view_controller.h>
 #include <escher/invocation.h>
 #include <escher/text_field.h>
@@ -11,6 +12,9 @@ public:
   InputViewController(Responder * parentResponder, ViewController * child, TextFieldDelegate * textFieldDelegate);
   void edit(Responder * caller, Ion::Events::Event event, void * context, const char * initialText, Invocation::Action successAction, Invocation::Action failureAction);
   const char * textBody();
+  /* The success action can refuse the text: the warning is displayed and the
+   * text is left in the text field, which stays on screen. */
+  void refuseText(I18n::Message warningMessage);
   bool textFieldDidReceiveEvent(TextField * textField, Ion::Events::Event event) override;
   void abortTextFieldEditionAndDismiss();
   bool textFieldShouldFinishEditing(TextField * textField, Ion::Events::Event event) override;
@@ -48,6 +52,7 @@ private:
   Invocation m_successAction;
   Invocation m_failureAction;
   TextFieldDelegate * m_textFieldDelegate;
+  bool m_textIsRefused;
 };
 
 #endif
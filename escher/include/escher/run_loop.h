@@ -9,11 +9,18 @@ public:
   RunLoop();
   void run();
 protected:
+  /* fetchEvent waits at most *timeout milliseconds for an event and
+   * decrements *timeout by the time it waited. */
+  virtual Ion::Events::Event fetchEvent(int * timeout);
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
+  /* runTask is called once each event has been dispatched and the screen
+   * redrawn. Long computations run from there rather than while handling an
+   * event or drawing. */
+  virtual void runTask();
   virtual int numberOfTimers();
   virtual Timer * timerAtIndex(int i);
-private:
   bool step();
+private:
   int m_time;
 };
 
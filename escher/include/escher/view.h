@@ -39,9 +39,21 @@ public:
   void setSize(KDSize size);
   void setFrame(KDRect frame);
 
+  /* Relayouts triggered by content changes (reloadData, scrolling...) are
+   * deferred: setNeedsLayout only flags the view, and the Window lays out
+   * every flagged view once, right before redrawing. Flagging a view that is
+   * already waiting for its layout is a layout avoided. */
+  void setNeedsLayout();
+  static int numberOfAvoidedLayouts();
+
   KDRect bounds() const;
   View * subview(int index);
 
+  /* Views are usually drawn by the window, through drawRect. A view showing
+   * the progress of a long task can also draw right away in the context this
+   * returns, set up to the view's visible frame. */
+  KDContext * drawingContext() const;
+
   virtual KDSize minimalSizeForOptimalDisplay() const;
 
 #if ESCHER_VIEW_LOGGING
@@ -69,11 +81,15 @@ private:
   virtual void layoutSubviews();
   virtual const Window * window() const;
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  bool needsRedraw();
+  void layoutIfNeeded();
+  static void resetNumberOfAvoidedLayouts();
   KDPoint absoluteOrigin() const;
   KDRect absoluteVisibleFrame() const;
 
   View * m_superview;
   KDRect m_dirtyRect;
+  bool m_needsLayout;
 };
 
 #endif
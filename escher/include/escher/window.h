@@ -8,6 +8,7 @@ public:
   Window();
   void redraw(bool force = false);
   void setContentView(View * contentView);
+  int numberOfLayoutsAvoidedByLastPass() const { return m_numberOfLayoutsAvoidedByLastPass; }
 protected:
 #if ESCHER_VIEW_LOGGING
   const char * className() const override;
@@ -18,6 +19,7 @@ protected:
   View * m_contentView;
 private:
   const Window * window() const override;
+  int m_numberOfLayoutsAvoidedByLastPass;
 };
 
 #endif
@@ -24,6 +24,14 @@ void App::Snapshot::pack(App * app) {
 void App::Snapshot::reset() {
 }
 
+size_t App::Snapshot::serialize(char * buffer) {
+  return 0;
+}
+
+void App::Snapshot::deserialize(const char * buffer, size_t size) {
+  assert(size == 0);
+}
+
 void App::Snapshot::tidy() {
 }
 
@@ -119,6 +127,10 @@ void App::willBecomeInactive() {
   m_modalViewController.viewDidDisappear();
 }
 
+bool App::runTask() {
+  return false;
+}
+
 int App::numberOfTimers() {
   return 0;
 }
@@ -3,7 +3,8 @@
 
 Container::Container() :
   RunLoop(),
-  m_activeApp(nullptr)
+  m_activeApp(nullptr),
+  m_numberOfCoalescedEvents(0)
 {
 }
 
@@ -17,6 +18,7 @@ void Container::switchTo(App::Snapshot * snapshot) {
   if (m_activeApp && snapshot == m_activeApp->snapshot()) {
     return;
   }
+  ION_TRACE_SCOPE("switch app");
   if (m_activeApp) {
     m_activeApp->willBecomeInactive();
     m_activeApp->snapshot()->pack(m_activeApp);
@@ -36,13 +38,40 @@ App * Container::activeApp() {
 }
 
 bool Container::dispatchEvent(Ion::Events::Event event) {
+  ION_TRACE_SCOPE("event");
+  ION_TRACE_COUNTER("event id", event.id());
   if (event == Ion::Events::TimerFire || m_activeApp->processEvent(event)) {
+    if (!coalesceEvent(event)) {
+      window()->redraw();
+    }
+    return true;
+  }
+  if (m_numberOfCoalescedEvents > 0) {
+    // The event that was expected to redraw the screen turned out to be a no-op
+    m_numberOfCoalescedEvents = 0;
     window()->redraw();
+  }
+  return false;
+}
+
+bool Container::coalesceEvent(Ion::Events::Event event) {
+  /* When a repeatable event (a held arrow key for instance) is followed by an
+   * identical event that is already queued, there is no point in drawing the
+   * intermediate state: the next event will redraw the screen anyway. */
+  if (Ion::Events::canRepeatEvent(event) && Ion::Events::isQueued(event) && m_numberOfCoalescedEvents < k_maxNumberOfCoalescedEvents) {
+    m_numberOfCoalescedEvents++;
     return true;
   }
+  m_numberOfCoalescedEvents = 0;
   return false;
 }
 
+void Container::runTask() {
+  if (m_activeApp && m_activeApp->runTask()) {
+    window()->redraw();
+  }
+}
+
 void Container::run() {
   window()->redraw();
   RunLoop::run();
@@ -63,7 +63,8 @@ InputViewController::InputViewController(Responder * parentResponder, ViewContro
   m_textFieldController(this, this),
   m_successAction(Invocation(nullptr, nullptr)),
   m_failureAction(Invocation(nullptr, nullptr)),
-  m_textFieldDelegate(textFieldDelegate)
+  m_textFieldDelegate(textFieldDelegate),
+  m_textIsRefused(false)
 {
 }
 
@@ -71,6 +72,11 @@ const char * InputViewController::textBody() {
   return m_textFieldController.textField()->text();
 }
 
+void InputViewController::refuseText(I18n::Message warningMessage) {
+  m_textIsRefused = true;
+  app()->displayWarning(warningMessage);
+}
+
 void InputViewController::edit(Responder * caller, Ion::Events::Event event, void * context, const char * initialText, Invocation::Action successAction, Invocation::Action failureAction) {
   m_successAction = Invocation(successAction, context);
   m_failureAction = Invocation(failureAction, context);
@@ -93,6 +99,10 @@ bool InputViewController::textFieldShouldFinishEditing(TextField * textField, Io
 
 bool InputViewController::textFieldDidFinishEditing(TextField * textField, const char * text, Ion::Events::Event event) {
   m_successAction.perform(this);
+  if (m_textIsRefused) {
+    m_textIsRefused = false;
+    return false;
+  }
   dismissModalViewController();
   return true;
 }
@@ -17,6 +17,13 @@ Timer * RunLoop::timerAtIndex(int i) {
   return nullptr;
 }
 
+void RunLoop::runTask() {
+}
+
+Ion::Events::Event RunLoop::fetchEvent(int * timeout) {
+  return Ion::Events::getEvent(timeout);
+}
+
 void RunLoop::run() {
 #ifdef __EMSCRIPTEN__
   emscripten_set_main_loop_arg([](void * ctx){ ((RunLoop *)ctx)->step(); }, this, 0, 1);
@@ -30,7 +37,7 @@ bool RunLoop::step() {
   // Fetch the event, if any
   int eventDuration = Timer::TickDuration;
   int timeout = eventDuration;
-  Ion::Events::Event event = Ion::Events::getEvent(&timeout);
+  Ion::Events::Event event = fetchEvent(&timeout);
   assert(event.isDefined());
   eventDuration -= timeout;
 
@@ -69,5 +76,7 @@ bool RunLoop::step() {
     dispatchEvent(event);
   }
 
+  runTask();
+
   return event != Ion::Events::Termination;
 }
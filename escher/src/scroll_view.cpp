@@ -191,7 +191,7 @@ KDSize ScrollView::contentSize() {
 
 void ScrollView::setContentOffset(KDPoint offset) {
   if (m_dataSource->setOffset(offset)) {
-    layoutSubviews();
+    setNeedsLayout();
   }
 }
 
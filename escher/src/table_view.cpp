@@ -51,7 +51,7 @@ void TableView::layoutSubviews() {
 }
 
 void TableView::reloadData() {
-  layoutSubviews();
+  setNeedsLayout();
 }
 
 void TableView::reloadCellAtLocation(int i, int j) {
@@ -3,10 +3,13 @@ extern "C" {
 }
 #include <escher/view.h>
 
+static int sNumberOfAvoidedLayouts = 0;
+
 View::View() :
   m_frame(KDRectZero),
   m_superview(nullptr),
-  m_dirtyRect(KDRectZero)
+  m_dirtyRect(KDRectZero),
+  m_needsLayout(false)
 {
 }
 
@@ -108,6 +111,19 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   return redrawnArea;
 }
 
+bool View::needsRedraw() {
+  if (!m_dirtyRect.isEmpty()) {
+    return true;
+  }
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr && subview->needsRedraw()) {
+      return true;
+    }
+  }
+  return false;
+}
+
 View * View::subview(int index) {
   assert(index >= 0 && index < numberOfSubviews());
   View * subview = subviewAtIndex(index);
@@ -147,13 +163,59 @@ void View::setFrame(KDRect frame) {
   markRectAsDirty(bounds());
   // FIXME: m_dirtyRect = bounds(); would be more correct (in case the view is being shrinked)
 
+  /* A frame change is laid out right away since the geometry of the subviews
+   * is often used straight after (to scroll to a cell for instance). It also
+   * fulfills any layout that was pending on this view. */
+  if (m_needsLayout) {
+    m_needsLayout = false;
+    sNumberOfAvoidedLayouts++;
+  }
   layoutSubviews();
 }
 
+void View::setNeedsLayout() {
+  if (m_needsLayout) {
+    sNumberOfAvoidedLayouts++;
+    return;
+  }
+  m_needsLayout = true;
+}
+
+void View::layoutIfNeeded() {
+  /* The layout pass goes top-down: laying out a view usually sets the frames of
+   * its subviews, which flags them in turn before we recurse into them. */
+  if (m_needsLayout) {
+    m_needsLayout = false;
+    layoutSubviews();
+  }
+  for (int i = 0; i < numberOfSubviews(); i++) {
+    View * subview = this->subview(i);
+    if (subview != nullptr) {
+      subview->layoutIfNeeded();
+    }
+  }
+}
+
+int View::numberOfAvoidedLayouts() {
+  return sNumberOfAvoidedLayouts;
+}
+
+void View::resetNumberOfAvoidedLayouts() {
+  sNumberOfAvoidedLayouts = 0;
+}
+
 KDRect View::bounds() const {
   return m_frame.movedTo(KDPointZero);
 }
 
+KDContext * View::drawingContext() const {
+  assert(window() != nullptr);
+  KDContext * ctx = KDIonContext::sharedContext();
+  ctx->setOrigin(absoluteOrigin());
+  ctx->setClippingRect(absoluteVisibleFrame());
+  return ctx;
+}
+
 KDPoint View::absoluteOrigin() const {
   if (m_superview == nullptr) {
     assert(this == (View *)window());
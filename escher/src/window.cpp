@@ -5,7 +5,8 @@ extern "C" {
 }
 
 Window::Window() :
-  m_contentView(nullptr)
+  m_contentView(nullptr),
+  m_numberOfLayoutsAvoidedByLastPass(0)
 {
 }
 
@@ -13,7 +14,22 @@ void Window::redraw(bool force) {
   if (force) {
     markRectAsDirty(bounds());
   }
+  /* All the relayouts requested since the last redraw (by reloadData,
+   * scrolling...) are done once here, before drawing. */
+  ION_TRACE_BEGIN("layout");
+  layoutIfNeeded();
+  ION_TRACE_END("layout");
+  m_numberOfLayoutsAvoidedByLastPass = numberOfAvoidedLayouts();
+  resetNumberOfAvoidedLayouts();
+  /* If no view is dirty, redrawing would not push a single pixel, but it would
+   * still wait for the next display refresh. */
+  if (!needsRedraw()) {
+    return;
+  }
+  ION_TRACE_BEGIN("vblank");
   Ion::Display::waitForVBlank();
+  ION_TRACE_END("vblank");
+  ION_TRACE_SCOPE("draw");
   View::redraw(bounds());
 }
 
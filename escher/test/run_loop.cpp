@@ -0,0 +1,43 @@
+#include <quiz.h>
+#include <escher.h>
+#include <assert.h>
+
+class TaskCountingRunLoop : public RunLoop {
+public:
+  TaskCountingRunLoop() :
+    RunLoop(),
+    m_event(Ion::Events::None),
+    m_numberOfTasks(0),
+    m_numberOfDispatchedEvents(0)
+  {
+  }
+  using RunLoop::step;
+  void setEvent(Ion::Events::Event e) { m_event = e; }
+  int numberOfTasks() const { return m_numberOfTasks; }
+  int numberOfDispatchedEvents() const { return m_numberOfDispatchedEvents; }
+protected:
+  Ion::Events::Event fetchEvent(int * timeout) override { return m_event; }
+  bool dispatchEvent(Ion::Events::Event e) override {
+    m_numberOfDispatchedEvents++;
+    return false;
+  }
+  void runTask() override { m_numberOfTasks++; }
+private:
+  Ion::Events::Event m_event;
+  int m_numberOfTasks;
+  int m_numberOfDispatchedEvents;
+};
+
+QUIZ_CASE(escher_run_loop_runs_task_after_each_step) {
+  TaskCountingRunLoop runLoop;
+  assert(runLoop.step());
+  assert(runLoop.numberOfTasks() == 1);
+  assert(runLoop.numberOfDispatchedEvents() == 0);
+  runLoop.setEvent(Ion::Events::OK);
+  assert(runLoop.step());
+  assert(runLoop.numberOfTasks() == 2);
+  assert(runLoop.numberOfDispatchedEvents() == 1);
+  runLoop.setEvent(Ion::Events::Termination);
+  assert(!runLoop.step());
+  assert(runLoop.numberOfTasks() == 3);
+}
@@ -10,6 +10,8 @@
 #include <ion/keyboard.h>
 #include <ion/led.h>
 #include <ion/power.h>
+#include <ion/timing.h>
+#include <ion/trace.h>
 #include <ion/usb.h>
 #include <stdint.h>
 #include <string.h>
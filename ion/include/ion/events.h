@@ -15,8 +15,10 @@ public:
   static constexpr Event Special(int i) { return Event(4*PageSize+i); }
 
   constexpr Event(int i) : m_id(i){} // TODO: Assert here that i>=0 && i<255
-#if DEBUG
+#if DEBUG || ION_TRACE
   uint8_t id() const { return m_id; }
+#endif
+#if DEBUG
   const char * name() const;
 #endif
   Event(Keyboard::Key key, bool shift, bool alpha);
@@ -50,6 +52,12 @@ enum class ShiftAlphaStatus {
 // Timeout is decremented
 Event getEvent(int * timeout);
 
+/* Returns true if an event identical to e has already been queued, that is if
+ * the next call to getEvent would return it right away. Sources that generate
+ * events on demand, like keyboard scanning, never have queued events. */
+bool isQueued(Event e);
+bool canRepeatEvent(Event e);
+
 ShiftAlphaStatus shiftAlphaStatus();
 void setShiftAlphaStatus(ShiftAlphaStatus s);
 bool isShiftActive();
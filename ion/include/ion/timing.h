@@ -0,0 +1,24 @@
+#ifndef ION_TIMING_H
+#define ION_TIMING_H
+
+#include <stdint.h>
+
+namespace Ion {
+namespace Timing {
+
+/* A free-running counter to measure short durations: the CPU cycle counter on
+ * the device, a monotonic clock in nanoseconds on hosts. It wraps around, after
+ * 44 seconds on the device and 4 seconds on hosts, so only the difference
+ * between two close readings is meaningful. */
+uint32_t ticks();
+uint32_t ticksPerSecond();
+
+/* Microseconds since boot on the device, since the first call on hosts. It
+ * wraps around after 71 minutes, but doesn't depend on ticks: it can be read
+ * after any idle period. */
+uint32_t microseconds();
+
+}
+}
+
+#endif
@@ -0,0 +1,113 @@
+#ifndef ION_TRACE_H
+#define ION_TRACE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Binary tracing, enabled with ION_TRACE=1. Otherwise the ION_TRACE_ macros
+ * expand to nothing.
+ *
+ * Spans, counters and instant events append 12-byte records to a ring buffer
+ * in RAM. Event names must be string literals: a name is copied into the
+ * buffer's name pool the first time its call site runs, and records refer to
+ * it by its offset in the pool.
+ *
+ * On the device, the ring keeps the last k_capacity records and can be dumped
+ * from gdb with "dump binary value trace.bin Ion::Trace::buffer". On the
+ * blackbox, records are streamed to a file (ION_TRACE_FILE, trace.bin by
+ * default). Both have the same layout: the header, the name pool, then the
+ * records. ion/src/shared/tools/trace_to_chrome converts it to the Chrome
+ * trace event format, which chrome://tracing and Perfetto display. */
+
+namespace Ion {
+namespace Trace {
+
+constexpr uint32_t k_magic = 0x45435254; // "TRCE"
+constexpr uint16_t k_version = 1;
+constexpr int k_capacity = 512;
+constexpr int k_namePoolSize = 1024;
+constexpr uint16_t k_invalidName = 0xFFFF;
+
+enum class Type : uint8_t {
+  Begin = 1,
+  End = 2,
+  Counter = 3,
+  Instant = 4
+};
+
+struct Header {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t recordSize;
+  uint32_t numberOfRecords; // Recorded since the start, even if dropped
+  uint32_t capacity; // 0 when records are streamed rather than kept in a ring
+  uint32_t namePoolSize;
+};
+
+/* Timestamps are in microseconds since the first record, or 0 if the trace was
+ * initialized without a clock. */
+struct Record {
+  uint32_t timestamp;
+  int32_t value; // Counters only
+  uint16_t name; // Offset in the name pool
+  Type type;
+  uint8_t reserved;
+};
+
+static_assert(sizeof(Record) == 12, "Trace records should be packed");
+
+struct Buffer {
+  Header header;
+  char namePool[k_namePoolSize];
+  Record records[k_capacity];
+};
+
+extern Buffer buffer;
+
+typedef uint32_t (*Clock)();
+/* The sink receives the buffer and the number of records accumulated since
+ * the last call. Without a sink, old records are overwritten. */
+typedef void (*Sink)(const Buffer * buffer, int numberOfRecords);
+
+/* Recording before init sets up a ring timed by Ion::Timing::microseconds. */
+void init(Clock clock, Sink sink);
+void record(Type type, uint16_t name, int32_t value = 0);
+void flush();
+/* Returns the offset of name in the pool, adding it on first use. The offset
+ * is cached in *cache, which call sites keep in a static. */
+uint16_t nameOffset(const char * name, uint16_t * cache);
+
+class Span {
+public:
+  Span(uint16_t name) : m_name(name) { record(Type::Begin, name); }
+  ~Span() { record(Type::End, m_name); }
+private:
+  uint16_t m_name;
+};
+
+}
+}
+
+#if ION_TRACE
+
+#define ION_TRACE_NAME(name) ([]() { static uint16_t sCache = Ion::Trace::k_invalidName; return Ion::Trace::nameOffset(name, &sCache); }())
+#define ION_TRACE_BEGIN(name) Ion::Trace::record(Ion::Trace::Type::Begin, ION_TRACE_NAME(name))
+#define ION_TRACE_END(name) Ion::Trace::record(Ion::Trace::Type::End, ION_TRACE_NAME(name))
+#define ION_TRACE_COUNTER(name, value) Ion::Trace::record(Ion::Trace::Type::Counter, ION_TRACE_NAME(name), value)
+#define ION_TRACE_INSTANT(name) Ion::Trace::record(Ion::Trace::Type::Instant, ION_TRACE_NAME(name))
+/* Traces a span until the end of the enclosing scope */
+#define ION_TRACE_SCOPE_NAME(line) ionTraceSpan##line
+#define ION_TRACE_SCOPE_AT(name, line) Ion::Trace::Span ION_TRACE_SCOPE_NAME(line)(ION_TRACE_NAME(name))
+#define ION_TRACE_SCOPE(name) ION_TRACE_SCOPE_AT(name, __LINE__)
+
+#else
+
+#define ION_TRACE_BEGIN(name)
+#define ION_TRACE_END(name)
+#define ION_TRACE_COUNTER(name, value)
+#define ION_TRACE_INSTANT(name)
+#define ION_TRACE_SCOPE(name)
+
+#endif
+
+#endif
@@ -3,6 +3,7 @@
 #include <signal.h>
 #include "events.h"
 #include "display.h"
+#include "trace.h"
 
 constexpr int kHeapSize = 131072;
 char heap[kHeapSize];
@@ -20,6 +21,9 @@ int main(int argc, char * argv[]) {
     }
   }
   signal(SIGABRT, Ion::Events::Blackbox::dumpEventCount);
+#if ION_TRACE
+  Ion::Trace::Blackbox::start();
+#endif
   ion_app();
   return 0;
 }
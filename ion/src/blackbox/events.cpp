@@ -1,6 +1,8 @@
 #include <ion/events.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <poll.h>
+#include <unistd.h>
 #include "display.h"
 
 namespace Ion {
@@ -9,16 +11,41 @@ namespace Events {
 static int sLogAfterNumberOfEvents = -1;
 static int sEventCount = 0;
 
+/* Standard input is read through this buffer rather than stdio, so that
+ * isQueued can tell whether a byte is available without blocking, even when
+ * events are typed in a terminal. */
+static unsigned char sInput[64];
+static int sInputStart = 0;
+static int sInputEnd = 0;
+
+static bool fillInput(bool wait) {
+  if (sInputStart < sInputEnd) {
+    return true;
+  }
+  if (!wait) {
+    struct pollfd input = {STDIN_FILENO, POLLIN, 0};
+    if (poll(&input, 1, 0) <= 0) {
+      return false;
+    }
+  }
+  ssize_t length = read(STDIN_FILENO, sInput, sizeof(sInput));
+  if (length <= 0) {
+    return false;
+  }
+  sInputStart = 0;
+  sInputEnd = length;
+  return true;
+}
+
 Event getEvent(int * timeout) {
   Ion::Events::Event event = Ion::Events::None;
   while (!(event.isDefined() && event.isKeyboardEvent())) {
-    int c = getchar();
-    if (c == EOF) {
+    if (!fillInput(true)) {
       printf("Finished processing %d events\n", sEventCount);
       event = Ion::Events::Termination;
       break;
     }
-    event = Ion::Events::Event(c);
+    event = Ion::Events::Event(sInput[sInputStart++]);
   }
   if (sEventCount++ > sLogAfterNumberOfEvents && sLogAfterNumberOfEvents >= 0) {
     char filename[32];
@@ -31,6 +58,15 @@ Event getEvent(int * timeout) {
   return event;
 }
 
+bool isQueued(Event e) {
+  /* Once logging, each event writes the frame drawn for the previous one, so
+   * no event may skip its redraw. */
+  if (sLogAfterNumberOfEvents >= 0) {
+    return false;
+  }
+  return fillInput(false) && Event(sInput[sInputStart]) == e;
+}
+
 namespace Blackbox {
 
 void dumpEventCount(int i) {
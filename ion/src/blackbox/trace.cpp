@@ -0,0 +1,43 @@
+#include "trace.h"
+#include <ion/timing.h>
+#include <ion/trace.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Ion {
+namespace Trace {
+namespace Blackbox {
+
+static int sFile = -1;
+
+static void writeToFile(const Buffer * buffer, int numberOfRecords) {
+  if (sFile < 0) {
+    const char * path = getenv("ION_TRACE_FILE");
+    sFile = open(path != nullptr ? path : "trace.bin", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (sFile < 0) {
+      return;
+    }
+  }
+  /* The header and the name pool are rewritten, as both grow while tracing,
+   * and the records are appended after them. */
+  constexpr off_t recordsOffset = offsetof(Buffer, records);
+  if (pwrite(sFile, buffer, recordsOffset, 0) < 0) {
+    return;
+  }
+  off_t end = lseek(sFile, 0, SEEK_END);
+  if (end < recordsOffset) {
+    end = recordsOffset;
+  }
+  pwrite(sFile, buffer->records, numberOfRecords * sizeof(Record), end);
+}
+
+void start() {
+  init(Timing::microseconds, writeToFile);
+  atexit(flush);
+}
+
+}
+}
+}
@@ -0,0 +1,16 @@
+#ifndef ION_BLACKBOX_TRACE_H
+#define ION_BLACKBOX_TRACE_H
+
+namespace Ion {
+namespace Trace {
+namespace Blackbox {
+
+/* Streams the trace to the file named by ION_TRACE_FILE, trace.bin by default,
+ * until the program exits. */
+void start();
+
+}
+}
+}
+
+#endif
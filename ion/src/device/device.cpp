@@ -12,6 +12,7 @@ extern "C" {
 #include "backlight.h"
 #include "console.h"
 #include "swd.h"
+#include "timing.h"
 #include "usb.h"
 #include "bench/bench.h"
 
@@ -100,6 +101,7 @@ void initFPU() {
 
 void init() {
   initClocks();
+  Timing::Device::init();
 
   // Put all inputs as Analog Input, No pull-up nor pull-down
   // Except for the SWD port (PB3, PA13, PA14)
@@ -123,6 +125,7 @@ void init() {
 
 void shutdown() {
   shutdownPeripherals();
+  Timing::Device::shutdown();
   shutdownClocks();
 }
 
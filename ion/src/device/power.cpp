@@ -4,6 +4,7 @@
 #include "display.h"
 #include "keyboard.h"
 #include "led.h"
+#include "timing.h"
 #include "usb.h"
 #include "wakeup.h"
 #include "regs/regs.h"
@@ -18,6 +19,7 @@ void Ion::Power::suspend(bool checkIfPowerKeyReleased) {
     }
   }
   Device::shutdownPeripherals();
+  Timing::Device::shutdown();
 
   PWR.CR()->setLPDS(true); // Turn the regulator off. Takes longer to wake up.
   PWR.CR()->setFPDS(true); // Put the flash to sleep. Takes longer to wake up.
@@ -63,6 +65,7 @@ void Ion::Power::suspend(bool checkIfPowerKeyReleased) {
     }
   }
   Device::initClocks();
+  Timing::Device::init();
 
   Device::initPeripherals();
 }
@@ -18,6 +18,13 @@ public:
   };
 
 
+  // Interrupt Control and State Register
+  // http://infocenter.arm.com/help/index.jsp?topic=/com.arm.doc.dui0553a/Cihfaaha.html
+  class ICSR : public Register32 {
+  public:
+    REGS_BOOL_FIELD_R(PENDSTSET, 26);
+  };
+
   // Application Interrupt and Reset Control Register
   // http://infocenter.arm.com/help/index.jsp?topic=/com.arm.doc.dui0552a/Cihehdge.html
   class AIRCR : public Register32 {
@@ -33,10 +40,18 @@ public:
     REGS_BOOL_FIELD(SLEEPDEEP, 2);
   };
 
+  // Debug Exception and Monitor Control Register, see the ARMv7-M ARM, C1.6.5
+  class DEMCR : public Register32 {
+  public:
+    REGS_BOOL_FIELD(TRCENA, 24);
+  };
+
   constexpr CM4() {};
+  REGS_REGISTER_AT(ICSR, 0x04);
   REGS_REGISTER_AT(AIRCR, 0x0C);
   REGS_REGISTER_AT(SCR, 0x10);
   REGS_REGISTER_AT(CPACR, 0x88);
+  REGS_REGISTER_AT(DEMCR, 0xFC);
 private:
   constexpr uint32_t Base() const {
     return 0xE000ED00;
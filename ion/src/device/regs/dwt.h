@@ -0,0 +1,29 @@
+#ifndef REGS_DWT_H
+#define REGS_DWT_H
+
+#include "register.h"
+
+// Data Watchpoint and Trace unit, see the ARMv7-M ARM, section C1.8
+
+class DWT {
+public:
+  class CTRL : public Register32 {
+  public:
+    REGS_BOOL_FIELD(CYCCNTENA, 0);
+  };
+
+  class CYCCNT : public Register32 {
+  };
+
+  constexpr DWT() {};
+  REGS_REGISTER_AT(CTRL, 0x00);
+  REGS_REGISTER_AT(CYCCNT, 0x04);
+private:
+  constexpr uint32_t Base() const {
+    return 0xE0001000;
+  }
+};
+
+constexpr DWT DWT;
+
+#endif
@@ -5,6 +5,7 @@
 #include "cm4.h"
 #include "crc.h"
 #include "dma.h"
+#include "dwt.h"
 #include "exti.h"
 #include "flash.h"
 #include "fsmc.h"
@@ -16,6 +17,7 @@
 #include "sdio.h"
 #include "spi.h"
 #include "syscfg.h"
+#include "systick.h"
 #include "tim.h"
 #include "usart.h"
 
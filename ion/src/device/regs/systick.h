@@ -0,0 +1,37 @@
+#ifndef REGS_SYSTICK_H
+#define REGS_SYSTICK_H
+
+#include "register.h"
+
+// SysTick timer, see the ARMv7-M ARM, section B3.3
+
+class SYSTICK {
+public:
+  class CSR : public Register32 {
+  public:
+    using Register32::Register32;
+    REGS_BOOL_FIELD(ENABLE, 0);
+    REGS_BOOL_FIELD(TICKINT, 1);
+    REGS_BOOL_FIELD(CLKSOURCE, 2);
+  };
+
+  // 24-bit reload and current values, set as a whole
+  class RVR : public Register32 {
+  };
+
+  class CVR : public Register32 {
+  };
+
+  constexpr SYSTICK() {};
+  REGS_REGISTER_AT(CSR, 0x00);
+  REGS_REGISTER_AT(RVR, 0x04);
+  REGS_REGISTER_AT(CVR, 0x08);
+private:
+  constexpr uint32_t Base() const {
+    return 0xE000E010;
+  }
+};
+
+constexpr SYSTICK SYSTICK;
+
+#endif
@@ -0,0 +1,72 @@
+#include <ion/timing.h>
+#include "timing.h"
+#include "regs/regs.h"
+extern "C" {
+#include "boot/rt0.h"
+}
+
+/* Incremented by the SysTick interrupt, which fires every millisecond. Unlike
+ * the cycle counter, it doesn't wrap around for 49 days. */
+static volatile uint32_t sMilliseconds = 0;
+
+void systick() {
+  sMilliseconds = sMilliseconds + 1;
+}
+
+// Public Ion::Timing methods
+
+uint32_t Ion::Timing::ticks() {
+  return DWT.CYCCNT()->get();
+}
+
+uint32_t Ion::Timing::ticksPerSecond() {
+  return Device::CyclesPerSecond;
+}
+
+uint32_t Ion::Timing::microseconds() {
+  uint32_t milliseconds;
+  uint32_t current;
+  uint32_t millisecondsBeforeReading;
+  // Read again if the interrupt ran meanwhile
+  do {
+    millisecondsBeforeReading = sMilliseconds;
+    milliseconds = millisecondsBeforeReading;
+    current = SYSTICK.CVR()->get();
+    /* The counter may have wrapped around before its interrupt ran. It then
+     * counts down from the reload value again, so read it again. */
+    if (CM4.ICSR()->getPENDSTSET()) {
+      milliseconds++;
+      current = SYSTICK.CVR()->get();
+    }
+  } while (sMilliseconds != millisecondsBeforeReading);
+  uint32_t elapsedCycles = Device::CyclesPerMillisecond - 1 - current;
+  return milliseconds * 1000 + elapsedCycles / (Device::CyclesPerSecond / 1000000);
+}
+
+// Private Ion::Timing::Device methods
+
+namespace Ion {
+namespace Timing {
+namespace Device {
+
+void init() {
+  CM4.DEMCR()->setTRCENA(true);
+  DWT.CYCCNT()->set(0);
+  DWT.CTRL()->setCYCCNTENA(true);
+
+  SYSTICK.RVR()->set(CyclesPerMillisecond - 1);
+  SYSTICK.CVR()->set(0);
+  class SYSTICK::CSR csr(0);
+  csr.setCLKSOURCE(true); // Processor clock
+  csr.setTICKINT(true);
+  csr.setENABLE(true);
+  SYSTICK.CSR()->set(csr);
+}
+
+void shutdown() {
+  SYSTICK.CSR()->setENABLE(false);
+}
+
+}
+}
+}
@@ -0,0 +1,25 @@
+#ifndef ION_DEVICE_TIMING_H
+#define ION_DEVICE_TIMING_H
+
+#include <stdint.h>
+
+namespace Ion {
+namespace Timing {
+namespace Device {
+
+/* Starts the cycle counter of the DWT unit, which only runs while the trace
+ * and debug blocks are enabled, and the SysTick timer, which counts the
+ * milliseconds behind microseconds. */
+void init();
+/* Stops the SysTick timer, whose interrupt would wake the device up. Time
+ * doesn't flow while the device is suspended. */
+void shutdown();
+
+constexpr uint32_t CyclesPerSecond = 96000000; // See Ion::Device::initClocks
+constexpr uint32_t CyclesPerMillisecond = CyclesPerSecond/1000;
+
+}
+}
+}
+
+#endif
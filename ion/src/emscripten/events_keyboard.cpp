@@ -64,6 +64,10 @@ Event getEvent(int * timeout) {
   return Ion::Events::None;
 }
 
+bool isQueued(Event e) {
+  return sEvent == e;
+}
+
 }
 }
 
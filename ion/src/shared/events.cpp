@@ -122,6 +122,10 @@ bool Event::hasText() const {
   return text() != nullptr;
 }
 
+bool canRepeatEvent(Event e) {
+  return (e == Events::Left || e == Events::Up || e == Events::Down || e == Events::Right || e == Events::Backspace);
+}
+
 bool Event::isDefined() const {
   if (isKeyboardEvent()) {
     return s_dataForEvent[m_id].isDefined();
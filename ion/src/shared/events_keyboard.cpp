@@ -22,14 +22,33 @@ bool sEventIsRepeating = 0;
 constexpr int delayBeforeRepeat = 200;
 constexpr int delayBetweenRepeat = 50;
 
-bool canRepeatEvent(Event e) {
-  return (e == Events::Left || e == Events::Up || e == Events::Down || e == Events::Right || e == Events::Backspace);
+/* Repeat delays run from the moment the previous event was returned, so that
+ * the time the app spends handling it and redrawing counts towards them. The
+ * next event may come after any idle period, which ticks can't measure. */
+static uint32_t sLastEventTime = 0;
+
+static int millisecondsSinceLastEvent() {
+  return (Timing::microseconds() - sLastEventTime) / 1000;
+}
+
+static bool repeatIsDue(Keyboard::State state, int time) {
+  if (!canRepeatEvent(sLastEvent) || state != sLastKeyboardState) {
+    return false;
+  }
+  return time >= (sEventIsRepeating ? delayBetweenRepeat : delayBeforeRepeat);
+}
+
+static Event returnEvent(Event event, Keyboard::State state) {
+  sLastEvent = event;
+  sLastKeyboardState = state;
+  sLastEventTime = Timing::microseconds();
+  return event;
 }
 
 Event getEvent(int * timeout) {
   assert(*timeout > delayBeforeRepeat);
   assert(*timeout > delayBetweenRepeat);
-  int time = 0;
+  int time = millisecondsSinceLastEvent();
   uint64_t keysSeenUp = 0;
   uint64_t keysSeenTransitionningFromUpToDown = 0;
   while (true) {
@@ -47,9 +66,13 @@ Event getEvent(int * timeout) {
       Keyboard::Key key = (Keyboard::Key)(63-__builtin_clzll(keysSeenTransitionningFromUpToDown));
       Event event(key, isShiftActive(), isAlphaActive());
       updateModifiersFromEvent(event);
-      sLastEvent = event;
-      sLastKeyboardState = state;
-      return event;
+      return returnEvent(event, state);
+    }
+
+    // No new key has been pressed
+    if (repeatIsDue(state, time)) {
+      sEventIsRepeating = true;
+      return returnEvent(sLastEvent, state);
     }
 
     if (sleepWithTimeout(10, timeout)) {
@@ -57,19 +80,14 @@ Event getEvent(int * timeout) {
       return Events::None;
     }
     time += 10;
-
-    // At this point, we know that keysSeenTransitionningFromUpToDown has *always* been zero
-    // In other words, no new key has been pressed
-    if (canRepeatEvent(sLastEvent) && (state == sLastKeyboardState)) {
-      int delay = (sEventIsRepeating ? delayBetweenRepeat : delayBeforeRepeat);
-      if (time >= delay) {
-        sEventIsRepeating = true;
-        sLastKeyboardState = state;
-        return sLastEvent;
-      }
-    }
   }
 }
 
+bool isQueued(Event e) {
+  /* The keyboard has no buffer: the only event that can be waiting is the
+   * repeat of a key still held, once its delay has elapsed. */
+  return e == sLastEvent && repeatIsDue(Keyboard::scan(), millisecondsSinceLastEvent());
+}
+
 }
 }
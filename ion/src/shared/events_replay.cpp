@@ -17,8 +17,9 @@ const Event sequence[] = {
   Up, Up, Up, Up, Up, Up
 };
 
+static int i = 0;
+
 Event Ion::Events::getEvent(int * timeout) {
-  static int i = 0;
   int sequenceLength = sizeof(sequence)/sizeof(sequence[0]);
   if (i == sequenceLength) {
     i = sequenceLength - loopLength;
@@ -29,3 +30,9 @@ Event Ion::Events::getEvent(int * timeout) {
   }
   return sequence[i++];
 }
+
+bool Ion::Events::isQueued(Event e) {
+  int sequenceLength = sizeof(sequence)/sizeof(sequence[0]);
+  int next = (i == sequenceLength ? sequenceLength - loopLength : i);
+  return next < sequenceLength && sequence[next] == e;
+}
@@ -14,3 +14,12 @@ Ion::Events::Event Ion::Events::getEvent(int * timeout) {
     return Ion::Events::Event(c);
   }
 }
+
+bool Ion::Events::isQueued(Event e) {
+  int c = getchar();
+  if (c == EOF) {
+    return false;
+  }
+  ungetc(c, stdin);
+  return Ion::Events::Event(c) == e;
+}
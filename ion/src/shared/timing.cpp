@@ -0,0 +1,6 @@
+#include <ion/timing.h>
+
+// For liba, which is written in C
+extern "C" uint32_t ion_microseconds() {
+  return Ion::Timing::microseconds();
+}
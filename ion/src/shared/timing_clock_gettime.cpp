@@ -0,0 +1,21 @@
+#include <ion/timing.h>
+#include <time.h>
+
+static uint64_t monotonicNanoseconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint64_t)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+uint32_t Ion::Timing::ticks() {
+  return monotonicNanoseconds();
+}
+
+uint32_t Ion::Timing::ticksPerSecond() {
+  return 1000000000;
+}
+
+uint32_t Ion::Timing::microseconds() {
+  static uint64_t sStart = monotonicNanoseconds();
+  return (monotonicNanoseconds() - sStart) / 1000;
+}
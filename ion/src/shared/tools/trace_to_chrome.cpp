@@ -0,0 +1,94 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <ion/trace.h>
+
+/* Converts a trace recorded with ION_TRACE=1 to the Chrome trace event format,
+ * which chrome://tracing and ui.perfetto.dev open.
+ * Usage: trace_to_chrome trace.bin > trace.json
+ * Traces recorded without a clock are laid out with one microsecond per
+ * record, which keeps the nesting of spans but not their durations. */
+
+using namespace Ion::Trace;
+
+static void printName(const std::vector<char> & data, size_t namePoolOffset, size_t namePoolSize, uint16_t name) {
+  putchar('"');
+  if (name < namePoolSize) {
+    for (size_t i = namePoolOffset + name; i < namePoolOffset + namePoolSize && data[i] != 0; i++) {
+      if (data[i] == '"' || data[i] == '\\') {
+        putchar('\\');
+      }
+      putchar(data[i]);
+    }
+  } else {
+    printf("unknown %d", name);
+  }
+  putchar('"');
+}
+
+int main(int argc, char * argv[]) {
+  if (argc != 2) {
+    fprintf(stderr, "Usage: %s trace.bin\n", argv[0]);
+    return 1;
+  }
+  std::ifstream file(argv[1], std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  Header header;
+  if (data.size() < sizeof(Header)) {
+    fprintf(stderr, "%s: not a trace\n", argv[1]);
+    return 1;
+  }
+  memcpy(&header, &data[0], sizeof(Header));
+  size_t recordsOffset = sizeof(Header) + header.namePoolSize;
+  if (header.magic != k_magic || header.version != k_version || header.recordSize != sizeof(Record) || data.size() < recordsOffset) {
+    fprintf(stderr, "%s: not a trace, or of another version\n", argv[1]);
+    return 1;
+  }
+
+  size_t storedRecords = (data.size() - recordsOffset) / sizeof(Record);
+  size_t first = 0;
+  size_t count = storedRecords;
+  if (header.capacity != 0) {
+    // A ring dump: the oldest record follows the newest one once it wrapped
+    count = std::min<size_t>(std::min<size_t>(header.numberOfRecords, header.capacity), storedRecords);
+    first = header.numberOfRecords > header.capacity ? header.numberOfRecords % header.capacity : 0;
+  }
+  std::vector<Record> records(count);
+  bool hasClock = false;
+  for (size_t i = 0; i < count; i++) {
+    size_t index = header.capacity != 0 ? (first + i) % header.capacity : i;
+    memcpy(&records[i], &data[recordsOffset + index * sizeof(Record)], sizeof(Record));
+    hasClock = hasClock || records[i].timestamp != 0;
+  }
+
+  printf("{\"traceEvents\":[\n");
+  for (size_t i = 0; i < count; i++) {
+    const Record & r = records[i];
+    printf("%s{\"name\":", i == 0 ? "" : ",\n");
+    printName(data, sizeof(Header), header.namePoolSize, r.name);
+    printf(",\"pid\":1,\"tid\":1,\"ts\":%u", hasClock ? r.timestamp : (uint32_t)i);
+    switch (r.type) {
+      case Type::Begin:
+        printf(",\"ph\":\"B\"}");
+        break;
+      case Type::End:
+        printf(",\"ph\":\"E\"}");
+        break;
+      case Type::Counter:
+        printf(",\"ph\":\"C\",\"args\":{\"value\":%d}}", r.value);
+        break;
+      default:
+        printf(",\"ph\":\"i\",\"s\":\"t\"}");
+        break;
+    }
+  }
+  printf("\n],\"displayTimeUnit\":\"ms\"}\n");
+  if (header.capacity == 0 && storedRecords != header.numberOfRecords) {
+    fprintf(stderr, "%s: %zu records out of %u, the trace may be truncated\n", argv[1], storedRecords, header.numberOfRecords);
+  }
+  return 0;
+}
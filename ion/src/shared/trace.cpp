@@ -0,0 +1,91 @@
+#include <ion/trace.h>
+#include <ion/timing.h>
+#include <string.h>
+
+namespace Ion {
+namespace Trace {
+
+Buffer buffer;
+
+static Clock sClock = nullptr;
+static uint32_t sStartTime = 0;
+static Sink sSink = nullptr;
+static int sNumberOfPendingRecords = 0;
+static int sNamePoolUsedSize = 0;
+static bool sIsFlushing = false;
+
+void init(Clock clock, Sink sink) {
+  Header * header = &buffer.header;
+  header->magic = k_magic;
+  header->version = k_version;
+  header->recordSize = sizeof(Record);
+  header->numberOfRecords = 0;
+  header->capacity = sink == nullptr ? k_capacity : 0;
+  header->namePoolSize = k_namePoolSize;
+  sClock = clock;
+  sStartTime = clock == nullptr ? 0 : clock();
+  sSink = sink;
+  sNumberOfPendingRecords = 0;
+}
+
+void record(Type type, uint16_t name, int32_t value) {
+  if (sIsFlushing || name == k_invalidName) {
+    return;
+  }
+  if (buffer.header.magic != k_magic) {
+    init(Timing::microseconds, nullptr);
+  }
+  if (sSink != nullptr && sNumberOfPendingRecords == k_capacity) {
+    flush();
+  }
+  int index = sSink != nullptr ? sNumberOfPendingRecords : buffer.header.numberOfRecords % k_capacity;
+  Record * r = &buffer.records[index];
+  r->timestamp = sClock == nullptr ? 0 : sClock() - sStartTime;
+  r->value = value;
+  r->name = name;
+  r->type = type;
+  r->reserved = 0;
+  buffer.header.numberOfRecords++;
+  if (sSink != nullptr) {
+    sNumberOfPendingRecords++;
+  }
+}
+
+void flush() {
+  if (sSink == nullptr || sIsFlushing) {
+    return;
+  }
+  // The sink may run traced code, which must not append to the records it reads
+  sIsFlushing = true;
+  sSink(&buffer, sNumberOfPendingRecords);
+  sNumberOfPendingRecords = 0;
+  sIsFlushing = false;
+}
+
+uint16_t nameOffset(const char * name, uint16_t * cache) {
+  if (*cache != k_invalidName) {
+    return *cache;
+  }
+  /* Call sites that share a name share its entry in the pool, so that the
+   * converter can match the ends of spans with their beginnings. */
+  int offset = 0;
+  while (offset < sNamePoolUsedSize) {
+    if (strcmp(buffer.namePool + offset, name) == 0) {
+      *cache = offset;
+      return offset;
+    }
+    offset += strlen(buffer.namePool + offset) + 1;
+  }
+  int length = strlen(name) + 1;
+  if (sNamePoolUsedSize + length > k_namePoolSize) {
+    // The pool is full: records with this name are dropped
+    return k_invalidName;
+  }
+  memcpy(buffer.namePool + sNamePoolUsedSize, name, length);
+  *cache = sNamePoolUsedSize;
+  sNamePoolUsedSize += length;
+  return *cache;
+}
+
+}
+}
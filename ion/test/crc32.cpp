@@ -8,3 +8,9 @@ QUIZ_CASE(ion_crc32) {
   assert(Ion::crc32(input, 2) == 0x72EAD3FB);
 }
 
+static volatile uint32_t sSink;
+
+QUIZ_BENCH(ion_crc32_bench) {
+  static uint32_t input[256];
+  sSink = Ion::crc32(input, sizeof(input)/sizeof(uint32_t));
+}
@@ -0,0 +1,18 @@
+#include <quiz.h>
+#include <ion.h>
+#include <assert.h>
+
+QUIZ_CASE(ion_timing) {
+  assert(Ion::Timing::ticksPerSecond() >= 1000000);
+  uint32_t microseconds = Ion::Timing::microseconds();
+  uint32_t start = Ion::Timing::ticks();
+  volatile uint32_t sink = 0;
+  for (int i = 0; i < 100000; i++) {
+    sink = sink + i;
+  }
+  uint32_t elapsedTicks = Ion::Timing::ticks() - start;
+  assert(elapsedTicks > 0);
+  // Both clocks measure the same duration, give or take rounding
+  uint32_t elapsedMicroseconds = Ion::Timing::microseconds() - microseconds;
+  assert(elapsedMicroseconds + 1 >= elapsedTicks / (Ion::Timing::ticksPerSecond() / 1000000));
+}
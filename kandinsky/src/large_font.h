@@ -0,0 +1,9 @@
+/* Auto-generated by rasterizer */
+
+#define BITMAP_LargeFont_FIRST_CHARACTER 0x20
+#define BITMAP_LargeFont_LAST_CHARACTER 0x92
+
+#define BITMAP_LargeFont_CHARACTER_WIDTH 10
+#define BITMAP_LargeFont_CHARACTER_HEIGHT 19
+
+extern unsigned char bitmapLargeFont[115][19][10];
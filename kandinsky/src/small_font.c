@@ -0,0 +1,1729 @@
+/* Auto-generated by rasterizer */
+
+unsigned char bitmapSmallFont[115][13][7] = {
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0xfc, 0x00, 0xfc, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x4e, 0xdf, 0xfe, 0xe1, 0x72, 0x00},
+    {0x00, 0xe7, 0x31, 0x03, 0x38, 0xb5, 0x0c},
+    {0x00, 0xd9, 0x7a, 0x06, 0x00, 0x00, 0x00},
+    {0x00, 0x1a, 0xa6, 0xe8, 0x9f, 0x1e, 0x00},
+    {0x00, 0x0b, 0x00, 0x12, 0x7a, 0xdf, 0x00},
+    {0x0b, 0xe2, 0x5d, 0x07, 0x37, 0xeb, 0x00},
+    {0x00, 0x3d, 0xdd, 0xff, 0xeb, 0x64, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x9f},
+    {0x00, 0xff, 0x00, 0x00, 0x2b, 0xca, 0x0a},
+    {0x00, 0x00, 0x00, 0x0b, 0xcb, 0x29, 0x00},
+    {0x00, 0x00, 0x00, 0xa1, 0x5e, 0x00, 0x00},
+    {0x00, 0x00, 0x62, 0x9c, 0x00, 0x00, 0x00},
+    {0x00, 0x2c, 0xc9, 0x09, 0x00, 0x00, 0x00},
+    {0x0b, 0xcb, 0x28, 0x00, 0x00, 0x00, 0xff},
+    {0xa3, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x50, 0xe4, 0xe8, 0x5c, 0x00, 0x00},
+    {0x00, 0xeb, 0x2a, 0x39, 0xea, 0x00, 0x00},
+    {0x00, 0xe8, 0x1f, 0x47, 0xdd, 0x00, 0x00},
+    {0x00, 0x9a, 0xd8, 0xe1, 0x38, 0x00, 0x00},
+    {0x59, 0xfe, 0xff, 0x78, 0x00, 0x52, 0xbd},
+    {0xe5, 0x2c, 0x71, 0xf8, 0x54, 0xe4, 0x33},
+    {0xe2, 0x38, 0x01, 0x71, 0xff, 0xaf, 0x0c},
+    {0x2f, 0xc1, 0xf7, 0xf8, 0xa0, 0xc7, 0xf9},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0b, 0x99, 0x09},
+    {0x00, 0x00, 0x00, 0x00, 0xb2, 0xbe, 0x10},
+    {0x00, 0x00, 0x00, 0x50, 0xd2, 0x09, 0x00},
+    {0x00, 0x00, 0x00, 0xaf, 0x53, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe4, 0x15, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf9, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xe9, 0x0e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xbd, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x67, 0xae, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x05, 0xd4, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x23, 0xcf, 0x17},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0d, 0x9a, 0x09, 0x00, 0x00, 0x00, 0x00},
+    {0x0b, 0xb6, 0xa9, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x09, 0xd2, 0x41, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x51, 0xa3, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x1e, 0xdf, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x05, 0xf8, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0xea, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3c, 0xc5, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xa8, 0x71, 0x00, 0x00, 0x00},
+    {0x02, 0x89, 0xdb, 0x0a, 0x00, 0x00, 0x00},
+    {0x16, 0xcf, 0x2a, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x80, 0xff, 0x7f, 0xff, 0x00},
+    {0x00, 0x2b, 0xae, 0xff, 0xae, 0x2b, 0x00},
+    {0x00, 0x63, 0xf6, 0x82, 0xef, 0x63, 0x00},
+    {0x00, 0xff, 0x72, 0x00, 0x63, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0xc7, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x21, 0xe4, 0x00, 0x00},
+    {0x00, 0x00, 0x16, 0xbe, 0x59, 0x00, 0x00},
+    {0x00, 0x00, 0xa1, 0x57, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x2e, 0xfe, 0x1e},
+    {0x00, 0x00, 0x00, 0x00, 0x8c, 0xbf, 0x00},
+    {0x00, 0x00, 0x00, 0x02, 0xe5, 0x62, 0x00},
+    {0x00, 0x00, 0x00, 0x46, 0xf7, 0x0e, 0x00},
+    {0x00, 0x00, 0x00, 0xa3, 0xa8, 0x00, 0x00},
+    {0x00, 0x00, 0x0b, 0xf4, 0x4b, 0x00, 0x00},
+    {0x00, 0x00, 0x5d, 0xea, 0x04, 0x00, 0x00},
+    {0x00, 0x00, 0xba, 0x91, 0x00, 0x00, 0x00},
+    {0x00, 0x1a, 0xfd, 0x34, 0x00, 0x00, 0x00},
+    {0x00, 0x74, 0xd7, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xd1, 0x7a, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x31, 0xd1, 0xf9, 0xdc, 0x3f, 0x00},
+    {0x00, 0xba, 0x84, 0x08, 0x70, 0xc3, 0x00},
+    {0x00, 0xeb, 0x1b, 0x00, 0x15, 0xee, 0x00},
+    {0x00, 0xfb, 0x04, 0xcc, 0x04, 0xfb, 0x00},
+    {0x00, 0xfb, 0x04, 0xd3, 0x03, 0xfa, 0x00},
+    {0x00, 0xea, 0x19, 0x00, 0x15, 0xec, 0x00},
+    {0x00, 0xb9, 0x7d, 0x07, 0x74, 0xbe, 0x00},
+    {0x00, 0x32, 0xd5, 0xf9, 0xd8, 0x38, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x05, 0xff, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x47, 0xd9, 0xf8, 0xc9, 0x30, 0x00},
+    {0x00, 0xa8, 0x40, 0x09, 0x63, 0xd5, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x11, 0xf7, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x64, 0xb8, 0x00},
+    {0x00, 0x00, 0x00, 0x46, 0xe1, 0x25, 0x00},
+    {0x00, 0x00, 0x59, 0xe5, 0x30, 0x00, 0x00},
+    {0x00, 0x72, 0xe1, 0x28, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x54, 0xd6, 0xf9, 0xea, 0x84, 0x00},
+    {0x18, 0xe5, 0x56, 0x0c, 0x4f, 0xf7, 0x00},
+    {0x00, 0x0a, 0x02, 0x0c, 0x4a, 0xf8, 0x00},
+    {0x00, 0x00, 0xff, 0xff, 0xff, 0x80, 0x00},
+    {0x00, 0x00, 0x09, 0x27, 0x9b, 0xe6, 0x00},
+    {0x00, 0x02, 0x00, 0x00, 0x0d, 0xfe, 0x00},
+    {0x16, 0xd0, 0x40, 0x08, 0x56, 0xe4, 0x00},
+    {0x00, 0x60, 0xd6, 0xf7, 0xd5, 0x45, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x4c, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x08, 0xdd, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x80, 0xaa, 0xff, 0x00, 0x00},
+    {0x00, 0x22, 0xe2, 0x15, 0xff, 0x00, 0x00},
+    {0x00, 0xb3, 0x55, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xfd, 0xe5, 0x68, 0x00},
+    {0x00, 0x00, 0x00, 0x05, 0x5c, 0xee, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x06, 0xfd, 0x00},
+    {0x00, 0x00, 0x00, 0x04, 0x59, 0xf1, 0x00},
+    {0x00, 0xff, 0xff, 0xfe, 0xe7, 0x70, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x1a, 0xb6, 0xf0, 0xff, 0xff, 0x00},
+    {0x00, 0xa3, 0xba, 0x1f, 0x00, 0x00, 0x00},
+    {0x00, 0xdf, 0x37, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf6, 0xff, 0xff, 0xe8, 0x5b, 0x00},
+    {0x00, 0xfe, 0x00, 0x02, 0x4c, 0xe2, 0x00},
+    {0x00, 0xfa, 0x06, 0x00, 0x04, 0xfa, 0x00},
+    {0x00, 0xdf, 0x53, 0x04, 0x30, 0xe8, 0x00},
+    {0x00, 0x69, 0xec, 0xfc, 0xee, 0x6f, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x65, 0x9d, 0x00},
+    {0x00, 0x00, 0x00, 0x19, 0xd8, 0x0a, 0x00},
+    {0x00, 0x00, 0x00, 0x83, 0x72, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xca, 0x29, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xec, 0x0c, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x7f, 0xe9, 0xfc, 0xea, 0x82, 0x00},
+    {0x00, 0xf7, 0x21, 0x01, 0x28, 0xf7, 0x00},
+    {0x00, 0xf6, 0x0b, 0x00, 0x0f, 0xf7, 0x00},
+    {0x00, 0x97, 0xff, 0xff, 0xff, 0xa1, 0x00},
+    {0x00, 0xe0, 0x3a, 0x00, 0x36, 0xe4, 0x00},
+    {0x00, 0xfd, 0x00, 0x00, 0x00, 0xfe, 0x00},
+    {0x00, 0xf4, 0x1d, 0x01, 0x1a, 0xf7, 0x00},
+    {0x00, 0x81, 0xec, 0xfd, 0xee, 0x83, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x72, 0xef, 0xfe, 0xed, 0x6b, 0x00},
+    {0x00, 0xed, 0x36, 0x05, 0x5c, 0xe0, 0x00},
+    {0x00, 0xfc, 0x03, 0x00, 0x07, 0xf9, 0x00},
+    {0x00, 0xe1, 0x48, 0x01, 0x00, 0xfd, 0x00},
+    {0x00, 0x59, 0xe8, 0xff, 0xff, 0xf5, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x33, 0xde, 0x00},
+    {0x00, 0x00, 0x00, 0x1d, 0xbc, 0xa1, 0x00},
+    {0x00, 0xff, 0xff, 0xf2, 0xb8, 0x1a, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0xc7, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x21, 0xe4, 0x00, 0x00},
+    {0x00, 0x00, 0x16, 0xbe, 0x59, 0x00, 0x00},
+    {0x00, 0x00, 0xa1, 0x57, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x4e, 0xe6, 0x00},
+    {0x00, 0x00, 0x13, 0xa5, 0xeb, 0x56, 0x00},
+    {0x00, 0x54, 0xe9, 0xaf, 0x17, 0x00, 0x00},
+    {0x00, 0xff, 0xaa, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x54, 0xe9, 0xaf, 0x16, 0x00, 0x00},
+    {0x00, 0x00, 0x13, 0xa6, 0xeb, 0x56, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x4f, 0xe6, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe6, 0x4e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x56, 0xeb, 0xa5, 0x13, 0x00, 0x00},
+    {0x00, 0x00, 0x17, 0xb0, 0xe9, 0x54, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xaa, 0xff, 0x00},
+    {0x00, 0x00, 0x17, 0xaf, 0xe9, 0x54, 0x00},
+    {0x00, 0x56, 0xeb, 0xa6, 0x13, 0x00, 0x00},
+    {0x00, 0xe6, 0x4f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x37, 0xcd, 0xf6, 0xd0, 0x35, 0x00},
+    {0x00, 0xc0, 0x58, 0x09, 0x67, 0xcb, 0x00},
+    {0x00, 0x02, 0x00, 0x00, 0x0b, 0xf4, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x50, 0xbc, 0x00},
+    {0x00, 0x00, 0x00, 0x15, 0xda, 0x27, 0x00},
+    {0x00, 0x00, 0x00, 0xa7, 0x6a, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf3, 0x0a, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0e, 0x93, 0xe6, 0xf3, 0x97, 0x06},
+    {0x07, 0xcd, 0xa1, 0x22, 0x15, 0xc7, 0x86},
+    {0x75, 0xb3, 0x00, 0x00, 0x00, 0x30, 0xe6},
+    {0xcf, 0x3e, 0x00, 0x39, 0xc0, 0xe9, 0xff},
+    {0xf4, 0x0c, 0x00, 0xdf, 0x6b, 0x13, 0xff},
+    {0xf3, 0x0d, 0x00, 0xf7, 0x29, 0x7c, 0xff},
+    {0xce, 0x41, 0x00, 0x92, 0xf4, 0x88, 0xff},
+    {0x75, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x07, 0xcd, 0xa9, 0x25, 0x11, 0x7f, 0xbd},
+    {0x00, 0x0e, 0x92, 0xe6, 0xf6, 0xb7, 0x1c},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x30, 0xff, 0x33, 0x00, 0x00},
+    {0x00, 0x00, 0x91, 0xbf, 0x99, 0x00, 0x00},
+    {0x00, 0x05, 0xe4, 0x19, 0xe0, 0x0c, 0x00},
+    {0x00, 0x51, 0xac, 0x00, 0x99, 0x66, 0x00},
+    {0x00, 0xb1, 0xff, 0xff, 0xff, 0xcc, 0x00},
+    {0x15, 0xe5, 0x05, 0x00, 0x00, 0xde, 0x33},
+    {0x71, 0x8f, 0x00, 0x00, 0x00, 0x86, 0x99},
+    {0xd0, 0x2f, 0x00, 0x00, 0x00, 0x2d, 0xf3},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xf9, 0xd7, 0x4f, 0x00},
+    {0x00, 0xff, 0x00, 0x03, 0x47, 0xe8, 0x00},
+    {0x00, 0xff, 0x00, 0x01, 0x33, 0xf0, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0x7d, 0x00},
+    {0x00, 0xff, 0x00, 0x03, 0x4b, 0xd2, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x03, 0xf6, 0x00},
+    {0x00, 0xff, 0x00, 0x01, 0x3c, 0xda, 0x00},
+    {0x00, 0xff, 0xff, 0xfb, 0xd7, 0x47, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x66, 0xdd, 0xf5, 0xd3, 0x6d},
+    {0x00, 0x58, 0xce, 0x2c, 0x0c, 0x48, 0x51},
+    {0x00, 0xc8, 0x3e, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf4, 0x0d, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf4, 0x10, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xc7, 0x4d, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x5a, 0xde, 0x39, 0x10, 0x70, 0xa6},
+    {0x00, 0x00, 0x6b, 0xe1, 0xf7, 0xbf, 0x3a},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xf7, 0xd3, 0x6d, 0x00},
+    {0x00, 0xff, 0x00, 0x12, 0x4f, 0xe3, 0x5d},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x4e, 0xca},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x12, 0xf0},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x11, 0xf4},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x50, 0xcf},
+    {0x00, 0xff, 0x00, 0x0c, 0x4c, 0xe4, 0x6a},
+    {0x00, 0xff, 0xff, 0xf4, 0xcf, 0x66, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x4a, 0xc3, 0xed, 0xff, 0xff, 0x00},
+    {0x58, 0xde, 0x49, 0x0f, 0x00, 0x00, 0x00},
+    {0xcc, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xf7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xf3, 0x0e, 0x00, 0x08, 0xff, 0xff, 0x00},
+    {0xc0, 0x56, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x43, 0xe8, 0x4c, 0x06, 0x00, 0xff, 0x00},
+    {0x00, 0x45, 0xc3, 0xf4, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x06, 0xfc, 0x00},
+    {0x00, 0x97, 0x5a, 0x0c, 0x7a, 0xcc, 0x00},
+    {0x00, 0x4e, 0xda, 0xf5, 0xc3, 0x2d, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x0c, 0xc3, 0x7f},
+    {0x00, 0xff, 0x00, 0x0b, 0xc2, 0x7f, 0x00},
+    {0x00, 0xff, 0x0b, 0xc1, 0x7f, 0x00, 0x00},
+    {0x00, 0xff, 0xc1, 0xf8, 0x3c, 0x00, 0x00},
+    {0x00, 0xff, 0x7f, 0x63, 0xd3, 0x04, 0x00},
+    {0x00, 0xff, 0x00, 0x01, 0xc2, 0x76, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x29, 0xee, 0x1e},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x84, 0xb1},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xc4, 0x00, 0x00, 0x00, 0xcf, 0xff},
+    {0xff, 0xcc, 0x2d, 0x00, 0x36, 0xcc, 0xff},
+    {0xff, 0x67, 0x97, 0x00, 0x9d, 0x66, 0xff},
+    {0xff, 0x0d, 0xe6, 0x1c, 0xe8, 0x0c, 0xff},
+    {0xff, 0x00, 0x9a, 0xcc, 0x99, 0x00, 0xff},
+    {0xff, 0x00, 0x33, 0xff, 0x33, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x38, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0xad, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0xa5, 0x2d, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x35, 0xa5, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0xc1, 0x23, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x53, 0x9a, 0xfc, 0x00},
+    {0x00, 0xff, 0x00, 0x03, 0xd8, 0xfb, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x71, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3d, 0xc6, 0xf6, 0xd4, 0x4f, 0x00},
+    {0x33, 0xe6, 0x51, 0x09, 0x40, 0xe3, 0x42},
+    {0xb6, 0x58, 0x00, 0x00, 0x00, 0x50, 0xbe},
+    {0xf1, 0x0e, 0x00, 0x00, 0x00, 0x0c, 0xf2},
+    {0xf1, 0x0e, 0x00, 0x00, 0x00, 0x0b, 0xf1},
+    {0xb6, 0x56, 0x00, 0x00, 0x00, 0x4a, 0xbd},
+    {0x34, 0xe5, 0x4d, 0x08, 0x39, 0xdc, 0x3f},
+    {0x00, 0x3a, 0xc4, 0xf6, 0xd1, 0x4a, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xfe, 0xf2, 0xc1, 0x36},
+    {0x00, 0xff, 0x00, 0x00, 0x0d, 0x79, 0xda},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x08, 0xf9},
+    {0x00, 0xff, 0x00, 0x00, 0x0c, 0x66, 0xcb},
+    {0x00, 0xff, 0xff, 0xfe, 0xef, 0xb5, 0x27},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x54, 0xd0, 0xf7, 0xd4, 0x52, 0x00},
+    {0x4c, 0xe6, 0x4c, 0x0c, 0x36, 0xd7, 0x45},
+    {0xc4, 0x52, 0x00, 0x00, 0x00, 0x45, 0xc0},
+    {0xf3, 0x12, 0x00, 0x00, 0x00, 0x10, 0xf3},
+    {0xf3, 0x0e, 0x00, 0x00, 0x00, 0x0f, 0xf3},
+    {0xbe, 0x5b, 0x00, 0x00, 0x00, 0x43, 0xc1},
+    {0x43, 0xec, 0x55, 0x11, 0x3c, 0xd6, 0x4b},
+    {0x00, 0x53, 0xdd, 0xff, 0xed, 0x60, 0x00},
+    {0x00, 0x00, 0x00, 0xbb, 0x62, 0x01, 0x08},
+    {0x00, 0x00, 0x00, 0x17, 0xb3, 0xdd, 0x5d},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xf3, 0xb8, 0x20},
+    {0x00, 0xff, 0x00, 0x02, 0x14, 0x7f, 0xb7},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x09, 0xf2},
+    {0x00, 0xff, 0x00, 0x00, 0x0f, 0x67, 0xdb},
+    {0x00, 0xff, 0xff, 0xff, 0xf8, 0xc7, 0x3b},
+    {0x00, 0xff, 0x00, 0x3c, 0xde, 0x09, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0xa0, 0x84, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x16, 0xe8, 0x25},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x36, 0xc1, 0xf2, 0xd3, 0x44, 0x00},
+    {0x00, 0xe4, 0x53, 0x09, 0x48, 0xcc, 0x0a},
+    {0x00, 0xd6, 0x5d, 0x00, 0x00, 0x02, 0x00},
+    {0x00, 0x20, 0xc6, 0xc9, 0x3e, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x4e, 0xdd, 0x6c, 0x00},
+    {0x00, 0x02, 0x00, 0x00, 0x26, 0xea, 0x00},
+    {0x08, 0xcf, 0x59, 0x08, 0x49, 0xe6, 0x00},
+    {0x00, 0x30, 0xc2, 0xf7, 0xdd, 0x3d, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xf7, 0x08, 0x00, 0x0f, 0xf6, 0x00},
+    {0x00, 0xcb, 0x6a, 0x05, 0x69, 0xc8, 0x00},
+    {0x00, 0x3a, 0xd9, 0xfb, 0xd8, 0x37, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xe3, 0x19, 0x00, 0x1c, 0xe2, 0x00},
+    {0x00, 0xaa, 0x4d, 0x00, 0x56, 0xa9, 0x00},
+    {0x00, 0x71, 0x82, 0x00, 0x90, 0x6f, 0x00},
+    {0x00, 0x37, 0xb9, 0x00, 0xc8, 0x36, 0x00},
+    {0x00, 0x06, 0xe5, 0x06, 0xef, 0x05, 0x00},
+    {0x00, 0x00, 0xc4, 0x5a, 0xc3, 0x00, 0x00},
+    {0x00, 0x00, 0x8b, 0xc8, 0x89, 0x00, 0x00},
+    {0x00, 0x00, 0x51, 0xff, 0x50, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x2f, 0xff, 0x2e, 0x00, 0xff},
+    {0xff, 0x00, 0x8c, 0xff, 0x8a, 0x00, 0xff},
+    {0xff, 0x01, 0xe1, 0x9b, 0xe3, 0x01, 0xff},
+    {0xff, 0x39, 0xee, 0x09, 0xe6, 0x3a, 0xff},
+    {0xc0, 0xff, 0x97, 0x00, 0x91, 0xff, 0xc5},
+    {0x40, 0xff, 0x37, 0x00, 0x32, 0xff, 0x51},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xa4, 0x00, 0x00, 0x00, 0xa4, 0xff},
+    {0x0f, 0xdf, 0x55, 0x00, 0x53, 0xde, 0x0f},
+    {0x00, 0x37, 0xe7, 0x30, 0xe6, 0x37, 0x00},
+    {0x00, 0x00, 0x76, 0xf8, 0x75, 0x00, 0x00},
+    {0x00, 0x00, 0x77, 0xf8, 0x75, 0x00, 0x00},
+    {0x00, 0x37, 0xe5, 0x2e, 0xe5, 0x36, 0x00},
+    {0x0f, 0xde, 0x50, 0x00, 0x4f, 0xdd, 0x0f},
+    {0xff, 0xa2, 0x00, 0x00, 0x00, 0xa0, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x18, 0xf8, 0x2f, 0x00, 0x30, 0xf8, 0x18},
+    {0x00, 0x9c, 0x8d, 0x00, 0x91, 0x9b, 0x00},
+    {0x00, 0x27, 0xe8, 0x0b, 0xea, 0x27, 0x00},
+    {0x00, 0x00, 0xb1, 0xa3, 0xb0, 0x00, 0x00},
+    {0x00, 0x00, 0x3b, 0xff, 0x3a, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x55, 0xaa, 0x00},
+    {0x00, 0x00, 0x00, 0x15, 0xd5, 0x15, 0x00},
+    {0x00, 0x00, 0x00, 0xab, 0x55, 0x00, 0x00},
+    {0x00, 0x00, 0x55, 0xaa, 0x00, 0x00, 0x00},
+    {0x00, 0x15, 0xd5, 0x15, 0x00, 0x00, 0x00},
+    {0x00, 0xab, 0x55, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x59, 0x12, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x5f, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x40, 0x2a, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x01, 0x69, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x67, 0x03, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x21, 0x47, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x58, 0x10, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x0c, 0x5c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0x69, 0x37, 0x00, 0x00},
+    {0x00, 0x00, 0x51, 0x05, 0x57, 0x00, 0x00},
+    {0x00, 0x00, 0x59, 0x00, 0x4b, 0x11, 0x00},
+    {0x00, 0x34, 0x29, 0x00, 0x06, 0x5b, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x80, 0xff, 0x40, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x77, 0xd9, 0xf5, 0xe3, 0x4d, 0x00},
+    {0x00, 0x49, 0x2b, 0x03, 0x2b, 0xde, 0x00},
+    {0x00, 0x4a, 0xc7, 0xed, 0xe6, 0xfe, 0x00},
+    {0x00, 0xe4, 0x37, 0x01, 0x00, 0xff, 0x00},
+    {0x00, 0xfb, 0x1c, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x9c, 0xf7, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x6a, 0xde, 0xf0, 0xb2, 0x19},
+    {0x00, 0xff, 0xd0, 0x27, 0x0c, 0x89, 0xab},
+    {0x00, 0xff, 0x19, 0x00, 0x00, 0x0b, 0xee},
+    {0x00, 0xff, 0x0e, 0x00, 0x00, 0x1a, 0xed},
+    {0x00, 0xff, 0xd8, 0x34, 0x23, 0xbb, 0x8d},
+    {0x00, 0xff, 0x64, 0xe8, 0xe9, 0x89, 0x05},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x0c, 0x9a, 0xed, 0xf1, 0x9c, 0x14},
+    {0x00, 0x9b, 0xc3, 0x2b, 0x13, 0x7d, 0x29},
+    {0x00, 0xee, 0x1c, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xf2, 0x13, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xa1, 0xa8, 0x1e, 0x0a, 0x52, 0x1c},
+    {0x00, 0x0c, 0x95, 0xeb, 0xf3, 0xbf, 0x2a},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x32, 0xce, 0xfa, 0xff, 0xff, 0x00},
+    {0x00, 0xc4, 0x77, 0x04, 0x00, 0xff, 0x00},
+    {0x00, 0xf5, 0x11, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xfa, 0x08, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xd5, 0x62, 0x03, 0x00, 0xff, 0x00},
+    {0x00, 0x48, 0xdd, 0xfd, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x15, 0xb5, 0xf8, 0xdc, 0x4d, 0x00},
+    {0x00, 0xbd, 0x62, 0x05, 0x47, 0xe7, 0x00},
+    {0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0xef, 0x1a, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xa0, 0x9a, 0x08, 0x3e, 0xe7, 0x00},
+    {0x00, 0x11, 0xb1, 0xf7, 0xd6, 0x45, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x4b, 0xde, 0xfe, 0xff},
+    {0x00, 0x00, 0x00, 0xd9, 0x5b, 0x02, 0x00},
+    {0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x54, 0xdb, 0xfb, 0xff, 0xff, 0xff},
+    {0x00, 0xe7, 0x47, 0x06, 0x3c, 0xff, 0x00},
+    {0x00, 0xed, 0x2e, 0x00, 0x24, 0xf9, 0x00},
+    {0x00, 0x98, 0xf7, 0xff, 0xf2, 0x96, 0x00},
+    {0x00, 0xec, 0x21, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xab, 0xff, 0xff, 0xff, 0xe1, 0x45},
+    {0x00, 0xed, 0x1a, 0x00, 0x00, 0x27, 0xe9},
+    {0x00, 0xec, 0x32, 0x02, 0x0d, 0x5f, 0xd5},
+    {0x00, 0x59, 0xdb, 0xf9, 0xec, 0xb3, 0x29}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xc9, 0xfa, 0xec, 0x61, 0x00},
+    {0x00, 0xff, 0x5f, 0x04, 0x41, 0xe4, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x04, 0xfe, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xab, 0x05, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xab, 0x05, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x07, 0xfa, 0x00, 0x00},
+    {0x00, 0x34, 0x09, 0x84, 0xc8, 0x00, 0x00},
+    {0x0a, 0xb3, 0xf3, 0xc7, 0x2c, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x77, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x68, 0xec, 0x2e, 0x00},
+    {0x00, 0xff, 0x59, 0xfd, 0x7d, 0x00, 0x00},
+    {0x00, 0xff, 0xed, 0x6d, 0xef, 0x36, 0x00},
+    {0x00, 0xff, 0x3d, 0x00, 0x54, 0xe2, 0x18},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x71, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xf7, 0x37, 0x14, 0x12},
+    {0x00, 0x00, 0x00, 0x7e, 0xf1, 0xef, 0x58},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xb8, 0xf0, 0x6e, 0xb0, 0xeb, 0x62},
+    {0xff, 0x6b, 0x29, 0xff, 0x64, 0x2a, 0xf1},
+    {0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff},
+    {0xff, 0x00, 0x00, 0xff, 0x00, 0x00, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x7e, 0xf7, 0xe2, 0x51, 0x00},
+    {0x00, 0xff, 0xa2, 0x0d, 0x4c, 0xe2, 0x00},
+    {0x00, 0xff, 0x08, 0x00, 0x01, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x23, 0xc1, 0xf3, 0xc8, 0x25, 0x00},
+    {0x00, 0xb4, 0x7c, 0x0c, 0x7c, 0xb6, 0x00},
+    {0x00, 0xee, 0x10, 0x00, 0x10, 0xee, 0x00},
+    {0x00, 0xf0, 0x14, 0x00, 0x13, 0xf5, 0x00},
+    {0x00, 0xb1, 0x8d, 0x0a, 0x8e, 0xb8, 0x00},
+    {0x00, 0x1c, 0xb9, 0xf5, 0xca, 0x23, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xfd, 0xdc, 0x45, 0x00},
+    {0x00, 0xff, 0x00, 0x03, 0x5e, 0xd0, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x08, 0xf8, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x17, 0xf6, 0x00},
+    {0x00, 0xff, 0x00, 0x05, 0x84, 0xc3, 0x00},
+    {0x00, 0xff, 0xff, 0xf8, 0xc8, 0x2d, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x44, 0xdd, 0xfd, 0xff, 0xff, 0x00},
+    {0x00, 0xd0, 0x5b, 0x02, 0x00, 0xff, 0x00},
+    {0x00, 0xf8, 0x07, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xf6, 0x13, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xc2, 0x80, 0x05, 0x00, 0xff, 0x00},
+    {0x00, 0x2b, 0xc2, 0xf6, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x75, 0xee, 0xf2, 0x82},
+    {0x00, 0x00, 0xff, 0xc4, 0x1f, 0x16, 0x1d},
+    {0x00, 0x00, 0xff, 0x10, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x53, 0xd1, 0xf6, 0xdb, 0x57, 0x00},
+    {0x00, 0xf1, 0x3c, 0x0b, 0x3e, 0x72, 0x00},
+    {0x00, 0x90, 0xbf, 0x7d, 0x3c, 0x00, 0x00},
+    {0x00, 0x00, 0x21, 0x63, 0xbf, 0xa6, 0x00},
+    {0x00, 0x78, 0x40, 0x07, 0x28, 0xf2, 0x00},
+    {0x00, 0x44, 0xbf, 0xf6, 0xed, 0x77, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xe6, 0x4a, 0x06, 0x27, 0x04},
+    {0x00, 0x00, 0x4c, 0xd8, 0xf9, 0xdd, 0x2e},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x01, 0x00, 0x08, 0xff, 0x00},
+    {0x00, 0xe3, 0x49, 0x0c, 0xa3, 0xff, 0x00},
+    {0x00, 0x54, 0xe3, 0xf4, 0x7d, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x1d, 0xfd, 0x28, 0x00, 0x2e, 0xfd, 0x1d},
+    {0x00, 0xba, 0x79, 0x00, 0x8a, 0xb8, 0x00},
+    {0x00, 0x58, 0xcc, 0x00, 0xde, 0x56, 0x00},
+    {0x00, 0x07, 0xed, 0x4f, 0xed, 0x07, 0x00},
+    {0x00, 0x00, 0x94, 0xe2, 0x92, 0x00, 0x00},
+    {0x00, 0x00, 0x31, 0xff, 0x30, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0x05, 0x23, 0xff, 0x1f, 0x09, 0xff},
+    {0xff, 0x10, 0x64, 0xff, 0x64, 0x1e, 0xff},
+    {0xff, 0x21, 0xa1, 0xbe, 0xa0, 0x32, 0xff},
+    {0xff, 0x3a, 0xde, 0x44, 0xd6, 0x48, 0xff},
+    {0xff, 0x6d, 0xf5, 0x05, 0xc8, 0x74, 0xff},
+    {0x84, 0xff, 0xb6, 0x00, 0x89, 0xff, 0x7f},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0xdf, 0x51, 0x00, 0x4b, 0xde, 0x0f},
+    {0x00, 0x37, 0xe0, 0x18, 0xd8, 0x37, 0x00},
+    {0x00, 0x00, 0x76, 0xe6, 0x75, 0x00, 0x00},
+    {0x00, 0x00, 0x77, 0xe7, 0x70, 0x00, 0x00},
+    {0x00, 0x37, 0xdc, 0x1a, 0xde, 0x2b, 0x00},
+    {0x0f, 0xde, 0x4d, 0x00, 0x52, 0xcf, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0x57, 0x00, 0x00, 0x00, 0x6a, 0xff},
+    {0x57, 0xd6, 0x02, 0x00, 0x00, 0xd4, 0x76},
+    {0x01, 0xcb, 0x59, 0x00, 0x41, 0xee, 0x0d},
+    {0x00, 0x42, 0xd7, 0x02, 0xb0, 0x80, 0x00},
+    {0x00, 0x00, 0xb8, 0x83, 0xf1, 0x12, 0x00},
+    {0x00, 0x00, 0x2f, 0xfd, 0x8a, 0x00, 0x00},
+    {0x00, 0x00, 0x15, 0xf4, 0x18, 0x00, 0x00},
+    {0x37, 0x1e, 0xa1, 0x87, 0x00, 0x00, 0x00},
+    {0x8b, 0xf4, 0xa1, 0x05, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x0c, 0xcb, 0x7f, 0x00},
+    {0x00, 0x00, 0x05, 0xb9, 0x93, 0x00, 0x00},
+    {0x00, 0x01, 0xa4, 0xb0, 0x02, 0x00, 0x00},
+    {0x00, 0x8d, 0xc9, 0x0a, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x96, 0xf4, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xfb, 0x24, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x03, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xd0, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x0e, 0xfd, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xfa, 0x0b, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x96, 0xf3, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xfe, 0xf4, 0x99, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x0b, 0xfb, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xfc, 0x0d, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xcf, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x02, 0xff, 0x07, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x28, 0xfb, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xf4, 0x93, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x4d, 0xef, 0x9d, 0x16, 0x69, 0x02},
+    {0x00, 0x50, 0x0f, 0x7d, 0xee, 0x84, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xb4, 0xfb, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0xfa, 0x01, 0xfc, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x04, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x1d, 0xfa, 0x00, 0x00, 0x00},
+    {0x00, 0xfc, 0xfc, 0xc2, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x0f, 0xdf, 0x51, 0x00, 0x4b, 0xde, 0x0f},
+    {0x00, 0x37, 0xe0, 0x18, 0xd8, 0x37, 0x00},
+    {0x00, 0x00, 0x76, 0xe6, 0x75, 0x00, 0x00},
+    {0x00, 0x00, 0x77, 0xe7, 0x70, 0x00, 0x00},
+    {0x00, 0x37, 0xdc, 0x1a, 0xde, 0x2b, 0x00},
+    {0x0f, 0xde, 0x4d, 0x00, 0x52, 0xcf, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0x57, 0x00, 0x00, 0x00, 0x6a, 0xff},
+    {0x57, 0xd6, 0x02, 0x00, 0x00, 0xd4, 0x76},
+    {0x01, 0xcb, 0x59, 0x00, 0x41, 0xee, 0x0d},
+    {0x00, 0x42, 0xd7, 0x02, 0xb0, 0x80, 0x00},
+    {0x00, 0x00, 0xb8, 0x83, 0xf1, 0x12, 0x00},
+    {0x00, 0x00, 0x2f, 0xfd, 0x8a, 0x00, 0x00},
+    {0x00, 0x00, 0x15, 0xf4, 0x18, 0x00, 0x00},
+    {0x37, 0x1e, 0xa1, 0x87, 0x00, 0x00, 0x00},
+    {0x8b, 0xf4, 0xa1, 0x05, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x04, 0x04, 0x04, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xfc, 0xfc, 0xfc, 0xf5, 0x00},
+    {0x00, 0xa5, 0x95, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x10, 0xe2, 0x53, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x42, 0xee, 0x20, 0x00, 0x00},
+    {0x00, 0x00, 0x42, 0xe9, 0x16, 0x00, 0x00},
+    {0x00, 0x10, 0xe3, 0x52, 0x00, 0x00, 0x00},
+    {0x00, 0xa7, 0xa3, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x13, 0xbe, 0xf7, 0xaf, 0x08, 0x00},
+    {0x00, 0x98, 0x9b, 0x2a, 0xbd, 0x77, 0x00},
+    {0x00, 0xea, 0x1b, 0x00, 0x4e, 0xc4, 0x00},
+    {0x11, 0xf9, 0x00, 0x00, 0x2e, 0xe6, 0x00},
+    {0x1d, 0xfe, 0xec, 0xec, 0xee, 0xf1, 0x00},
+    {0x17, 0xf6, 0x1c, 0x1c, 0x3c, 0xe8, 0x00},
+    {0x02, 0xf6, 0x13, 0x00, 0x40, 0xca, 0x00},
+    {0x00, 0xaf, 0x98, 0x31, 0xb1, 0x85, 0x00},
+    {0x00, 0x1f, 0xc9, 0xf7, 0xb7, 0x0e, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x8a, 0xf4, 0x9a, 0x00, 0x00, 0x00, 0x00},
+    {0x1e, 0x25, 0xc7, 0x56, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x3e, 0xd7, 0x02, 0x00, 0x00},
+    {0x00, 0x00, 0x2f, 0xff, 0x56, 0x00, 0x00},
+    {0x00, 0x00, 0x92, 0xa1, 0xd0, 0x01, 0x00},
+    {0x00, 0x07, 0xec, 0x1f, 0xc0, 0x4e, 0x00},
+    {0x00, 0x57, 0xcc, 0x00, 0x4f, 0xc9, 0x00},
+    {0x00, 0xb9, 0x7a, 0x00, 0x02, 0xdb, 0x46},
+    {0x1d, 0xfd, 0x28, 0x00, 0x00, 0x6d, 0xc2},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xff, 0x00},
+    {0x00, 0xff, 0x25, 0x04, 0x04, 0xff, 0x04},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x04, 0xff, 0x04, 0x04, 0x04, 0xf8, 0x04},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xf8, 0x00},
+    {0x00, 0xff, 0x00, 0x00, 0x00, 0xcc, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x34, 0xd3, 0xfc, 0xff, 0xff, 0xff},
+    {0x00, 0xc5, 0x64, 0x0a, 0x62, 0xc4, 0x04},
+    {0x00, 0xf5, 0x08, 0x00, 0x06, 0xf4, 0x00},
+    {0x00, 0xf6, 0x03, 0x00, 0x04, 0xf5, 0x00},
+    {0x00, 0xcb, 0x47, 0x03, 0x50, 0xc9, 0x00},
+    {0x00, 0x36, 0xcf, 0xf7, 0xcf, 0x34, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x14, 0xd2, 0xff, 0x00, 0x00, 0x00},
+    {0x13, 0xd1, 0x7f, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0xff, 0x88, 0xe1, 0x28},
+    {0x00, 0x00, 0x00, 0xff, 0xd5, 0x1c, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xff, 0xff, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x5a, 0xee, 0x1b, 0x00},
+    {0x00, 0x00, 0x1d, 0xf0, 0x58, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x73, 0xc8, 0xcc, 0x8c, 0x15, 0x00},
+    {0x80, 0xa8, 0x13, 0x17, 0x7a, 0xd6, 0x04},
+    {0xef, 0x2b, 0x3e, 0x8b, 0xcb, 0x9f, 0x0e},
+    {0xe1, 0xe4, 0xa0, 0x4f, 0x07, 0x0d, 0x0b},
+    {0x5e, 0xe3, 0x31, 0x14, 0x6f, 0xee, 0x32},
+    {0x00, 0x56, 0xd6, 0xfc, 0xca, 0x3d, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x18, 0xf5, 0x80, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x71, 0xff, 0x80, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7b, 0xff, 0x80},
+    {0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff},
+    {0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f},
+    {0x00, 0x00, 0x00, 0x7f, 0xff, 0x7f, 0x00},
+    {0x00, 0x00, 0x2b, 0xfe, 0x7f, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x39, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf0},
+    {0x00, 0x00, 0x00, 0x00, 0x1d, 0xd7, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x4c, 0xa0, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x7d, 0x68, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0xac, 0x30, 0x00},
+    {0x19, 0x4f, 0x00, 0x00, 0xd1, 0x03, 0x00},
+    {0xa5, 0xf7, 0x0b, 0x0d, 0xbf, 0x00, 0x00},
+    {0x00, 0xc2, 0x50, 0x3d, 0x89, 0x00, 0x00},
+    {0x00, 0x6c, 0xa2, 0x72, 0x51, 0x00, 0x00},
+    {0x00, 0x19, 0xee, 0xba, 0x19, 0x00, 0x00},
+    {0x00, 0x00, 0xc2, 0xe2, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x2d, 0x3e, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x05, 0x6a, 0x00},
+    {0x00, 0x00, 0x01, 0x57, 0xdc, 0xd9, 0x00},
+    {0x00, 0x44, 0xcc, 0xd7, 0x5b, 0x03, 0x00},
+    {0x00, 0xff, 0xae, 0x05, 0x00, 0x00, 0x00},
+    {0x00, 0x45, 0xce, 0xd6, 0x58, 0x02, 0x00},
+    {0x00, 0x00, 0x01, 0x5a, 0xde, 0xd5, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x06, 0x6f, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  },
+  {
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x6b, 0x05, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xd8, 0xdb, 0x57, 0x01, 0x00, 0x00},
+    {0x00, 0x03, 0x5b, 0xd8, 0xcc, 0x44, 0x00},
+    {0x00, 0x00, 0x00, 0x05, 0xae, 0xff, 0x00},
+    {0x00, 0x02, 0x58, 0xd6, 0xce, 0x45, 0x00},
+    {0x00, 0xd5, 0xde, 0x5a, 0x01, 0x00, 0x00},
+    {0x00, 0x6f, 0x06, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+  }
+};
@@ -0,0 +1,9 @@
+/* Auto-generated by rasterizer */
+
+#define BITMAP_SmallFont_FIRST_CHARACTER 0x20
+#define BITMAP_SmallFont_LAST_CHARACTER 0x92
+
+#define BITMAP_SmallFont_CHARACTER_WIDTH 7
+#define BITMAP_SmallFont_CHARACTER_HEIGHT 13
+
+extern unsigned char bitmapSmallFont[115][13][7];
@@ -0,0 +1,28 @@
+#ifndef LIBA_BRIDGE_MATH_H
+#define LIBA_BRIDGE_MATH_H
+
+#include_next <math.h>
+#include <stddef.h>
+
+#include "../private/macros.h"
+
+LIBA_BEGIN_DECLS
+
+/* liba's array functions, see liba/include/math.h. They are built on hosts
+ * too, on top of the host's scalar functions. */
+
+void vcosf(float * y, const float * x, size_t n);
+void vexpf(float * y, const float * x, size_t n);
+void vlogf(float * y, const float * x, size_t n);
+void vpowf(float * z, const float * x, const float * y, size_t n);
+void vsinf(float * y, const float * x, size_t n);
+
+void vcos(double * y, const double * x, size_t n);
+void vexp(double * y, const double * x, size_t n);
+void vlog(double * y, const double * x, size_t n);
+void vpow(double * z, const double * x, const double * y, size_t n);
+void vsin(double * y, const double * x, size_t n);
+
+LIBA_END_DECLS
+
+#endif
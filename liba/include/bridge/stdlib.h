@@ -0,0 +1,38 @@
+#ifndef LIBA_BRIDGE_STDLIB_H
+#define LIBA_BRIDGE_STDLIB_H
+
+#include_next <stdlib.h>
+
+#include "../private/macros.h"
+
+LIBA_BEGIN_DECLS
+
+/* The host allocator doesn't run out of memory in practice, so this reports
+ * SIZE_MAX and lets callers apply their own upper bound. */
+size_t malloc_max_available(void);
+size_t malloc_max_available_after(size_t size);
+
+/* The host allocator has no size classes: malloc_number_of_classes is 0. */
+typedef struct {
+  size_t block_size;
+  size_t number_of_pages;
+  size_t used_blocks;
+  size_t capacity;
+} malloc_class_stats_t;
+
+int malloc_number_of_classes(void);
+void malloc_class_stats(int class_index, malloc_class_stats_t * stats);
+
+/* Non-standard: number of blocks the allocator has returned since startup. It
+ * is only counted on glibc hosts, by test runners built with
+ * QUIZ_RUN_BENCHMARKS or with LIBA_HEAP_TRACE, and is 0 elsewhere. */
+size_t malloc_number_of_allocations(void);
+
+/* Non-standard: with LIBA_HEAP_TRACE, attributes the next allocation to site
+ * rather than to the caller of malloc. Allocation wrappers like operator new
+ * call it with their own return address. */
+void malloc_set_trace_site(void * site);
+
+LIBA_END_DECLS
+
+#endif
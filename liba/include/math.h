@@ -3,6 +3,7 @@
 
 #include "private/macros.h"
 #include <float.h>
+#include <stddef.h>
 
 LIBA_BEGIN_DECLS
 
@@ -32,6 +33,7 @@ int isnand(double x);
 int __fpclassifyf(float x);
 int __fpclassify(double x);
 #define fpclassify(x) ((sizeof (x) == sizeof (float)) ? __fpclassifyf(x) :  __fpclassify(x))
+#define isfinite(x) (fpclassify(x) & (FP_NORMAL | FP_SUBNORMAL | FP_ZERO))
 
 float acosf(float x);
 float acoshf(float x);
@@ -49,11 +51,14 @@ float expm1f(float x);
 float fabsf(float x);
 float floorf(float x);
 float fmodf(float x, float y);
+float frexpf(float x, int *eptr);
+float ldexpf(float x, int n);
 float lgammaf(float x);
 float lgammaf_r(float x, int *signgamp);
 float log1pf(float x);
 float log10f(float x);
 float logf(float x);
+float modff(float x, float *iptr);
 float nanf(const char *s);
 float nearbyintf(float x);
 float powf(float x, float y);
@@ -64,6 +69,7 @@ float sinhf(float x);
 float sqrtf(float x);
 float tanf(float x);
 float tanhf(float x);
+float truncf(float x);
 
 double acos(double x);
 double acosh(double x);
@@ -79,6 +85,7 @@ double exp(double x);
 double expm1(double x);
 double fabs(double x);
 double floor(double x);
+double ldexp(double x, int n);
 double lgamma(double x);
 double lgamma_r(double x, int *signgamp);
 double log1p(double x);
@@ -93,6 +100,22 @@ double sqrt(double x);
 double tan(double x);
 double tanh(double x);
 
+/* Non-standard: array versions of some functions, y[i] = f(x[i]) for i < n,
+ * for batch evaluation. y may be x. They are within a few ulps of the scalar
+ * versions and handle the same special cases. */
+
+void vcosf(float * y, const float * x, size_t n);
+void vexpf(float * y, const float * x, size_t n);
+void vlogf(float * y, const float * x, size_t n);
+void vpowf(float * z, const float * x, const float * y, size_t n);
+void vsinf(float * y, const float * x, size_t n);
+
+void vcos(double * y, const double * x, size_t n);
+void vexp(double * y, const double * x, size_t n);
+void vlog(double * y, const double * x, size_t n);
+void vpow(double * z, const double * x, const double * y, size_t n);
+void vsin(double * y, const double * x, size_t n);
+
 LIBA_END_DECLS
 
 #endif
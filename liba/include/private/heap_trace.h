@@ -0,0 +1,67 @@
+#ifndef LIBA_HEAP_TRACE_H
+#define LIBA_HEAP_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Binary trace of heap operations, enabled with LIBA_HEAP_TRACE=1.
+ * Each malloc, free and realloc appends a fixed-size record to a ring buffer.
+ * On the device, the ring keeps the last HEAP_TRACE_CAPACITY records and can
+ * be dumped from gdb with "dump binary value heap_trace.bin heap_trace". On
+ * hosts, a sink drains the ring to a file whenever it fills up.
+ * Both produce the same layout, a header followed by records, which the
+ * liba/src/tools/heap_trace_analyzer host tool reads. Fields are native
+ * endian, and pointers have the header's pointer_size. */
+
+#define HEAP_TRACE_MAGIC 0x50414548 /* "HEAP" */
+#define HEAP_TRACE_VERSION 1
+#define HEAP_TRACE_CAPACITY 256
+
+#define HEAP_TRACE_OP_MALLOC 1
+#define HEAP_TRACE_OP_FREE 2
+
+#define HEAP_TRACE_OP_SHIFT 28
+#define HEAP_TRACE_SIZE_MASK ((1u << HEAP_TRACE_OP_SHIFT) - 1)
+
+typedef struct {
+  uint32_t magic;
+  uint16_t version;
+  uint8_t pointer_size;
+  uint8_t reserved;
+  uint32_t number_of_records; /* Recorded since the start, even if dropped */
+  uint32_t capacity; /* 0 when records are streamed rather than kept in a ring */
+  uintptr_t heap_start; /* 0 if the heap isn't a known range */
+  uintptr_t heap_size;
+  /* Runtime address of heap_trace_record, to relocate call sites */
+  uintptr_t reference;
+} heap_trace_header_t;
+
+/* A realloc is recorded as the free of the old block followed by the malloc
+ * of the new one. Timestamps are in microseconds since the first record, or 0
+ * where the platform has no clock. */
+typedef struct {
+  uint32_t timestamp;
+  uint32_t op_and_size; /* op << HEAP_TRACE_OP_SHIFT | size */
+  uintptr_t address;
+  uintptr_t site; /* Return address of the allocation's caller */
+} heap_trace_record_t;
+
+typedef struct {
+  heap_trace_header_t header;
+  heap_trace_record_t records[HEAP_TRACE_CAPACITY];
+} heap_trace_t;
+
+extern heap_trace_t heap_trace;
+
+/* The sink receives the header and the records accumulated since the last
+ * call. Without a sink, old records are overwritten. */
+typedef void (*heap_trace_sink_t)(const heap_trace_header_t * header, const heap_trace_record_t * records, size_t number_of_records);
+
+void heap_trace_init(void * heap_start, size_t heap_size, uint32_t (*clock)(void), heap_trace_sink_t sink);
+void heap_trace_record(int op, const void * address, size_t size, const void * site);
+void heap_trace_flush(void);
+/* Returns the site set by malloc_set_trace_site if any, return_address
+ * otherwise, and clears the former. */
+const void * heap_trace_site(const void * return_address);
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef LIBA_SLAB_H
+#define LIBA_SLAB_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/* The slab allocator serves small blocks from a few size classes, in front of
+ * a page allocator (memsys5 in malloc). Each class carves its blocks out of
+ * SLAB_PAGE_SIZE pages, and each page keeps a free list of its blocks, so
+ * allocating and freeing are O(1) and a block wastes at most 8 bytes, where
+ * memsys5 rounds every request up to a power of two.
+ * Pages must be SLAB_PAGE_SIZE-aligned relative to the base of the managed
+ * area, as memsys5 blocks are. The page_classes table, with one byte per page
+ * of that area, tells which pages are slabs and of which class. A page is
+ * given back to the page allocator when its last block is freed, unless it is
+ * the last page of its class. slab_release_empty_pages gives those back too. */
+
+#define SLAB_PAGE_SIZE 1024
+#define SLAB_NUMBER_OF_CLASSES 7
+#define SLAB_MAX_BLOCK_SIZE 64
+
+typedef struct slab_page slab_page_t;
+
+typedef struct {
+  uint16_t block_size;
+  slab_page_t * partial_pages; /* Pages with at least one free block */
+  size_t number_of_pages;
+  size_t used_blocks;
+} slab_class_t;
+
+typedef struct {
+  char * base;
+  uint8_t * page_classes;
+  size_t number_of_pages;
+  void * (*allocate_page)(void);
+  void (*free_page)(void * page);
+  slab_class_t classes[SLAB_NUMBER_OF_CLASSES];
+} slab_allocator_t;
+
+typedef struct {
+  size_t block_size;
+  size_t number_of_pages;
+  size_t used_blocks;
+  size_t capacity;
+} slab_class_stats_t;
+
+/* page_classes must hold slab_page_table_size(size) bytes */
+size_t slab_page_table_size(size_t size);
+void slab_init(slab_allocator_t * allocator, char * base, size_t size, uint8_t * page_classes, void * (*allocate_page)(void), void (*free_page)(void * page));
+
+/* Returns NULL if size is 0 or above SLAB_MAX_BLOCK_SIZE, or if no page can be
+ * allocated. */
+void * slab_malloc(slab_allocator_t * allocator, size_t size);
+bool slab_owns(const slab_allocator_t * allocator, const void * block);
+void slab_free(slab_allocator_t * allocator, void * block);
+size_t slab_block_size(const slab_allocator_t * allocator, const void * block);
+void slab_release_empty_pages(slab_allocator_t * allocator);
+void slab_class_stats(const slab_allocator_t * allocator, int class_index, slab_class_stats_t * stats);
+
+#endif
@@ -0,0 +1,23 @@
+#ifndef LIBA_VMATH_H
+#define LIBA_VMATH_H
+
+/* Vector types for the array math functions. On hosts, the compiler maps them
+ * to SIMD registers. The Cortex-M4 has no SIMD floating-point unit, so the
+ * compiler expands each operation lane by lane instead, which unrolls the
+ * loops over the arrays. Both element types fill 16 bytes, the size of an SSE
+ * or NEON register. */
+
+#define VMATH_FLOAT_LANES 4
+#define VMATH_DOUBLE_LANES 2
+
+typedef float vmath_float_t __attribute__((vector_size(VMATH_FLOAT_LANES*sizeof(float))));
+typedef double vmath_double_t __attribute__((vector_size(VMATH_DOUBLE_LANES*sizeof(double))));
+
+/* Comparisons yield masks of signed integers of the size of the elements.
+ * Their exact type differs between targets, so it is taken from them. */
+typedef __typeof__((vmath_float_t){0} < (vmath_float_t){0}) vmath_int_t;
+typedef __typeof__((vmath_double_t){0} < (vmath_double_t){0}) vmath_long_t;
+
+#define VMATH_ALWAYS_INLINE static inline __attribute__((always_inline))
+
+#endif
@@ -10,6 +10,35 @@ void free(void *ptr);
 void * malloc(size_t size);
 void * realloc(void *ptr, size_t size);
 
+/* Non-standard: size of the largest block malloc can currently return. */
+size_t malloc_max_available(void);
+
+/* Non-standard: size of the largest block malloc could still return once size
+ * bytes have been allocated, or 0. malloc rounds size up to a power of two, so
+ * allocating more than half of the largest block takes all of it. */
+size_t malloc_max_available_after(size_t size);
+
+/* Non-standard: occupancy of the small-block size classes malloc serves from
+ * slab pages. capacity is the number of blocks the class's pages can hold. */
+typedef struct {
+  size_t block_size;
+  size_t number_of_pages;
+  size_t used_blocks;
+  size_t capacity;
+} malloc_class_stats_t;
+
+int malloc_number_of_classes(void);
+void malloc_class_stats(int class_index, malloc_class_stats_t * stats);
+
+/* Non-standard: number of blocks malloc and realloc have returned since boot,
+ * to count the allocations of a piece of code. */
+size_t malloc_number_of_allocations(void);
+
+/* Non-standard: with LIBA_HEAP_TRACE, attributes the next allocation to site
+ * rather than to the caller of malloc. Allocation wrappers like operator new
+ * call it with their own return address. */
+void malloc_set_trace_site(void * site);
+
 void abort(void);
 
 LIBA_END_DECLS
@@ -1,5 +1,102 @@
 #include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
 
 #if (__GLIBC__ || __MINGW32__)
 #include "strlcpy.c"
 #endif
+
+size_t malloc_max_available() {
+  return SIZE_MAX;
+}
+
+size_t malloc_max_available_after(size_t size) {
+  return SIZE_MAX;
+}
+
+int malloc_number_of_classes() {
+  return 0;
+}
+
+void malloc_class_stats(int class_index, malloc_class_stats_t * stats) {
+  stats->block_size = 0;
+  stats->number_of_pages = 0;
+  stats->used_blocks = 0;
+  stats->capacity = 0;
+}
+
+#if __GLIBC__
+/* glibc exports its allocator under __libc_ names, so the allocation functions
+ * can be interposed to count allocations. This replaces the allocator of the
+ * whole process, so it is only done for the benchmarks of the test runner,
+ * which is single-threaded. With LIBA_HEAP_TRACE, the allocation functions are
+ * interposed by bridge_heap_trace.c, which counts as well. */
+size_t bridge_number_of_allocations = 0;
+
+#if QUIZ_RUN_BENCHMARKS && !LIBA_HEAP_TRACE
+#include <errno.h>
+
+void * __libc_malloc(size_t size);
+void * __libc_calloc(size_t count, size_t size);
+void * __libc_realloc(void * ptr, size_t size);
+void * __libc_memalign(size_t alignment, size_t size);
+
+void * malloc(size_t size) {
+  void * p = __libc_malloc(size);
+  if (p != NULL) {
+    bridge_number_of_allocations++;
+  }
+  return p;
+}
+
+void * calloc(size_t count, size_t size) {
+  void * p = __libc_calloc(count, size);
+  if (p != NULL) {
+    bridge_number_of_allocations++;
+  }
+  return p;
+}
+
+void * realloc(void * ptr, size_t size) {
+  void * p = __libc_realloc(ptr, size);
+  if (p != NULL && p != ptr) {
+    bridge_number_of_allocations++;
+  }
+  return p;
+}
+
+/* glibc's aligned_alloc and posix_memalign don't go through memalign, so all
+ * three are interposed. */
+void * memalign(size_t alignment, size_t size) {
+  void * p = __libc_memalign(alignment, size);
+  if (p != NULL) {
+    bridge_number_of_allocations++;
+  }
+  return p;
+}
+
+void * aligned_alloc(size_t alignment, size_t size) {
+  return memalign(alignment, size);
+}
+
+int posix_memalign(void ** memptr, size_t alignment, size_t size) {
+  if (alignment % sizeof(void *) != 0 || (alignment & (alignment - 1)) != 0) {
+    return EINVAL;
+  }
+  void * p = memalign(alignment, size);
+  if (p == NULL) {
+    return ENOMEM;
+  }
+  *memptr = p;
+  return 0;
+}
+#endif
+
+size_t malloc_number_of_allocations() {
+  return bridge_number_of_allocations;
+}
+#else
+size_t malloc_number_of_allocations() {
+  return 0;
+}
+#endif
@@ -0,0 +1,104 @@
+#define _POSIX_C_SOURCE 200809L
+#include <stdlib.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "../include/private/heap_trace.h"
+
+/* On hosts, liba's malloc isn't used, so tracing interposes the libc one.
+ * Records are streamed to the file named by the HEAP_TRACE_FILE environment
+ * variable, heap_trace.bin by default, and flushed when the program exits.
+ * This relies on glibc exporting its allocator under __libc_ names. */
+
+void * __libc_malloc(size_t size);
+void * __libc_calloc(size_t count, size_t size);
+void * __libc_realloc(void * ptr, size_t size);
+void __libc_free(void * ptr);
+
+extern size_t bridge_number_of_allocations;
+
+static int trace_file = -1;
+
+static uint32_t host_clock() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+static void write_to_file(const heap_trace_header_t * header, const heap_trace_record_t * records, size_t number_of_records) {
+  if (trace_file < 0) {
+    const char * path = getenv("HEAP_TRACE_FILE");
+    trace_file = open(path != NULL ? path : "heap_trace.bin", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (trace_file < 0) {
+      return;
+    }
+  }
+  /* The header is rewritten to keep its number of records up to date */
+  if (pwrite(trace_file, header, sizeof(heap_trace_header_t), 0) < 0) {
+    return;
+  }
+  off_t end = lseek(trace_file, 0, SEEK_END);
+  if (end < (off_t)sizeof(heap_trace_header_t)) {
+    end = sizeof(heap_trace_header_t);
+  }
+  if (pwrite(trace_file, records, number_of_records * sizeof(heap_trace_record_t), end) < 0) {
+    return;
+  }
+}
+
+static void start_trace() {
+  static bool started = false;
+  if (started) {
+    return;
+  }
+  started = true;
+  heap_trace_init(NULL, 0, host_clock, write_to_file);
+  atexit(heap_trace_flush);
+}
+
+void * malloc(size_t size) {
+  start_trace();
+  void * p = __libc_malloc(size);
+  const void * site = heap_trace_site(__builtin_return_address(0));
+  if (p != NULL) {
+    bridge_number_of_allocations++;
+    heap_trace_record(HEAP_TRACE_OP_MALLOC, p, size, site);
+  }
+  return p;
+}
+
+void * calloc(size_t count, size_t size) {
+  start_trace();
+  void * p = __libc_calloc(count, size);
+  const void * site = heap_trace_site(__builtin_return_address(0));
+  if (p != NULL) {
+    bridge_number_of_allocations++;
+    heap_trace_record(HEAP_TRACE_OP_MALLOC, p, count * size, site);
+  }
+  return p;
+}
+
+void * realloc(void * ptr, size_t size) {
+  start_trace();
+  void * p = __libc_realloc(ptr, size);
+  const void * site = heap_trace_site(__builtin_return_address(0));
+  if (ptr != NULL && (p != NULL || size == 0)) {
+    heap_trace_record(HEAP_TRACE_OP_FREE, ptr, 0, NULL);
+  }
+  if (p != NULL && p != ptr) {
+    bridge_number_of_allocations++;
+  }
+  if (p != NULL) {
+    heap_trace_record(HEAP_TRACE_OP_MALLOC, p, size, site);
+  }
+  return p;
+}
+
+void free(void * ptr) {
+  if (ptr != NULL) {
+    heap_trace_record(HEAP_TRACE_OP_FREE, ptr, 0, NULL);
+  }
+  __libc_free(ptr);
+}
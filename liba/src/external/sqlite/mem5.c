@@ -425,6 +425,42 @@ static int memsys5Roundup(int n){
   return iFullSz;
 }
 
+/*
+** Return the size of the largest allocation that memsys5Malloc() could
+** satisfy right now, or 0 if the pool is exhausted. This is a liba addition.
+*/
+static int memsys5MaxAvailable(void){
+  int iBin;
+  for(iBin=LOGMAX; iBin>=0 && mem5.aiFreelist[iBin]<0; iBin--){}
+  return iBin<0 ? 0 : mem5.szAtom*(1<<iBin);
+}
+
+/*
+** Return the size of the largest allocation that memsys5Malloc() could
+** satisfy right after allocating nByte bytes, or 0 if there would be nothing
+** left or if nByte can't be allocated. Like memsys5MallocUnsafe(), this rounds
+** nByte up to a power of two and takes the first block of the smallest free
+** list that holds it. This is a liba addition.
+*/
+static int memsys5MaxAvailableAfter(int nByte){
+  int iFullSz, iLogsize, iBin, iMax, i;
+  if( nByte<=0 || nByte>0x40000000 ) return 0;
+  for(iFullSz=mem5.szAtom, iLogsize=0; iFullSz<nByte; iFullSz *= 2, iLogsize++){}
+  for(iBin=iLogsize; iBin<=LOGMAX && mem5.aiFreelist[iBin]<0; iBin++){}
+  if( iBin>LOGMAX ) return 0;
+  /* Splitting the block frees its halves down to iLogsize */
+  iMax = iBin>iLogsize ? iBin-1 : -1;
+  for(i=LOGMAX; i>iMax; i--){
+    int iFree = mem5.aiFreelist[i];
+    if( i==iBin ) iFree = MEM5LINK(iFree)->next;
+    if( iFree>=0 ){
+      iMax = i;
+      break;
+    }
+  }
+  return iMax<0 ? 0 : mem5.szAtom*(1<<iMax);
+}
+
 /*
 ** Return the ceiling of the logarithm base 2 of iValue.
 **
@@ -0,0 +1,75 @@
+#include "../include/private/heap_trace.h"
+#include <stdbool.h>
+
+/* This file is also built against the host libc, hence the relative include
+ * and the absence of any allocation. */
+
+heap_trace_t heap_trace;
+
+static uint32_t (*clock_source)(void) = NULL;
+static uint32_t start_time = 0;
+static heap_trace_sink_t sink = NULL;
+static uint32_t number_of_pending_records = 0;
+static const void * pending_site = NULL;
+static bool is_flushing = false;
+
+void heap_trace_init(void * heap_start, size_t heap_size, uint32_t (*clock)(void), heap_trace_sink_t s) {
+  heap_trace_header_t * header = &heap_trace.header;
+  header->magic = HEAP_TRACE_MAGIC;
+  header->version = HEAP_TRACE_VERSION;
+  header->pointer_size = sizeof(uintptr_t);
+  header->reserved = 0;
+  header->number_of_records = 0;
+  header->capacity = s == NULL ? HEAP_TRACE_CAPACITY : 0;
+  header->heap_start = (uintptr_t)heap_start;
+  header->heap_size = heap_size;
+  header->reference = (uintptr_t)&heap_trace_record;
+  clock_source = clock;
+  start_time = clock == NULL ? 0 : clock();
+  sink = s;
+  number_of_pending_records = 0;
+}
+
+void heap_trace_record(int op, const void * address, size_t size, const void * site) {
+  if (heap_trace.header.magic != HEAP_TRACE_MAGIC || is_flushing) {
+    return;
+  }
+  if (sink != NULL && number_of_pending_records == HEAP_TRACE_CAPACITY) {
+    heap_trace_flush();
+  }
+  uint32_t index = sink != NULL ? number_of_pending_records : heap_trace.header.number_of_records % HEAP_TRACE_CAPACITY;
+  heap_trace_record_t * r = &heap_trace.records[index];
+  r->timestamp = clock_source == NULL ? 0 : clock_source() - start_time;
+  if (size > HEAP_TRACE_SIZE_MASK) {
+    size = HEAP_TRACE_SIZE_MASK;
+  }
+  r->op_and_size = ((uint32_t)op << HEAP_TRACE_OP_SHIFT) | (uint32_t)size;
+  r->address = (uintptr_t)address;
+  r->site = (uintptr_t)site;
+  heap_trace.header.number_of_records++;
+  if (sink != NULL) {
+    number_of_pending_records++;
+  }
+}
+
+void heap_trace_flush() {
+  if (sink == NULL || is_flushing) {
+    return;
+  }
+  /* The sink may allocate, which must not be recorded into the records it is
+   * reading. */
+  is_flushing = true;
+  sink(&heap_trace.header, heap_trace.records, number_of_pending_records);
+  number_of_pending_records = 0;
+  is_flushing = false;
+}
+
+void malloc_set_trace_site(void * site) {
+  pending_site = site;
+}
+
+const void * heap_trace_site(const void * return_address) {
+  const void * site = pending_site != NULL ? pending_site : return_address;
+  pending_site = NULL;
+  return site;
+}
@@ -2,9 +2,12 @@
 #include <string.h>
 #include <assert.h>
 #include <private/memconfig.h>
+#include <private/slab.h>
 
-#if LIBA_LOG_DYNAMIC_MEMORY
-#include <ion/log.h>
+#if LIBA_HEAP_TRACE
+#include <private/heap_trace.h>
+// Defined by Ion, see Ion::Timing::microseconds
+uint32_t ion_microseconds(void);
 #endif
 
 extern char _heap_start;
@@ -20,6 +23,22 @@ void memsys5FreeUnsafe(void *pOld);
 void * memsys5MallocUnsafe(int nByte);
 void * memsys5Realloc(void *pPrior, int nBytes);
 int memsys5Roundup(int n);
+int memsys5MaxAvailable(void);
+int memsys5MaxAvailableAfter(int nByte);
+
+/* Small blocks are served by the slab allocator, from pages it takes from
+ * memsys5. memsys5 blocks are aligned on their size relative to the heap
+ * start, which is what the slab allocator expects of its pages. */
+static slab_allocator_t sSlabAllocator;
+static size_t sNumberOfAllocations = 0;
+
+static void * allocate_slab_page() {
+  return memsys5MallocUnsafe(SLAB_PAGE_SIZE);
+}
+
+static void free_slab_page(void * page) {
+  memsys5FreeUnsafe(page);
+}
 
 static void configure_heap() {
   HeapConfig.nHeap = (&_heap_end - &_heap_start);
@@ -28,42 +47,134 @@ static void configure_heap() {
   HeapConfig.bMemstat = 0;
   HeapConfig.xLog = 0;
   memsys5Init(0);
+  size_t pageTableSize = slab_page_table_size(HeapConfig.nHeap);
+  uint8_t * pageTable = memsys5MallocUnsafe(memsys5Roundup(pageTableSize));
+  assert(pageTable != NULL);
+  slab_init(&sSlabAllocator, &_heap_start, HeapConfig.nHeap, pageTable, allocate_slab_page, free_slab_page);
+#if LIBA_HEAP_TRACE
+  heap_trace_init(&_heap_start, HeapConfig.nHeap, ion_microseconds, NULL);
+#endif
 }
 
-void free(void *ptr) {
-#if LIBA_LOG_DYNAMIC_MEMORY
-  ion_log_print_string("FREE-");
-  ion_log_print_integer((uint32_t)ptr);
-  ion_log_print_string("\n");
-#endif
-  if (ptr != NULL) {
+static void release(void * ptr) {
+  if (slab_owns(&sSlabAllocator, ptr)) {
+    slab_free(&sSlabAllocator, ptr);
+  } else {
     memsys5FreeUnsafe(ptr);
   }
 }
 
-void * malloc(size_t size) {
+static void * allocate(size_t size) {
   void * p = NULL;
-  if (HeapConfig.nHeap == 0) {
-    configure_heap();
+  if (size > 0 && size <= SLAB_MAX_BLOCK_SIZE) {
+    p = slab_malloc(&sSlabAllocator, size);
   }
-  if (size > 0) {
+  if (p == NULL && size > 0) {
+    /* The slab may fail to get a page while memsys5 still has a smaller free
+     * block that fits. */
     p = memsys5MallocUnsafe(memsys5Roundup(size));
   }
-#if LIBA_LOG_DYNAMIC_MEMORY
-  ion_log_print_string("MALLOC-");
-  ion_log_print_integer((uint32_t)p);
-  ion_log_print_string("-");
-  ion_log_print_integer((uint32_t)size);
-  ion_log_print_string("\n");
+  return p;
+}
+
+void free(void *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+#if LIBA_HEAP_TRACE
+  heap_trace_record(HEAP_TRACE_OP_FREE, ptr, 0, NULL);
 #endif
+  release(ptr);
+}
+
+void * malloc(size_t size) {
+  if (HeapConfig.nHeap == 0) {
+    configure_heap();
+  }
   /* If the process could not find enough space in the memory dedicated to
-   * dynamic allocation, p is NULL. The conventional malloc just return NULL
-   * without crashing. However, for debuging purposes, we abort the process
-   * in that case to easily spot memory leaking. */
-  assert(p != NULL);
+   * dynamic allocation, p is NULL, as with the conventional malloc. Callers
+   * like the Python heap size themselves with malloc_max_available and handle
+   * NULL, so failing gracefully lets them recover. */
+  void * p = allocate(size);
+  if (p != NULL) {
+    sNumberOfAllocations++;
+  }
+#if LIBA_HEAP_TRACE
+  const void * site = heap_trace_site(__builtin_return_address(0));
+  if (p != NULL) {
+    heap_trace_record(HEAP_TRACE_OP_MALLOC, p, size, site);
+  }
+#endif
   return p;
 }
 
 void * realloc(void *ptr, size_t size) {
-  return memsys5Realloc(ptr, memsys5Roundup(size));
+  if (ptr == NULL) {
+    return malloc(size);
+  }
+  if (size == 0) {
+    free(ptr);
+    return NULL;
+  }
+  void * p = NULL;
+  if (!slab_owns(&sSlabAllocator, ptr)) {
+    p = memsys5Realloc(ptr, memsys5Roundup(size));
+  } else if (size <= slab_block_size(&sSlabAllocator, ptr)) {
+    p = ptr;
+  } else {
+    p = allocate(size);
+    if (p != NULL) {
+      memcpy(p, ptr, slab_block_size(&sSlabAllocator, ptr));
+      release(ptr);
+    }
+  }
+  if (p != NULL && p != ptr) {
+    sNumberOfAllocations++;
+  }
+#if LIBA_HEAP_TRACE
+  const void * site = heap_trace_site(__builtin_return_address(0));
+  if (p != NULL) {
+    heap_trace_record(HEAP_TRACE_OP_FREE, ptr, 0, NULL);
+    heap_trace_record(HEAP_TRACE_OP_MALLOC, p, size, site);
+  }
+#endif
+  return p;
+}
+
+size_t malloc_max_available() {
+  if (HeapConfig.nHeap == 0) {
+    configure_heap();
+  }
+  /* Empty slab pages kept for reuse would split the largest free block. */
+  slab_release_empty_pages(&sSlabAllocator);
+  return memsys5MaxAvailable();
+}
+
+size_t malloc_max_available_after(size_t size) {
+  if (HeapConfig.nHeap == 0) {
+    configure_heap();
+  }
+  slab_release_empty_pages(&sSlabAllocator);
+  // memsys5 takes int sizes and can't allocate more than 2^30 bytes anyway
+  return memsys5MaxAvailableAfter(size > 0x40000000 ? 0 : size);
+}
+
+size_t malloc_number_of_allocations() {
+  return sNumberOfAllocations;
+}
+
+int malloc_number_of_classes() {
+  return SLAB_NUMBER_OF_CLASSES;
+}
+
+void malloc_class_stats(int class_index, malloc_class_stats_t * stats) {
+  if (HeapConfig.nHeap == 0) {
+    configure_heap();
+  }
+  slab_class_stats_t s;
+  slab_class_stats(&sSlabAllocator, class_index, &s);
+  stats->block_size = s.block_size;
+  stats->number_of_pages = s.number_of_pages;
+  stats->used_blocks = s.used_blocks;
+  stats->capacity = s.capacity;
 }
@@ -0,0 +1,174 @@
+#include <private/slab.h>
+#include <assert.h>
+
+struct slab_page {
+  slab_page_t * next;
+  slab_page_t * previous;
+  void * free_blocks;
+  /* Blocks past unused_offset have never been allocated, so the free list
+   * doesn't need to be built when the page is created. */
+  uint16_t unused_offset;
+  uint16_t used_blocks;
+};
+
+/* Blocks are 8-byte aligned, for doubles */
+#define SLAB_HEADER_SIZE ((sizeof(slab_page_t) + 7) & ~(size_t)7)
+
+static const uint16_t slab_block_sizes[SLAB_NUMBER_OF_CLASSES] = {8, 16, 24, 32, 40, 48, 64};
+
+/* Class of a request, indexed by its size in 8-byte words, rounded up */
+static const uint8_t slab_class_of_words[SLAB_MAX_BLOCK_SIZE/8 + 1] = {0, 0, 1, 2, 3, 4, 5, 6, 6};
+
+static size_t slab_capacity(const slab_class_t * c) {
+  return (SLAB_PAGE_SIZE - SLAB_HEADER_SIZE) / c->block_size;
+}
+
+static size_t page_index(const slab_allocator_t * allocator, const void * p) {
+  return ((const char *)p - allocator->base) / SLAB_PAGE_SIZE;
+}
+
+static bool page_is_full(const slab_class_t * c, const slab_page_t * page) {
+  return page->free_blocks == NULL && page->unused_offset + c->block_size > SLAB_PAGE_SIZE;
+}
+
+static void link_page(slab_class_t * c, slab_page_t * page) {
+  page->previous = NULL;
+  page->next = c->partial_pages;
+  if (page->next != NULL) {
+    page->next->previous = page;
+  }
+  c->partial_pages = page;
+}
+
+static void unlink_page(slab_class_t * c, slab_page_t * page) {
+  if (page->previous != NULL) {
+    page->previous->next = page->next;
+  } else {
+    c->partial_pages = page->next;
+  }
+  if (page->next != NULL) {
+    page->next->previous = page->previous;
+  }
+}
+
+static void release_page(slab_allocator_t * allocator, slab_class_t * c, slab_page_t * page) {
+  unlink_page(c, page);
+  allocator->page_classes[page_index(allocator, page)] = 0;
+  c->number_of_pages--;
+  allocator->free_page(page);
+}
+
+size_t slab_page_table_size(size_t size) {
+  return size / SLAB_PAGE_SIZE + 1;
+}
+
+void slab_init(slab_allocator_t * allocator, char * base, size_t size, uint8_t * page_classes, void * (*allocate_page)(void), void (*free_page)(void * page)) {
+  allocator->base = base;
+  allocator->page_classes = page_classes;
+  allocator->number_of_pages = slab_page_table_size(size);
+  allocator->allocate_page = allocate_page;
+  allocator->free_page = free_page;
+  for (size_t i = 0; i < allocator->number_of_pages; i++) {
+    page_classes[i] = 0;
+  }
+  for (int i = 0; i < SLAB_NUMBER_OF_CLASSES; i++) {
+    slab_class_t * c = &allocator->classes[i];
+    c->block_size = slab_block_sizes[i];
+    c->partial_pages = NULL;
+    c->number_of_pages = 0;
+    c->used_blocks = 0;
+  }
+}
+
+void * slab_malloc(slab_allocator_t * allocator, size_t size) {
+  if (size == 0 || size > SLAB_MAX_BLOCK_SIZE) {
+    return NULL;
+  }
+  int class_index = slab_class_of_words[(size + 7) / 8];
+  slab_class_t * c = &allocator->classes[class_index];
+  slab_page_t * page = c->partial_pages;
+  if (page == NULL) {
+    page = allocator->allocate_page();
+    if (page == NULL) {
+      return NULL;
+    }
+    assert(((char *)page - allocator->base) % SLAB_PAGE_SIZE == 0);
+    assert(page_index(allocator, page) < allocator->number_of_pages);
+    page->free_blocks = NULL;
+    page->unused_offset = SLAB_HEADER_SIZE;
+    page->used_blocks = 0;
+    allocator->page_classes[page_index(allocator, page)] = class_index + 1;
+    c->number_of_pages++;
+    link_page(c, page);
+  }
+  void * block = page->free_blocks;
+  if (block != NULL) {
+    page->free_blocks = *(void **)block;
+  } else {
+    block = (char *)page + page->unused_offset;
+    page->unused_offset += c->block_size;
+  }
+  page->used_blocks++;
+  c->used_blocks++;
+  if (page_is_full(c, page)) {
+    unlink_page(c, page);
+  }
+  return block;
+}
+
+bool slab_owns(const slab_allocator_t * allocator, const void * block) {
+  const char * p = (const char *)block;
+  if (p < allocator->base) {
+    return false;
+  }
+  size_t index = page_index(allocator, p);
+  return index < allocator->number_of_pages && allocator->page_classes[index] != 0;
+}
+
+void slab_free(slab_allocator_t * allocator, void * block) {
+  assert(slab_owns(allocator, block));
+  size_t index = page_index(allocator, block);
+  slab_class_t * c = &allocator->classes[allocator->page_classes[index] - 1];
+  slab_page_t * page = (slab_page_t *)(allocator->base + index * SLAB_PAGE_SIZE);
+  bool was_full = page_is_full(c, page);
+  *(void **)block = page->free_blocks;
+  page->free_blocks = block;
+  page->used_blocks--;
+  c->used_blocks--;
+  if (was_full) {
+    link_page(c, page);
+  }
+  /* Keeping the last page of a class avoids going back to the page allocator
+   * when a single block is allocated and freed over and over. */
+  if (page->used_blocks == 0 && c->number_of_pages > 1) {
+    release_page(allocator, c, page);
+  }
+}
+
+size_t slab_block_size(const slab_allocator_t * allocator, const void * block) {
+  assert(slab_owns(allocator, block));
+  return allocator->classes[allocator->page_classes[page_index(allocator, block)] - 1].block_size;
+}
+
+void slab_release_empty_pages(slab_allocator_t * allocator) {
+  for (int i = 0; i < SLAB_NUMBER_OF_CLASSES; i++) {
+    slab_class_t * c = &allocator->classes[i];
+    slab_page_t * page = c->partial_pages;
+    while (page != NULL) {
+      slab_page_t * next = page->next;
+      if (page->used_blocks == 0) {
+        release_page(allocator, c, page);
+      }
+      page = next;
+    }
+  }
+}
+
+void slab_class_stats(const slab_allocator_t * allocator, int class_index, slab_class_stats_t * stats) {
+  assert(class_index >= 0 && class_index < SLAB_NUMBER_OF_CLASSES);
+  const slab_class_t * c = &allocator->classes[class_index];
+  stats->block_size = c->block_size;
+  stats->number_of_pages = c->number_of_pages;
+  stats->used_blocks = c->used_blocks;
+  stats->capacity = c->number_of_pages * slab_capacity(c);
+}
@@ -0,0 +1,370 @@
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "../../include/private/heap_trace.h"
+
+/* Reconstructs the heap timeline from traces recorded with LIBA_HEAP_TRACE=1,
+ * one trace per scenario, and reports for each the peak, the fragmentation at
+ * the peak, the leaks and the top allocation sites.
+ * Usage: heap_trace_analyzer [-e binary] [-n sites] [--timeline] trace...
+ * With -e, sites are symbolized with addr2line, or with $ADDR2LINE, for
+ * instance arm-none-eabi-addr2line for device traces. --timeline prints the
+ * live bytes after each record as CSV instead of the report. */
+
+struct Header {
+  uint32_t numberOfRecords;
+  uint32_t capacity;
+  uint64_t heapStart;
+  uint64_t heapSize;
+  uint64_t reference;
+};
+
+struct Record {
+  uint32_t timestamp;
+  int op;
+  uint32_t size;
+  uint64_t address;
+  uint64_t site;
+};
+
+struct Trace {
+  std::string name;
+  Header header;
+  std::vector<Record> records;
+};
+
+struct Block {
+  uint32_t size;
+  uint64_t site;
+};
+
+struct Site {
+  uint64_t address = 0;
+  int allocations = 0;
+  uint64_t bytes = 0;
+  uint64_t bytesAtPeak = 0;
+  int leakedBlocks = 0;
+  uint64_t leakedBytes = 0;
+};
+
+static uint64_t readPointer(const char * p, int pointerSize) {
+  if (pointerSize == 4) {
+    uint32_t v;
+    memcpy(&v, p, 4);
+    return v;
+  }
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static bool readTrace(const char * path, Trace * trace) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<char> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  if (data.size() < 16) {
+    fprintf(stderr, "%s: not a heap trace\n", path);
+    return false;
+  }
+  uint32_t magic;
+  uint16_t version;
+  memcpy(&magic, &data[0], 4);
+  memcpy(&version, &data[4], 2);
+  int pointerSize = (uint8_t)data[6];
+  size_t headerSize = 16 + 3 * pointerSize;
+  if (magic != HEAP_TRACE_MAGIC || version != HEAP_TRACE_VERSION || (pointerSize != 4 && pointerSize != 8) || data.size() < headerSize) {
+    fprintf(stderr, "%s: not a heap trace, or of another version\n", path);
+    return false;
+  }
+  trace->name = path;
+  Header & h = trace->header;
+  memcpy(&h.numberOfRecords, &data[8], 4);
+  memcpy(&h.capacity, &data[12], 4);
+  h.heapStart = readPointer(&data[16], pointerSize);
+  h.heapSize = readPointer(&data[16 + pointerSize], pointerSize);
+  h.reference = readPointer(&data[16 + 2 * pointerSize], pointerSize);
+
+  size_t recordSize = 8 + 2 * pointerSize;
+  size_t storedRecords = (data.size() - headerSize) / recordSize;
+  size_t first = 0;
+  size_t count = storedRecords;
+  if (h.capacity != 0) {
+    /* A ring dump: the oldest record follows the newest one once it wrapped */
+    count = std::min<size_t>(std::min<size_t>(h.numberOfRecords, h.capacity), storedRecords);
+    first = h.numberOfRecords > h.capacity ? h.numberOfRecords % h.capacity : 0;
+  }
+  for (size_t i = 0; i < count; i++) {
+    size_t index = h.capacity != 0 ? (first + i) % h.capacity : i;
+    const char * p = &data[headerSize + index * recordSize];
+    Record r;
+    uint32_t opAndSize;
+    memcpy(&r.timestamp, p, 4);
+    memcpy(&opAndSize, p + 4, 4);
+    r.op = opAndSize >> HEAP_TRACE_OP_SHIFT;
+    r.size = opAndSize & HEAP_TRACE_SIZE_MASK;
+    r.address = readPointer(p + 8, pointerSize);
+    r.site = readPointer(p + 8 + pointerSize, pointerSize);
+    trace->records.push_back(r);
+  }
+  return true;
+}
+
+class Symbolizer {
+public:
+  Symbolizer(const char * binary, uint64_t reference) : m_binary(binary), m_offset(0) {
+    if (m_binary == nullptr) {
+      return;
+    }
+    std::string command = std::string("nm ") + m_binary + " 2>/dev/null";
+    FILE * nm = popen(command.c_str(), "r");
+    char line[512];
+    while (nm != nullptr && fgets(line, sizeof(line), nm) != nullptr) {
+      char type;
+      char name[400];
+      unsigned long long address;
+      if (sscanf(line, "%llx %c %399s", &address, &type, name) == 3 && strcmp(name, "heap_trace_record") == 0) {
+        /* Thumb function pointers have their low bit set */
+        m_offset = (reference & ~1ull) - address;
+      }
+    }
+    if (nm != nullptr) {
+      pclose(nm);
+    }
+  }
+  void symbolize(const std::vector<uint64_t> & sites) {
+    if (m_binary == nullptr || sites.empty()) {
+      return;
+    }
+    const char * addr2line = getenv("ADDR2LINE");
+    std::string command = std::string(addr2line != nullptr ? addr2line : "addr2line") + " -f -C -s -e " + m_binary;
+    for (uint64_t site : sites) {
+      char address[32];
+      /* Sites are return addresses: look up the call instruction before */
+      snprintf(address, sizeof(address), " 0x%llx", (unsigned long long)((site & ~1ull) - m_offset - 1));
+      command += address;
+    }
+    FILE * output = popen(command.c_str(), "r");
+    char function[512];
+    char location[512];
+    for (uint64_t site : sites) {
+      if (output == nullptr || fgets(function, sizeof(function), output) == nullptr || fgets(location, sizeof(location), output) == nullptr) {
+        break;
+      }
+      function[strcspn(function, "\n")] = 0;
+      location[strcspn(location, "\n")] = 0;
+      m_names[site] = std::string(function) + " (" + location + ")";
+    }
+    if (output != nullptr) {
+      pclose(output);
+    }
+  }
+  std::string name(uint64_t site) const {
+    auto n = m_names.find(site);
+    if (n != m_names.end()) {
+      return n->second;
+    }
+    char address[32];
+    snprintf(address, sizeof(address), "0x%llx", (unsigned long long)site);
+    return address;
+  }
+private:
+  const char * m_binary;
+  uint64_t m_offset;
+  std::map<uint64_t, std::string> m_names;
+};
+
+/* Replays the records before end, returning the live blocks */
+static std::map<uint64_t, Block> replay(const Trace & trace, size_t end, int * unknownFrees = nullptr) {
+  std::map<uint64_t, Block> live;
+  for (size_t i = 0; i < end; i++) {
+    const Record & r = trace.records[i];
+    if (r.op == HEAP_TRACE_OP_MALLOC) {
+      live[r.address] = Block{r.size, r.site};
+    } else if (r.op == HEAP_TRACE_OP_FREE) {
+      if (live.erase(r.address) == 0 && unknownFrees != nullptr) {
+        (*unknownFrees)++;
+      }
+    }
+  }
+  return live;
+}
+
+static void printTimeline(const Trace & trace) {
+  std::map<uint64_t, uint32_t> live;
+  uint64_t liveBytes = 0;
+  for (size_t i = 0; i < trace.records.size(); i++) {
+    const Record & r = trace.records[i];
+    if (r.op == HEAP_TRACE_OP_MALLOC) {
+      live[r.address] = r.size;
+      liveBytes += r.size;
+    } else {
+      auto b = live.find(r.address);
+      if (b != live.end()) {
+        liveBytes -= b->second;
+        live.erase(b);
+      }
+    }
+    printf("%s,%zu,%u,%llu,%zu\n", trace.name.c_str(), i, r.timestamp, (unsigned long long)liveBytes, live.size());
+  }
+}
+
+static void printReport(const Trace & trace, const char * binary, int numberOfSites) {
+  const std::vector<Record> & records = trace.records;
+  const Header & h = trace.header;
+
+  /* First pass: find the peak */
+  std::map<uint64_t, uint32_t> live;
+  uint64_t liveBytes = 0;
+  uint64_t peakBytes = 0;
+  size_t peakEnd = 0;
+  int mallocs = 0;
+  int frees = 0;
+  std::map<uint64_t, Site> sites;
+  for (size_t i = 0; i < records.size(); i++) {
+    const Record & r = records[i];
+    if (r.op == HEAP_TRACE_OP_MALLOC) {
+      mallocs++;
+      live[r.address] = r.size;
+      liveBytes += r.size;
+      Site & s = sites[r.site];
+      s.address = r.site;
+      s.allocations++;
+      s.bytes += r.size;
+      if (liveBytes > peakBytes) {
+        peakBytes = liveBytes;
+        peakEnd = i + 1;
+      }
+    } else {
+      frees++;
+      auto b = live.find(r.address);
+      if (b != live.end()) {
+        liveBytes -= b->second;
+        live.erase(b);
+      }
+    }
+  }
+
+  printf("%s: %zu records, %d mallocs, %d frees\n", trace.name.c_str(), records.size(), mallocs, frees);
+  if (records.size() < h.numberOfRecords) {
+    printf("  Only the last %zu of %u records were kept: blocks allocated before are unknown\n", records.size(), h.numberOfRecords);
+  }
+
+  /* Second pass: the heap layout at the peak */
+  std::map<uint64_t, Block> atPeak = replay(trace, peakEnd);
+  for (auto & b : atPeak) {
+    sites[b.second.site].bytesAtPeak += b.second.size;
+  }
+  printf("  Peak: %llu bytes in %zu blocks", (unsigned long long)peakBytes, atPeak.size());
+  if (peakEnd > 0) {
+    printf(" at record %zu (t=%u us)", peakEnd - 1, records[peakEnd - 1].timestamp);
+  }
+  printf("\n");
+  if (!atPeak.empty()) {
+    /* Without a known heap range, free space is measured between the lowest
+     * and the highest live blocks. */
+    uint64_t start = h.heapSize != 0 ? h.heapStart : atPeak.begin()->first;
+    uint64_t end = start + h.heapSize;
+    if (h.heapSize == 0) {
+      for (auto & b : atPeak) {
+        end = std::max(end, b.first + b.second.size);
+      }
+    }
+    uint64_t cursor = start;
+    uint64_t freeBytes = 0;
+    uint64_t largestFreeRange = 0;
+    for (auto & b : atPeak) {
+      if (b.first > cursor) {
+        freeBytes += b.first - cursor;
+        largestFreeRange = std::max(largestFreeRange, b.first - cursor);
+      }
+      cursor = std::max(cursor, b.first + b.second.size);
+    }
+    if (end > cursor) {
+      freeBytes += end - cursor;
+      largestFreeRange = std::max(largestFreeRange, end - cursor);
+    }
+    int fragmentation = freeBytes == 0 ? 0 : (int)(100 - 100 * largestFreeRange / freeBytes);
+    printf("  Fragmentation at peak: %d%% (%llu free bytes, largest free range %llu bytes)\n", fragmentation, (unsigned long long)freeBytes, (unsigned long long)largestFreeRange);
+  }
+
+  int unknownFrees = 0;
+  std::map<uint64_t, Block> leaks = replay(trace, records.size(), &unknownFrees);
+  uint64_t leakedBytes = 0;
+  for (auto & b : leaks) {
+    Site & s = sites[b.second.site];
+    s.leakedBlocks++;
+    s.leakedBytes += b.second.size;
+    leakedBytes += b.second.size;
+  }
+  if (unknownFrees > 0) {
+    printf("  %d frees of blocks allocated before the trace started\n", unknownFrees);
+  }
+
+  std::vector<Site> sorted;
+  for (auto & s : sites) {
+    sorted.push_back(s.second);
+  }
+  std::vector<uint64_t> addresses;
+  for (const Site & s : sorted) {
+    addresses.push_back(s.address);
+  }
+  Symbolizer symbolizer(binary, h.reference);
+  symbolizer.symbolize(addresses);
+
+  printf("  Leaks: %llu bytes in %zu blocks\n", (unsigned long long)leakedBytes, leaks.size());
+  std::sort(sorted.begin(), sorted.end(), [](const Site & a, const Site & b) { return a.leakedBytes > b.leakedBytes; });
+  for (int i = 0; i < (int)sorted.size() && i < numberOfSites && sorted[i].leakedBlocks > 0; i++) {
+    printf("    %llu bytes in %d blocks from %s\n", (unsigned long long)sorted[i].leakedBytes, sorted[i].leakedBlocks, symbolizer.name(sorted[i].address).c_str());
+  }
+
+  printf("  Top allocation sites:\n");
+  printf("    %10s %8s %10s  %s\n", "bytes", "mallocs", "at peak", "site");
+  std::sort(sorted.begin(), sorted.end(), [](const Site & a, const Site & b) { return a.bytes > b.bytes; });
+  for (int i = 0; i < (int)sorted.size() && i < numberOfSites; i++) {
+    printf("    %10llu %8d %10llu  %s\n", (unsigned long long)sorted[i].bytes, sorted[i].allocations, (unsigned long long)sorted[i].bytesAtPeak, symbolizer.name(sorted[i].address).c_str());
+  }
+}
+
+int main(int argc, char * argv[]) {
+  const char * binary = nullptr;
+  int numberOfSites = 10;
+  bool timeline = false;
+  std::vector<const char *> paths;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+      binary = argv[++i];
+    } else if (strcmp(argv[i], "-n") == 0 && i + 1 < argc) {
+      numberOfSites = atoi(argv[++i]);
+    } else if (strcmp(argv[i], "--timeline") == 0) {
+      timeline = true;
+    } else {
+      paths.push_back(argv[i]);
+    }
+  }
+  if (paths.empty()) {
+    fprintf(stderr, "Usage: %s [-e binary] [-n sites] [--timeline] trace...\n", argv[0]);
+    return 1;
+  }
+  int status = 0;
+  if (timeline) {
+    printf("trace,record,timestamp_us,live_bytes,live_blocks\n");
+  }
+  for (const char * path : paths) {
+    Trace trace;
+    if (!readTrace(path, &trace)) {
+      status = 1;
+      continue;
+    }
+    if (timeline) {
+      printTimeline(trace);
+    } else {
+      printReport(trace, binary, numberOfSites);
+    }
+  }
+  return status;
+}
@@ -0,0 +1,253 @@
+#include <math.h>
+#include <string.h>
+#include "../include/private/vmath.h"
+
+/* Double-precision array functions. The kernels follow fdlibm, which the
+ * scalar functions also come from. As in vmathf.c, lanes outside a kernel's
+ * domain are recomputed with the scalar function. */
+
+typedef vmath_double_t vd;
+typedef vmath_long_t vl;
+
+#define ROUNDING_MAGIC 0x1.8p52
+#define ROUNDING_MAGIC_BITS 0x4338000000000000
+
+VMATH_ALWAYS_INLINE vd abs_d(vd x) {
+  return (vd)((vl)x & 0x7FFFFFFFFFFFFFFF);
+}
+
+VMATH_ALWAYS_INLINE vd long_to_double(vl k) {
+  return (vd)(k + ROUNDING_MAGIC_BITS) - ROUNDING_MAGIC;
+}
+
+VMATH_ALWAYS_INLINE vd select_d(vl mask, vd a, vd b) {
+  return (vd)(((vl)a & mask) | ((vl)b & ~mask));
+}
+
+/* Rounding error of the sum s = a + b, and of the product p = a * b. The
+ * latter splits the factors in halves whose products are exact, as there is
+ * no fused multiply-add to rely on. */
+VMATH_ALWAYS_INLINE vd sum_error(vd a, vd b, vd s) {
+  vd bb = s - a;
+  return (a - (s - bb)) + (b - bb);
+}
+
+VMATH_ALWAYS_INLINE vd product_error(vd a, vd b, vd p) {
+  vd ca = 134217729.0 * a;
+  vd ah = ca - (ca - a);
+  vd al = a - ah;
+  vd cb = 134217729.0 * b;
+  vd bh = cb - (cb - b);
+  vd bl = b - bh;
+  return ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+}
+
+/* Shared by vsin and vcos: x = k*pi/2 + r, |r| <= pi/4. pi/2 is split in
+ * four parts, the first three of 33 bits so that k*part is exact for
+ * |x| <= SINCOS_MAX. */
+#define SINCOS_MAX 0x1p20
+
+VMATH_ALWAYS_INLINE vd reduce_pio2(vd x, vl * k) {
+  vd t = x * 6.36619772367581382433e-01 + ROUNDING_MAGIC;
+  *k = (vl)t - ROUNDING_MAGIC_BITS;
+  vd kd = t - ROUNDING_MAGIC;
+  vd r = x - kd * 1.57079632673412561417e+00;
+  r = r - kd * 6.07710050630396597660e-11;
+  r = r - kd * 2.02226624871116645580e-21;
+  return r - kd * 8.47842766036889956997e-32;
+}
+
+VMATH_ALWAYS_INLINE vd sincos_kernel(vd r, vl q) {
+  vd z = r * r;
+  vd v = z * r;
+  vd p = 8.33333333332248946124e-03 + z * (-1.98412698298579493134e-04 + z * (2.75573137070700676789e-06 + z * (-2.50507602534068634195e-08 + z * 1.58969099521155010221e-10)));
+  vd s = r + v * (-1.66666666666666324348e-01 + z * p);
+  vd hz = 0.5 * z;
+  vd w = 1.0 - hz;
+  vd c = z * z * (4.16666666666666019037e-02 + z * (-1.38888888888741095749e-03 + z * (2.48015872894767294178e-05 + z * (-2.75573143513906633035e-07 + z * (2.08757232129817482790e-09 + z * -1.13596475577881948265e-11)))));
+  c = w + (((1.0 - w) - hz) + c);
+  vd result = select_d((q & 1) != 0, c, s);
+  return (vd)((vl)result ^ ((q & 2) << 62));
+}
+
+VMATH_ALWAYS_INLINE vd sin_kernel(vd x, vl * special) {
+  /* The kernel loses the sign of -0 */
+  *special = ~(abs_d(x) <= SINCOS_MAX) | (x == 0.0);
+  vl k;
+  vd r = reduce_pio2(x, &k);
+  return sincos_kernel(r, k);
+}
+
+VMATH_ALWAYS_INLINE vd cos_kernel(vd x, vl * special) {
+  *special = ~(abs_d(x) <= SINCOS_MAX);
+  vl k;
+  vd r = reduce_pio2(x, &k);
+  return sincos_kernel(r, k + 1);
+}
+
+/* exp(x + xl) for x in [-708, 709], where xl is a tail below the precision of
+ * x: x = k*ln(2) + r, |r| <= ln(2)/2, and exp(x) = 2^k*exp(r). */
+VMATH_ALWAYS_INLINE vd exp_kernel(vd x, vd xl) {
+  vd t = x * 1.44269504088896338700e+00 + ROUNDING_MAGIC;
+  vl k = (vl)t - ROUNDING_MAGIC_BITS;
+  vd kd = t - ROUNDING_MAGIC;
+  vd hi = x - kd * 6.93147180369123816490e-01;
+  vd lo = kd * 1.90821492927058770002e-10 - xl;
+  vd r = hi - lo;
+  vd z = r * r;
+  vd c = r - z * (1.66666666666666019037e-01 + z * (-2.77777777770155933842e-03 + z * (6.61375632143793436117e-05 + z * (-1.65339022054652515390e-06 + z * 4.13813679705723846039e-08))));
+  vd y = 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+  return y * (vd)((k + 1023) << 52);
+}
+
+VMATH_ALWAYS_INLINE vd exp_special_kernel(vd x, vl * special) {
+  *special = ~((x >= -708.0) & (x <= 709.0));
+  return exp_kernel(x, (vd){0});
+}
+
+/* x = 2^k*m, sqrt(1/2) <= m < sqrt(2), f = m - 1 and s = f/(2 + f). Then
+ * log(m) = 2*atanh(s) = 2s + s*R(s^2). Only positive normal numbers are
+ * handled. */
+VMATH_ALWAYS_INLINE vl log_reduce(vd x, vd * k, vd * f) {
+  vl ix = (vl)x;
+  vl iy = ix - 0x3FE6A09E667F3BCD;
+  *k = long_to_double(iy >> 52);
+  *f = (vd)((iy & 0x000FFFFFFFFFFFFF) + 0x3FE6A09E667F3BCD) - 1.0;
+  return ~((ix >= 0x0010000000000000) & (ix < 0x7FF0000000000000));
+}
+
+VMATH_ALWAYS_INLINE vd log_r(vd s) {
+  vd z = s * s;
+  vd w = z * z;
+  vd t1 = w * (3.999999999940941908e-01 + w * (2.222219843214978396e-01 + w * 1.531383769920937332e-01));
+  vd t2 = z * (6.666666666666735130e-01 + w * (2.857142874366239149e-01 + w * (1.818357216161805012e-01 + w * 1.479819860511658591e-01)));
+  return t1 + t2;
+}
+
+VMATH_ALWAYS_INLINE vd log_kernel(vd x, vl * special) {
+  vd k, f;
+  *special = log_reduce(x, &k, &f);
+  vd s = f / (2.0 + f);
+  vd hfsq = 0.5 * f * f;
+  return k * 6.93147180369123816490e-01 - ((hfsq - (s * (hfsq + log_r(s)) + k * 1.90821492927058770002e-10)) - f);
+}
+
+/* R(z) from the Taylor series of atanh, to 2^-66 relative to log(m) instead
+ * of the 2^-58 of log_r's minimax polynomial. */
+VMATH_ALWAYS_INLINE vd log_extended_r(vd s) {
+  vd z = s * s;
+  vd p = z * (2.0/25) + 2.0/23;
+  p = p * z + 2.0/21;
+  p = p * z + 2.0/19;
+  p = p * z + 2.0/17;
+  p = p * z + 2.0/15;
+  p = p * z + 2.0/13;
+  p = p * z + 2.0/11;
+  p = p * z + 2.0/9;
+  p = p * z + 2.0/7;
+  p = p * z + 2.0/5;
+  p = p * z + 2.0/3;
+  return p * z;
+}
+
+/* log(x) as hi + *lo, for vpow: y*log(x) is up to ~709, where an ulp of
+ * error in log(x) would cost hundreds of ulps in the result. */
+VMATH_ALWAYS_INLINE vd log_extended_kernel(vd x, vd * lo, vl * special) {
+  vd k, f;
+  *special = log_reduce(x, &k, &f);
+  /* s = f/(1 + m) to twice the precision */
+  vd one = (vd){0} + 1.0;
+  vd m = f + one;
+  vd d = one + m;
+  vd dl = sum_error(one, m, d);
+  vd s = f / d;
+  vd p = s * d;
+  vd sl = ((f - p) - product_error(s, d, p) - s * dl) / d;
+  /* k*ln2_hi and 2s are exact. The derivative of 2*atanh(s) is
+   * 2/(1 - s^2) ~ 2*(1 + s^2), which weighs the tail of s. */
+  vd a = k * 6.93147180369123816490e-01;
+  vd hi = a + 2.0 * s;
+  vd l = sum_error(a, 2.0 * s, hi) + k * 1.90821492927058770002e-10 + 2.0 * sl * (1.0 + s * s) + s * log_extended_r(s);
+  vd result = hi + l;
+  *lo = l - (result - hi);
+  return result;
+}
+
+VMATH_ALWAYS_INLINE vd pow_kernel(vd x, vd y, vl * special) {
+  vd ll;
+  vd l = log_extended_kernel(x, &ll, special);
+  vd t = y * l;
+  vd tl = product_error(y, l, t) + y * ll;
+  /* Also catches a NaN or infinite y */
+  *special |= ~((t >= -708.0) & (t <= 709.0));
+  return exp_kernel(t, tl);
+}
+
+/* See map_block_f in vmathf.c */
+VMATH_ALWAYS_INLINE void map_block_d(double * y, const double * x, size_t lanes, vd (*kernel)(vd, vl *), double (*scalar)(double)) {
+  vd v = {0};
+  memcpy(&v, x, lanes * sizeof(double));
+  vl special;
+  vd result = kernel(v, &special);
+  if (special[0] | special[1]) {
+    for (size_t j = 0; j < lanes; j++) {
+      if (special[j]) {
+        result[j] = scalar(v[j]);
+      }
+    }
+  }
+  memcpy(y, &result, lanes * sizeof(double));
+}
+
+VMATH_ALWAYS_INLINE void map_d(double * y, const double * x, size_t n, vd (*kernel)(vd, vl *), double (*scalar)(double)) {
+  size_t i = 0;
+  for (; i + VMATH_DOUBLE_LANES <= n; i += VMATH_DOUBLE_LANES) {
+    map_block_d(y + i, x + i, VMATH_DOUBLE_LANES, kernel, scalar);
+  }
+  if (i < n) {
+    map_block_d(y + i, x + i, n - i, kernel, scalar);
+  }
+}
+
+VMATH_ALWAYS_INLINE void pow_block(double * z, const double * x, const double * y, size_t lanes) {
+  vd u = {0};
+  vd v = {0};
+  memcpy(&u, x, lanes * sizeof(double));
+  memcpy(&v, y, lanes * sizeof(double));
+  vl special;
+  vd result = pow_kernel(u, v, &special);
+  if (special[0] | special[1]) {
+    for (size_t j = 0; j < lanes; j++) {
+      if (special[j]) {
+        result[j] = pow(u[j], v[j]);
+      }
+    }
+  }
+  memcpy(z, &result, lanes * sizeof(double));
+}
+
+void vsin(double * y, const double * x, size_t n) {
+  map_d(y, x, n, sin_kernel, sin);
+}
+
+void vcos(double * y, const double * x, size_t n) {
+  map_d(y, x, n, cos_kernel, cos);
+}
+
+void vexp(double * y, const double * x, size_t n) {
+  map_d(y, x, n, exp_special_kernel, exp);
+}
+
+void vlog(double * y, const double * x, size_t n) {
+  map_d(y, x, n, log_kernel, log);
+}
+
+void vpow(double * z, const double * x, const double * y, size_t n) {
+  size_t i = 0;
+  for (; i + VMATH_DOUBLE_LANES <= n; i += VMATH_DOUBLE_LANES) {
+    pow_block(z + i, x + i, y + i, VMATH_DOUBLE_LANES);
+  }
+  if (i < n) {
+    pow_block(z + i, x + i, y + i, n - i);
+  }
+}
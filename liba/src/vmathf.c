@@ -0,0 +1,173 @@
+#include <math.h>
+#include <string.h>
+#include "../include/private/vmath.h"
+
+/* Single-precision array functions. The kernels follow Cephes: Cody-Waite
+ * range reduction followed by a minimax polynomial. Lanes the kernels don't
+ * handle exactly, because their argument is too large, not finite or out of
+ * the normal range, are flagged and recomputed with the scalar function. */
+
+typedef vmath_float_t vf;
+typedef vmath_int_t vi;
+
+/* Adding 1.5*2^23 to |x| < 2^22 rounds it to an integer, which can then be
+ * read in the low bits of the sum. */
+#define ROUNDING_MAGIC 0x1.8p23f
+#define ROUNDING_MAGIC_BITS 0x4B400000
+
+VMATH_ALWAYS_INLINE vf abs_f(vf x) {
+  return (vf)((vi)x & 0x7FFFFFFF);
+}
+
+VMATH_ALWAYS_INLINE vf int_to_float(vi k) {
+  return (vf)(k + ROUNDING_MAGIC_BITS) - ROUNDING_MAGIC;
+}
+
+VMATH_ALWAYS_INLINE vf select_f(vi mask, vf a, vf b) {
+  return (vf)(((vi)a & mask) | ((vi)b & ~mask));
+}
+
+/* Shared by vsinf and vcosf: x = k*pi/2 + r, |r| <= pi/4. pi/2 is split in
+ * four parts, the first three of 12 bits so that k*part is exact for
+ * |x| <= SINCOSF_MAX. */
+#define SINCOSF_MAX 0x1p12f
+
+VMATH_ALWAYS_INLINE vf reduce_pio2f(vf x, vi * k) {
+  vf t = x * 0x1.45f306p-1f + ROUNDING_MAGIC;
+  *k = (vi)t - ROUNDING_MAGIC_BITS;
+  vf kf = t - ROUNDING_MAGIC;
+  vf r = x - kf * 0x1.92p0f;
+  r = r - kf * 0x1.fb4p-12f;
+  r = r - kf * 0x1.444p-24f;
+  return r - kf * 0x1.68c234p-39f;
+}
+
+/* sin(r) or cos(r) for r in [-pi/4, pi/4], depending on the quadrant q */
+VMATH_ALWAYS_INLINE vf sincosf_kernel(vf r, vi q) {
+  vf z = r * r;
+  vf s = ((-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f) * z * r + r;
+  vf c = ((2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f) * z * z - 0.5f * z + 1.0f;
+  vf result = select_f((q & 1) != 0, c, s);
+  return (vf)((vi)result ^ ((q & 2) << 30));
+}
+
+VMATH_ALWAYS_INLINE vf sinf_kernel(vf x, vi * special) {
+  /* The kernel loses the sign of -0 */
+  *special = ~(abs_f(x) <= SINCOSF_MAX) | (x == 0.0f);
+  vi k;
+  vf r = reduce_pio2f(x, &k);
+  return sincosf_kernel(r, k);
+}
+
+VMATH_ALWAYS_INLINE vf cosf_kernel(vf x, vi * special) {
+  *special = ~(abs_f(x) <= SINCOSF_MAX);
+  vi k;
+  vf r = reduce_pio2f(x, &k);
+  return sincosf_kernel(r, k + 1);
+}
+
+/* x = k*ln(2) + r, |r| <= ln(2)/2, and exp(x) = 2^k*exp(r). The bounds keep
+ * 2^k a normal number. */
+VMATH_ALWAYS_INLINE vf expf_kernel(vf x, vi * special) {
+  *special = ~((x >= -87.0f) & (x <= 88.0f));
+  vf t = x * 0x1.715476p0f + ROUNDING_MAGIC;
+  vi k = (vi)t - ROUNDING_MAGIC_BITS;
+  vf kf = t - ROUNDING_MAGIC;
+  vf r = x - kf * 0.693359375f;
+  r = r - kf * -2.12194440e-4f;
+  vf p = ((((1.9875691500e-4f * r + 1.3981999507e-3f) * r + 8.3334519073e-3f) * r + 4.1665795894e-2f) * r + 1.6666665459e-1f) * r + 5.0000001201e-1f;
+  p = p * r * r + r + 1.0f;
+  return p * (vf)((k + 127) << 23);
+}
+
+/* x = 2^k*m, sqrt(1/2) <= m < sqrt(2), and log(x) = k*ln(2) + log(m) */
+VMATH_ALWAYS_INLINE vf logf_kernel(vf x, vi * special) {
+  vi ix = (vi)x;
+  /* Only positive normal numbers take the fast path */
+  *special = ~((ix >= 0x00800000) & (ix < 0x7F800000));
+  vi iy = ix - 0x3F3504F3;
+  vf kf = int_to_float(iy >> 23);
+  vf f = (vf)((iy & 0x007FFFFF) + 0x3F3504F3) - 1.0f;
+  vf z = f * f;
+  vf y = (((((((7.0376836292e-2f * f - 1.1514610310e-1f) * f + 1.1676998740e-1f) * f - 1.2420140846e-1f) * f + 1.4249322787e-1f) * f - 1.6668057665e-1f) * f + 2.0000714765e-1f) * f - 2.4999993993e-1f) * f + 3.3333331174e-1f;
+  y = y * f * z;
+  y = y + kf * -2.12194440e-4f;
+  y = y - 0.5f * z;
+  return f + y + kf * 0.693359375f;
+}
+
+/* y[i] = f(x[i]) for one block of lanes. A partial block is padded with zeros,
+ * which every kernel accepts. Lanes are read back from v since y may be x. */
+VMATH_ALWAYS_INLINE void map_block_f(float * y, const float * x, size_t lanes, vf (*kernel)(vf, vi *), float (*scalar)(float)) {
+  vf v = {0};
+  memcpy(&v, x, lanes * sizeof(float));
+  vi special;
+  vf result = kernel(v, &special);
+  int any = 0;
+  for (size_t j = 0; j < VMATH_FLOAT_LANES; j++) {
+    any |= special[j];
+  }
+  if (any) {
+    for (size_t j = 0; j < lanes; j++) {
+      if (special[j]) {
+        result[j] = scalar(v[j]);
+      }
+    }
+  }
+  memcpy(y, &result, lanes * sizeof(float));
+}
+
+VMATH_ALWAYS_INLINE void map_f(float * y, const float * x, size_t n, vf (*kernel)(vf, vi *), float (*scalar)(float)) {
+  size_t i = 0;
+  for (; i + VMATH_FLOAT_LANES <= n; i += VMATH_FLOAT_LANES) {
+    map_block_f(y + i, x + i, VMATH_FLOAT_LANES, kernel, scalar);
+  }
+  if (i < n) {
+    map_block_f(y + i, x + i, n - i, kernel, scalar);
+  }
+}
+
+void vsinf(float * y, const float * x, size_t n) {
+  map_f(y, x, n, sinf_kernel, sinf);
+}
+
+void vcosf(float * y, const float * x, size_t n) {
+  map_f(y, x, n, cosf_kernel, cosf);
+}
+
+void vexpf(float * y, const float * x, size_t n) {
+  map_f(y, x, n, expf_kernel, expf);
+}
+
+void vlogf(float * y, const float * x, size_t n) {
+  map_f(y, x, n, logf_kernel, logf);
+}
+
+void vpowf(float * z, const float * x, const float * y, size_t n) {
+#if __ARM_FP && !(__ARM_FP & 8)
+  /* A float kernel would lose too much in y*log(x), and double precision
+   * is emulated on single-precision FPUs: the scalar powf is faster. */
+  for (size_t i = 0; i < n; i++) {
+    z[i] = powf(x[i], y[i]);
+  }
+#else
+  /* exp(y*log(x)) in double precision is exact enough for a float result */
+  double t[32];
+  for (size_t i = 0; i < n; i += 32) {
+    size_t count = n - i < 32 ? n - i : 32;
+    for (size_t j = 0; j < count; j++) {
+      t[j] = x[i + j];
+    }
+    vlog(t, t, count);
+    for (size_t j = 0; j < count; j++) {
+      t[j] *= y[i + j];
+    }
+    vexp(t, t, count);
+    for (size_t j = 0; j < count; j++) {
+      float a = x[i + j];
+      float b = y[i + j];
+      z[i + j] = a > 0.0f && a < INFINITY && b - b == 0.0f ? t[j] : powf(a, b);
+    }
+  }
+#endif
+}
@@ -0,0 +1,99 @@
+#include <quiz.h>
+#include <private/slab.h>
+#include <assert.h>
+
+#define ARENA_PAGES 4
+
+static char arena[ARENA_PAGES * SLAB_PAGE_SIZE] __attribute__((aligned(8)));
+static uint8_t page_classes[ARENA_PAGES + 1];
+static bool page_is_used[ARENA_PAGES];
+static int number_of_used_pages;
+
+static void * allocate_page() {
+  for (int i = 0; i < ARENA_PAGES; i++) {
+    if (!page_is_used[i]) {
+      page_is_used[i] = true;
+      number_of_used_pages++;
+      return arena + i * SLAB_PAGE_SIZE;
+    }
+  }
+  return NULL;
+}
+
+static void free_page(void * page) {
+  int i = ((char *)page - arena) / SLAB_PAGE_SIZE;
+  assert(page_is_used[i]);
+  page_is_used[i] = false;
+  number_of_used_pages--;
+}
+
+static void init_allocator(slab_allocator_t * a) {
+  for (int i = 0; i < ARENA_PAGES; i++) {
+    page_is_used[i] = false;
+  }
+  number_of_used_pages = 0;
+  slab_init(a, arena, sizeof(arena), page_classes, allocate_page, free_page);
+}
+
+QUIZ_CASE(liba_slab_size_classes) {
+  slab_allocator_t a;
+  init_allocator(&a);
+  assert(slab_malloc(&a, 0) == NULL);
+  assert(slab_malloc(&a, SLAB_MAX_BLOCK_SIZE + 1) == NULL);
+  void * p = slab_malloc(&a, 1);
+  assert(slab_owns(&a, p) && slab_block_size(&a, p) == 8);
+  void * q = slab_malloc(&a, 17);
+  assert(slab_block_size(&a, q) == 24);
+  void * r = slab_malloc(&a, 49);
+  assert(slab_block_size(&a, r) == 64);
+  assert(((uintptr_t)r & 7) == 0);
+  assert(number_of_used_pages == 3);
+  int local;
+  assert(!slab_owns(&a, &local));
+  slab_free(&a, p);
+  slab_free(&a, q);
+  slab_free(&a, r);
+  /* Each class keeps its last page */
+  assert(number_of_used_pages == 3);
+  slab_release_empty_pages(&a);
+  assert(number_of_used_pages == 0);
+}
+
+QUIZ_CASE(liba_slab_reuse_and_stats) {
+  slab_allocator_t a;
+  init_allocator(&a);
+  void * blocks[64];
+  for (int i = 0; i < 64; i++) {
+    blocks[i] = slab_malloc(&a, 32);
+    assert(blocks[i] != NULL);
+  }
+  slab_class_stats_t stats;
+  slab_class_stats(&a, 3, &stats);
+  assert(stats.block_size == 32);
+  assert(stats.used_blocks == 64);
+  assert(stats.number_of_pages == 3);
+  assert(stats.capacity >= 64);
+  void * freed = blocks[10];
+  slab_free(&a, freed);
+  assert(slab_malloc(&a, 30) == freed);
+  for (int i = 0; i < 64; i++) {
+    slab_free(&a, blocks[i]);
+  }
+  slab_class_stats(&a, 3, &stats);
+  assert(stats.used_blocks == 0);
+  assert(stats.number_of_pages == 1);
+}
+
+QUIZ_CASE(liba_slab_out_of_pages) {
+  slab_allocator_t a;
+  init_allocator(&a);
+  int count = 0;
+  while (slab_malloc(&a, 64) != NULL) {
+    count++;
+  }
+  slab_class_stats_t stats;
+  slab_class_stats(&a, 6, &stats);
+  assert(count == stats.capacity);
+  assert(number_of_used_pages == ARENA_PAGES);
+  assert(slab_malloc(&a, 8) == NULL);
+}
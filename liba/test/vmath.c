@@ -0,0 +1,132 @@
+#include <quiz.h>
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#define N 1001
+
+/* Distance in representable numbers, across zero too */
+static int64_t ordered32(float f) {
+  int32_t i;
+  memcpy(&i, &f, sizeof(i));
+  return i < 0 ? (int64_t)INT32_MIN - i : i;
+}
+
+static int64_t ordered64(double d) {
+  int64_t i;
+  memcpy(&i, &d, sizeof(i));
+  return i < 0 ? INT64_MIN - i : i;
+}
+
+static int64_t ulps32(float a, float b) {
+  if (isnan(a) || isnan(b)) {
+    return isnan(a) && isnan(b) ? 0 : INT32_MAX;
+  }
+  int64_t d = ordered32(a) - ordered32(b);
+  return d < 0 ? -d : d;
+}
+
+static int64_t ulps64(double a, double b) {
+  if (isnan(a) || isnan(b)) {
+    return isnan(a) && isnan(b) ? 0 : INT64_MAX;
+  }
+  int64_t d = ordered64(a) - ordered64(b);
+  return d < 0 ? -d : d;
+}
+
+static float xf[N], yf[N], zf[N];
+static double xd[N], yd[N], zd[N];
+
+static void fill_float(float * x, float min, float max) {
+  for (int i = 0; i < N; i++) {
+    x[i] = min + (max - min) * i / (N - 1);
+  }
+}
+
+static void fill_double(double * x, double min, double max) {
+  for (int i = 0; i < N; i++) {
+    x[i] = min + (max - min) * i / (N - 1);
+  }
+}
+
+static void assert_float_map(void (*vf)(float *, const float *, size_t), float (*f)(float), float min, float max, int64_t max_ulps) {
+  fill_float(xf, min, max);
+  /* An odd length also goes through the padded tail */
+  vf(zf, xf, N);
+  for (int i = 0; i < N; i++) {
+    assert(ulps32(zf[i], f(xf[i])) <= max_ulps);
+  }
+}
+
+static void assert_double_map(void (*vf)(double *, const double *, size_t), double (*f)(double), double min, double max, int64_t max_ulps) {
+  fill_double(xd, min, max);
+  vf(zd, xd, N);
+  for (int i = 0; i < N; i++) {
+    assert(ulps64(zd[i], f(xd[i])) <= max_ulps);
+  }
+}
+
+QUIZ_CASE(liba_vmath_float) {
+  assert_float_map(vsinf, sinf, -10.0f, 10.0f, 2);
+  assert_float_map(vsinf, sinf, -4000.0f, 4000.0f, 2);
+  assert_float_map(vcosf, cosf, -10.0f, 10.0f, 2);
+  assert_float_map(vexpf, expf, -100.0f, 100.0f, 2);
+  assert_float_map(vexpf, expf, -1.0f, 1.0f, 2);
+  assert_float_map(vlogf, logf, -1.0f, 10.0f, 2);
+  assert_float_map(vlogf, logf, 0.9f, 1.1f, 2);
+  assert_float_map(vlogf, logf, 0.0f, 1e30f, 2);
+  fill_float(xf, 0.0f, 20.0f);
+  fill_float(yf, -30.0f, 30.0f);
+  vpowf(zf, xf, yf, N);
+  for (int i = 0; i < N; i++) {
+    assert(ulps32(zf[i], powf(xf[i], yf[i])) <= 2);
+  }
+}
+
+QUIZ_CASE(liba_vmath_double) {
+  assert_double_map(vsin, sin, -10.0, 10.0, 2);
+  assert_double_map(vsin, sin, -1e6, 1e6, 2);
+  assert_double_map(vcos, cos, -10.0, 10.0, 2);
+  assert_double_map(vexp, exp, -750.0, 750.0, 2);
+  assert_double_map(vexp, exp, -1.0, 1.0, 2);
+  assert_double_map(vlog, log, -1.0, 10.0, 2);
+  assert_double_map(vlog, log, 0.9, 1.1, 2);
+  assert_double_map(vlog, log, 0.0, 1e300, 2);
+  fill_double(xd, 0.0, 20.0);
+  fill_double(yd, -30.0, 30.0);
+  vpow(zd, xd, yd, N);
+  for (int i = 0; i < N; i++) {
+    assert(ulps64(zd[i], pow(xd[i], yd[i])) <= 2);
+  }
+  /* Large y*log(x) magnify the error of log(x) */
+  fill_double(xd, 0.5, 2.0);
+  fill_double(yd, -1000.0, 1000.0);
+  vpow(zd, xd, yd, N);
+  for (int i = 0; i < N; i++) {
+    assert(ulps64(zd[i], pow(xd[i], yd[i])) <= 16);
+  }
+}
+
+QUIZ_CASE(liba_vmath_special_values) {
+  float x[] = {0.0f, -0.0f, INFINITY, -INFINITY, NAN, 1e-40f, -1.0f, 1e30f, 89.0f, -104.0f};
+  float y[10];
+  int n = sizeof(x)/sizeof(x[0]);
+  vsinf(y, x, n);
+  for (int i = 0; i < n; i++) {
+    assert(ulps32(y[i], sinf(x[i])) == 0);
+  }
+  vexpf(y, x, n);
+  for (int i = 0; i < n; i++) {
+    assert(ulps32(y[i], expf(x[i])) == 0);
+  }
+  vlogf(y, x, n);
+  for (int i = 0; i < n; i++) {
+    assert(ulps32(y[i], logf(x[i])) == 0);
+  }
+  /* In place */
+  double d[] = {-1.0, 0.0, 2.0};
+  double e[] = {0.5, -1.0, 1100.0};
+  vpow(d, d, e, 3);
+  assert(isnan(d[0]) && isinf(d[1]) && isinf(d[2]));
+}
@@ -2,8 +2,23 @@
 
 // See the C++ standard, section 3.7.4 for those definitions
 
+/* malloc returns NULL when the heap is full, so that C callers can recover.
+ * Without exceptions, new has no way to report it and its callers assume it
+ * never returns NULL: running out of memory there is fatal. malloc(0) returns
+ * NULL too, but new must return a unique pointer even for zero bytes. */
+static inline void * allocate(size_t size) {
+  void * p = malloc(size ? size : 1);
+  if (p == NULL) {
+    abort();
+  }
+  return p;
+}
+
 void * operator new(size_t size) {
-  return malloc(size);
+#if LIBA_HEAP_TRACE
+  malloc_set_trace_site(__builtin_return_address(0));
+#endif
+  return allocate(size);
 }
 
 void operator delete(void * ptr) noexcept {
@@ -11,7 +26,13 @@ void operator delete(void * ptr) noexcept {
 }
 
 void * operator new[](size_t size) {
+#if LIBA_HEAP_TRACE
+  /* Skip operator new so that the caller of new[] is recorded */
+  malloc_set_trace_site(__builtin_return_address(0));
+  return allocate(size);
+#else
     return ::operator new(size);
+#endif
 }
 
 void operator delete[](void * ptr) noexcept {
@@ -10,6 +10,7 @@
 #include <poincare/arc_tangent.h>
 #include <poincare/binomial_coefficient.h>
 #include <poincare/ceiling.h>
+#include <poincare/compiled_expression.h>
 #include <poincare/complex.h>
 #include <poincare/complex_argument.h>
 #include <poincare/complex_matrix.h>
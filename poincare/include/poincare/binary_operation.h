@@ -22,6 +22,7 @@ public:
   int numberOfOperands() const override;
   Expression * clone() const override;
 protected:
+  void replaceOperand(int i, Expression * newOperand) override;
   Expression * m_operands[2];
   virtual Evaluation<float> * privateEvaluate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<float>(context, angleUnit); }
   virtual Evaluation<double> * privateEvaluate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<double>(context, angleUnit); }
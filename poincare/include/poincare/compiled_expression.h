@@ -0,0 +1,76 @@
+#ifndef POINCARE_COMPILED_EXPRESSION_H
+#define POINCARE_COMPILED_EXPRESSION_H
+
+#include <poincare/expression.h>
+#include <poincare/context.h>
+#include <poincare/complex.h>
+#include <stddef.h>
+
+namespace Poincare {
+
+class Function;
+
+/* A CompiledExpression approximates an expression at many values of one of
+ * its symbols, as a plot or a batch evaluation does. Built with POINCARE_JIT=1
+ * on an x86-64 host, the expression is compiled to SSE2 machine code, once per
+ * precision: the arithmetic is inlined, the other real functions are called
+ * through their Poincare implementation and the subtrees that don't depend on
+ * the symbol are approximated once. Nodes that can't be compiled are
+ * approximated by the interpreter from the compiled code.
+ *
+ * The compiled code works on real numbers. Whenever its result isn't finite,
+ * which a non real intermediate result makes it, the whole expression is
+ * approximated again by the interpreter, so that both always agree.
+ * Elsewhere, or if the expression can't be compiled, approximate simply runs
+ * the interpreter.
+ *
+ * The expression and the context must outlive the CompiledExpression. The
+ * other symbols are looked up in the context, and the angle unit is read from
+ * the preferences, once when compiling. */
+
+class CompiledExpression {
+public:
+  CompiledExpression(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit = Expression::AngleUnit::Default);
+  ~CompiledExpression();
+  CompiledExpression(const CompiledExpression& other) = delete;
+  CompiledExpression(CompiledExpression&& other) = delete;
+  CompiledExpression& operator=(const CompiledExpression& other) = delete;
+  CompiledExpression& operator=(CompiledExpression&& other) = delete;
+  bool isCompiled() const { return m_memory != nullptr; }
+  template<typename T> T approximate(T x);
+private:
+  /* Unlike VariableContext, setting the value of the symbol doesn't evaluate
+   * anything, which saves an allocation per approximation. */
+  class SymbolContext : public Context {
+  public:
+    SymbolContext(char symbol, Context * parentContext);
+    void setValue(double x) { m_value = Complex<double>::Float(x); }
+    const Expression * expressionForSymbol(const Symbol * symbol) override;
+    void setExpressionForSymbolName(Expression * expression, const Symbol * symbol) override;
+  private:
+    char m_symbol;
+    Complex<double> m_value;
+    Context * m_parentContext;
+  };
+  class Assembler;
+  template<typename T> bool generate(Assembler * assembler);
+  template<typename T> bool compile(Assembler * assembler, const Expression * e, int depth);
+  bool dependsOnSymbol(const Expression * e) const;
+  double run(double x) { return m_doubleCode(x, this); }
+  float run(float x) { return m_floatCode(x, this); }
+  template<typename T> static T computeFunction(const Function * function, T x, int angleUnit);
+  template<typename T> static T computePower(T x, T y);
+  template<typename T> static T interpret(CompiledExpression * compiledExpression, const Expression * e, T x);
+  const Expression * m_expression;
+  char m_symbol;
+  Expression::AngleUnit m_angleUnit;
+  SymbolContext m_context;
+  void * m_memory;
+  size_t m_memorySize;
+  double (*m_doubleCode)(double x, CompiledExpression * compiledExpression);
+  float (*m_floatCode)(float x, CompiledExpression * compiledExpression);
+};
+
+}
+
+#endif
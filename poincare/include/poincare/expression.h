@@ -139,10 +139,15 @@ public:
   template<typename T> static T approximate(const char * text, Context& context, AngleUnit angleUnit = AngleUnit::Default);
   virtual int writeTextInBuffer(char * buffer, int bufferSize) const;
 protected:
+  Expression() : m_isSimplified(false) {}
   typedef float SinglePrecision;
   typedef double DoublePrecision;
   template<typename T> static T epsilon();
 private:
+  friend class Simplifier;
+  /* Only the simplifier, which owns the expressions it rewrites, replaces
+   * operands. The former operand isn't deleted. */
+  virtual void replaceOperand(int i, Expression * newOperand);
   virtual ExpressionLayout * privateCreateLayout(FloatDisplayMode floatDisplayMode, ComplexFormat complexFormat) const = 0;
   virtual Evaluation<float> * privateEvaluate(SinglePrecision p, Context& context, AngleUnit angleUnit) const = 0;
   virtual Evaluation<double> * privateEvaluate(DoublePrecision p, Context& context, AngleUnit angleUnit) const = 0;
@@ -150,6 +155,9 @@ private:
   bool commutativeOperandsIdentity(const Expression * e) const;
   bool combinatoryCommutativeOperandsIdentity(const Expression * e,
       bool * operandMatched, int leftToMatch) const;
+  /* Set by the simplifier once no simplification applies to the expression
+   * nor to its operands. */
+  bool m_isSimplified;
 };
 
 }
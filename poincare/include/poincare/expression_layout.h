@@ -24,9 +24,11 @@ protected:
 private:
   KDPoint absoluteOrigin();
   //void computeLayout();//ExpressionLayout * parent, uint16_t childIndex);
-  ExpressionLayout* m_parent;
-  bool m_sized, m_positioned;
+  /* m_frame follows m_baseline so that the two-byte fields are packed
+   * together before the pointer. */
   KDRect m_frame;
+  bool m_sized, m_positioned;
+  ExpressionLayout* m_parent;
 };
 
 }
@@ -23,6 +23,7 @@ public:
   Expression * cloneWithDifferentOperands(Expression** newOperands,
     int numberOfOperands, bool cloneOperands = true) const override;
 private:
+  void replaceOperand(int i, Expression * newOperand) override;
   Evaluation<float> * privateEvaluate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<float>(context, angleUnit); }
   Evaluation<double> * privateEvaluate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<double>(context, angleUnit); }
  template<typename T> Evaluation<T> * templatedEvaluate(Context& context, AngleUnit angleUnit) const;
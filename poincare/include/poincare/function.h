@@ -27,6 +27,8 @@ public:
   int numberOfOperands() const override;
   Expression * clone() const override;
 protected:
+  // The compiled expressions call computeComplex on real numbers
+  friend class CompiledExpression;
   virtual Complex<float> computeComplex(const Complex<float> c, AngleUnit angleUnit) const {
     return Complex<float>::Float(NAN);
   }
@@ -37,6 +39,7 @@ protected:
   virtual Evaluation<double> * privateEvaluate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<double>(context, angleUnit); }
  template<typename T> Evaluation<T> * templatedEvaluate(Context& context, AngleUnit angleUnit) const;
   ExpressionLayout * privateCreateLayout(FloatDisplayMode floatDisplayMode, ComplexFormat complexFormat) const override;
+  void replaceOperand(int i, Expression * newOperand) override;
   void build(Expression ** args, int numberOfArguments, bool clone);
   void clean();
   Expression ** m_args;
@@ -32,6 +32,7 @@ public:
   bool operator==(const Integer &other) const;
 
   bool valueEquals(const Expression * e) const override;
+  uint32_t hash() const; // Equal integers have equal hashes
 
   Expression * clone() const override;
 private:
@@ -11,6 +11,9 @@ public:
   Type type() const override;
   Expression * cloneWithDifferentOperands(Expression** newOperands,
       int numnerOfOperands, bool cloneOperands = true) const override;
+  /* The product of two matrices doesn't commute: a multiplication is only
+   * commutative if at most one of its operands may be a matrix. */
+  bool isCommutative() const override;
   template<typename T> static Evaluation<T> * computeOnMatrices(Evaluation<T> * m, Evaluation<T> * n);
   template<typename T> static Evaluation<T> * computeOnComplexAndMatrix(const Complex<T> * c, Evaluation<T> * m);
   template<typename T> static Complex<T> compute(const Complex<T> c, const Complex<T> d);
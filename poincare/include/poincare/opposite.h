@@ -24,6 +24,7 @@ public:
   template<typename T> static Complex<T> compute(const Complex<T> c);
   template<typename T> static Evaluation<T> * computeOnMatrix(Evaluation<T> * m);
 private:
+  void replaceOperand(int i, Expression * newOperand) override;
   Evaluation<float> * privateEvaluate(SinglePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<float>(context, angleUnit); }
   Evaluation<double> * privateEvaluate(DoublePrecision p, Context& context, AngleUnit angleUnit) const override { return templatedEvaluate<double>(context, angleUnit); }
  template<typename T> Evaluation<T> * templatedEvaluate(Context& context, AngleUnit angleUnit) const;
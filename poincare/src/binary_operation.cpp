@@ -50,6 +50,12 @@ const Expression * BinaryOperation::operand(int i) const {
   return m_operands[i];
 }
 
+void BinaryOperation::replaceOperand(int i, Expression * newOperand) {
+  assert(i >= 0);
+  assert(i < 2);
+  m_operands[i] = newOperand;
+}
+
 Expression * BinaryOperation::clone() const {
   return this->cloneWithDifferentOperands((Expression**) m_operands, 2, true);
 }
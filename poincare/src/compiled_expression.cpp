@@ -0,0 +1,417 @@
+#include <poincare/compiled_expression.h>
+#include <poincare/function.h>
+#include <poincare/power.h>
+#include <poincare/preferences.h>
+#include <poincare/symbol.h>
+extern "C" {
+#include <assert.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+}
+
+#if POINCARE_JIT && defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+#define POINCARE_JIT_X86_64 1
+#include <sys/mman.h>
+#include <unistd.h>
+#else
+#define POINCARE_JIT_X86_64 0
+#endif
+
+namespace Poincare {
+
+CompiledExpression::SymbolContext::SymbolContext(char symbol, Context * parentContext) :
+  m_symbol(symbol),
+  m_value(Complex<double>::Float(NAN)),
+  m_parentContext(parentContext)
+{
+}
+
+const Expression * CompiledExpression::SymbolContext::expressionForSymbol(const Symbol * symbol) {
+  return symbol->name() == m_symbol ? &m_value : m_parentContext->expressionForSymbol(symbol);
+}
+
+void CompiledExpression::SymbolContext::setExpressionForSymbolName(Expression * expression, const Symbol * symbol) {
+  m_parentContext->setExpressionForSymbolName(expression, symbol);
+}
+
+#if POINCARE_JIT_X86_64
+
+/* The Assembler writes the code of a function
+ *   T f(T x, CompiledExpression * compiledExpression)
+ * following the System V calling convention, in single or double precision.
+ * Its buffer starts with a pool of
+ * the constants, which the code reads relatively to the instruction pointer,
+ * so that the code can be copied anywhere. The frame holds x and one
+ * intermediate result per nested binary operation, which have to survive the
+ * calls. */
+
+class CompiledExpression::Assembler {
+public:
+  constexpr static int k_maxNumberOfConstants = 32;
+  constexpr static int k_constantsSize = k_maxNumberOfConstants*sizeof(double);
+  constexpr static int k_maxDepth = 32;
+  enum class Operation : uint8_t {
+    Add = 0x58,
+    Multiply = 0x59,
+    Subtract = 0x5C,
+    Divide = 0x5E
+  };
+  Assembler(bool singlePrecision) :
+    m_length(k_constantsSize),
+    m_numberOfConstants(0),
+    m_singlePrecision(singlePrecision),
+    m_overflow(false)
+  {
+  }
+  const uint8_t * buffer() const { return m_buffer; }
+  int length() const { return m_length; }
+  bool hasOverflowed() const { return m_overflow; }
+  void prologue() {
+    emit(0x55); // push rbp
+    emit(0x48); emit(0x89); emit(0xE5); // mov rbp, rsp
+    emit(0x53); // push rbx
+    emit(0x48); emit(0x81); emit(0xEC); emit32(k_frameSize); // sub rsp, frameSize
+    emit(0x48); emit(0x89); emit(0xFB); // mov rbx, rdi
+    storeInFrame(k_abscissaOffset, 0);
+  }
+  void epilogue() {
+    emit(0x48); emit(0x8B); emit(0x5D); emit(0xF8); // mov rbx, [rbp-8]
+    emit(0xC9); // leave
+    emit(0xC3); // ret
+  }
+  void loadAbscissa(int xmm) {
+    loadFromFrame(xmm, k_abscissaOffset);
+  }
+  void loadIntermediate(int xmm, int depth) {
+    assert(depth < k_maxDepth);
+    loadFromFrame(xmm, intermediateOffset(depth));
+  }
+  void storeIntermediate(int depth, int xmm) {
+    assert(depth < k_maxDepth);
+    storeInFrame(intermediateOffset(depth), xmm);
+  }
+  void loadConstant(int xmm, double value) {
+    // Each constant takes 8 bytes, of which a float uses the first 4
+    float singlePrecisionValue = value;
+    const void * bytes = m_singlePrecision ? (const void *)&singlePrecisionValue : (const void *)&value;
+    size_t size = m_singlePrecision ? sizeof(float) : sizeof(double);
+    int index = 0;
+    while (index < m_numberOfConstants && memcmp(m_buffer + index*sizeof(double), bytes, size) != 0) {
+      index++;
+    }
+    if (index == k_maxNumberOfConstants) {
+      m_overflow = true;
+      return;
+    }
+    if (index == m_numberOfConstants) {
+      memcpy(m_buffer + index*sizeof(double), bytes, size);
+      m_numberOfConstants++;
+    }
+    // movss or movsd xmm, [rip+disp32]
+    emitScalarPrefix(); emit(0x0F); emit(0x10); emit(xmm << 3 | 5);
+    emit32(index*sizeof(double) - (m_length + 4));
+  }
+  void compute(Operation operation, int destination, int source) {
+    emitScalarPrefix(); emit(0x0F); emit((uint8_t)operation); emit(0xC0 | destination << 3 | source);
+  }
+  void move(int destination, int source) {
+    // movapd destination, source
+    emit(0x66); emit(0x0F); emit(0x28); emit(0xC0 | destination << 3 | source);
+  }
+  void setFirstArgument(const void * pointer) {
+    emit(0x48); emit(0xBF); emit64((uintptr_t)pointer); // mov rdi, imm64
+  }
+  void setFirstArgumentToCompiledExpression() {
+    emit(0x48); emit(0x89); emit(0xDF); // mov rdi, rbx
+  }
+  void setSecondArgument(const void * pointer) {
+    emit(0x48); emit(0xBE); emit64((uintptr_t)pointer); // mov rsi, imm64
+  }
+  void setSecondArgument(int32_t value) {
+    emit(0xBE); emit32(value); // mov esi, imm32
+  }
+  void call(const void * function) {
+    emit(0x48); emit(0xB8); emit64((uintptr_t)function); // mov rax, imm64
+    emit(0xFF); emit(0xD0); // call rax
+  }
+private:
+  constexpr static int k_bufferSize = 4096;
+  /* rbx is saved at [rbp-8], x at [rbp-16] and the intermediate results
+   * below. The frame keeps rsp 16-byte aligned at the calls. */
+  constexpr static int k_abscissaOffset = -16;
+  constexpr static int k_frameSize = 8 + k_maxDepth*sizeof(double);
+  static_assert(k_frameSize % 16 == 8, "The frame must keep the stack aligned");
+  static int intermediateOffset(int depth) { return k_abscissaOffset - 8*(depth + 1); }
+  void loadFromFrame(int xmm, int offset) {
+    // movss or movsd xmm, [rbp+disp32]
+    emitScalarPrefix(); emit(0x0F); emit(0x10); emit(0x80 | xmm << 3 | 5); emit32(offset);
+  }
+  void storeInFrame(int offset, int xmm) {
+    // movss or movsd [rbp+disp32], xmm
+    emitScalarPrefix(); emit(0x0F); emit(0x11); emit(0x80 | xmm << 3 | 5); emit32(offset);
+  }
+  void emitScalarPrefix() {
+    emit(m_singlePrecision ? 0xF3 : 0xF2);
+  }
+  void emit(uint8_t byte) {
+    if (m_length == k_bufferSize) {
+      m_overflow = true;
+      return;
+    }
+    m_buffer[m_length++] = byte;
+  }
+  void emit32(uint32_t value) {
+    for (int i = 0; i < 4; i++) {
+      emit(value >> (8*i));
+    }
+  }
+  void emit64(uint64_t value) {
+    emit32(value);
+    emit32(value >> 32);
+  }
+  uint8_t m_buffer[k_bufferSize];
+  int m_length;
+  int m_numberOfConstants;
+  bool m_singlePrecision;
+  bool m_overflow;
+};
+
+#endif
+
+CompiledExpression::CompiledExpression(const Expression * expression, char symbol, Context & context, Expression::AngleUnit angleUnit) :
+  m_expression(expression),
+  m_symbol(symbol),
+  m_angleUnit(angleUnit == Expression::AngleUnit::Default ? Preferences::sharedPreferences()->angleUnit() : angleUnit),
+  m_context(symbol, &context),
+  m_memory(nullptr),
+  m_memorySize(0),
+  m_doubleCode(nullptr),
+  m_floatCode(nullptr)
+{
+#if POINCARE_JIT_X86_64
+  Assembler doubleAssembler(false);
+  Assembler floatAssembler(true);
+  if (!generate<double>(&doubleAssembler) || !generate<float>(&floatAssembler)) {
+    return;
+  }
+  // Both functions share the memory, the single precision one second
+  size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t size = (doubleAssembler.length() + floatAssembler.length() + pageSize - 1)/pageSize*pageSize;
+  void * memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (memory == MAP_FAILED) {
+    return;
+  }
+  uint8_t * floatMemory = (uint8_t *)memory + doubleAssembler.length();
+  memcpy(memory, doubleAssembler.buffer(), doubleAssembler.length());
+  memcpy(floatMemory, floatAssembler.buffer(), floatAssembler.length());
+  if (mprotect(memory, size, PROT_READ | PROT_EXEC) != 0) {
+    munmap(memory, size);
+    return;
+  }
+  m_memory = memory;
+  m_memorySize = size;
+  m_doubleCode = (double (*)(double, CompiledExpression *))((uint8_t *)memory + Assembler::k_constantsSize);
+  m_floatCode = (float (*)(float, CompiledExpression *))(floatMemory + Assembler::k_constantsSize);
+#endif
+}
+
+CompiledExpression::~CompiledExpression() {
+#if POINCARE_JIT_X86_64
+  if (m_memory != nullptr) {
+    munmap(m_memory, m_memorySize);
+  }
+#endif
+}
+
+template<typename T>
+T CompiledExpression::approximate(T x) {
+  if (isCompiled()) {
+    T result = run(x);
+    if (!isnan(result) && !isinf(result)) {
+      return result;
+    }
+  }
+  m_context.setValue(x);
+  return m_expression->approximate<T>(m_context, m_angleUnit);
+}
+
+#if POINCARE_JIT_X86_64
+
+template<typename T>
+bool CompiledExpression::generate(Assembler * assembler) {
+  assembler->prologue();
+  if (!compile<T>(assembler, m_expression, 0)) {
+    return false;
+  }
+  assembler->epilogue();
+  return !assembler->hasOverflowed();
+}
+
+template<typename T>
+bool CompiledExpression::compile(Assembler * assembler, const Expression * e, int depth) {
+  if (depth >= Assembler::k_maxDepth) {
+    return false;
+  }
+  if (!dependsOnSymbol(e)) {
+    // Constant subtrees which aren't real numbers aren't compiled
+    T value = e->approximate<T>(m_context, m_angleUnit);
+    if (isnan(value)) {
+      return false;
+    }
+    assembler->loadConstant(0, value);
+    return true;
+  }
+  switch (e->type()) {
+    case Expression::Type::Symbol:
+      assembler->loadAbscissa(0);
+      return true;
+    case Expression::Type::Parenthesis:
+      return compile<T>(assembler, e->operand(0), depth);
+    case Expression::Type::Opposite:
+      if (!compile<T>(assembler, e->operand(0), depth)) {
+        return false;
+      }
+      assembler->loadConstant(1, -1.0);
+      assembler->compute(Assembler::Operation::Multiply, 0, 1);
+      return true;
+    case Expression::Type::Addition:
+    case Expression::Type::Subtraction:
+    case Expression::Type::Multiplication:
+    case Expression::Type::Fraction:
+    case Expression::Type::Power:
+    {
+      if (!compile<T>(assembler, e->operand(0), depth)) {
+        return false;
+      }
+      assembler->storeIntermediate(depth, 0);
+      if (!compile<T>(assembler, e->operand(1), depth+1)) {
+        return false;
+      }
+      assembler->move(1, 0);
+      assembler->loadIntermediate(0, depth);
+      switch (e->type()) {
+        case Expression::Type::Addition:
+          assembler->compute(Assembler::Operation::Add, 0, 1);
+          return true;
+        case Expression::Type::Subtraction:
+          assembler->compute(Assembler::Operation::Subtract, 0, 1);
+          return true;
+        case Expression::Type::Multiplication:
+          /* The interpreter multiplies complexes, whose imaginary part
+           * x*0+0*y is NaN when a factor is infinite. (x-x)+(y-y) is NaN in
+           * the same cases and 0 otherwise, and subtracting it keeps the sign
+           * of a zero product. */
+          assembler->move(2, 0);
+          assembler->compute(Assembler::Operation::Multiply, 2, 1);
+          assembler->compute(Assembler::Operation::Subtract, 0, 0);
+          assembler->compute(Assembler::Operation::Subtract, 1, 1);
+          assembler->compute(Assembler::Operation::Add, 0, 1);
+          assembler->compute(Assembler::Operation::Subtract, 2, 0);
+          assembler->move(0, 2);
+          return true;
+        case Expression::Type::Fraction:
+          assembler->compute(Assembler::Operation::Divide, 0, 1);
+          return true;
+        default:
+          assert(e->type() == Expression::Type::Power);
+          assembler->call((const void *)computePower<T>);
+          return true;
+      }
+    }
+    // The functions which only compute their complex on their argument
+    case Expression::Type::AbsoluteValue:
+    case Expression::Type::ArcCosine:
+    case Expression::Type::ArcSine:
+    case Expression::Type::ArcTangent:
+    case Expression::Type::Ceiling:
+    case Expression::Type::ComplexArgument:
+    case Expression::Type::Conjugate:
+    case Expression::Type::Cosine:
+    case Expression::Type::Factorial:
+    case Expression::Type::Floor:
+    case Expression::Type::FracPart:
+    case Expression::Type::HyperbolicArcCosine:
+    case Expression::Type::HyperbolicArcSine:
+    case Expression::Type::HyperbolicArcTangent:
+    case Expression::Type::HyperbolicCosine:
+    case Expression::Type::HyperbolicSine:
+    case Expression::Type::HyperbolicTangent:
+    case Expression::Type::ImaginaryPart:
+    case Expression::Type::NaperianLogarithm:
+    case Expression::Type::ReelPart:
+    case Expression::Type::Sine:
+    case Expression::Type::SquareRoot:
+    case Expression::Type::Tangent:
+      if (e->numberOfOperands() == 1) {
+        if (!compile<T>(assembler, e->operand(0), depth)) {
+          return false;
+        }
+        assembler->setFirstArgument(static_cast<const Function *>(e));
+        assembler->setSecondArgument((int32_t)m_angleUnit);
+        assembler->call((const void *)computeFunction<T>);
+        return true;
+      }
+      break;
+    default:
+      break;
+  }
+  // The other nodes are approximated by the interpreter
+  assembler->loadAbscissa(0);
+  assembler->setFirstArgumentToCompiledExpression();
+  assembler->setSecondArgument(e);
+  assembler->call((const void *)interpret<T>);
+  return true;
+}
+
+#endif
+
+bool CompiledExpression::dependsOnSymbol(const Expression * e) const {
+  // Evaluations hold numbers, and a complex is its own operand
+  if (e->type() == Expression::Type::Complex || e->type() == Expression::Type::Evaluation) {
+    return false;
+  }
+  /* A store changes the context at each approximation, as if it depended on
+   * the symbol. */
+  if (e->type() == Expression::Type::Store || (e->type() == Expression::Type::Symbol && static_cast<const Symbol *>(e)->name() == m_symbol)) {
+    return true;
+  }
+  for (int i = 0; i < e->numberOfOperands(); i++) {
+    if (dependsOnSymbol(e->operand(i))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/* The helpers called by the compiled code return NaN for non real results,
+ * and for non real arguments, which the compiled code represents by NaN. */
+
+template<typename T>
+T CompiledExpression::computeFunction(const Function * function, T x, int angleUnit) {
+  if (isnan(x)) {
+    return NAN;
+  }
+  Complex<T> result = function->computeComplex(Complex<T>::Float(x), (Expression::AngleUnit)angleUnit);
+  return result.b() == 0 ? result.a() : NAN;
+}
+
+template<typename T>
+T CompiledExpression::computePower(T x, T y) {
+  if (isnan(x) || isnan(y)) {
+    return NAN;
+  }
+  Complex<T> result = Power::compute(Complex<T>::Float(x), Complex<T>::Float(y));
+  return result.b() == 0 ? result.a() : NAN;
+}
+
+template<typename T>
+T CompiledExpression::interpret(CompiledExpression * compiledExpression, const Expression * e, T x) {
+  compiledExpression->m_context.setValue(x);
+  return e->approximate<T>(compiledExpression->m_context, compiledExpression->m_angleUnit);
+}
+
+template float CompiledExpression::approximate<float>(float x);
+template double CompiledExpression::approximate<double>(double x);
+
+}
@@ -5,6 +5,7 @@
 #include <poincare/list_data.h>
 #include <poincare/matrix_data.h>
 #include <poincare/evaluation.h>
+#include <ion/trace.h>
 #include <cmath>
 #include "expression_parser.hpp"
 #include "expression_lexer.hpp"
@@ -12,7 +13,7 @@ extern "C" {
 #include <assert.h>
 }
 
-#include "simplify/rules.h"
+#include "simplify/simplifier.h"
 
 int poincare_expression_yyparse(Poincare::Expression ** expressionOutput);
 
@@ -26,6 +27,7 @@ Expression * Expression::parse(char const * string) {
   if (string[0] == 0) {
     return nullptr;
   }
+  ION_TRACE_SCOPE("parse");
   YY_BUFFER_STATE buf = poincare_expression_yy_scan_string(string);
   Expression * expression = 0;
   if (poincare_expression_yyparse(&expression) != 0) {
@@ -60,6 +62,7 @@ ExpressionLayout * Expression::createLayout(FloatDisplayMode floatDisplayMode, C
 }
 
 template<typename T> Evaluation<T> * Expression::evaluate(Context& context, AngleUnit angleUnit) const {
+  ION_TRACE_SCOPE("evaluate");
   switch (angleUnit) {
     case AngleUnit::Default:
       return privateEvaluate(T(), context, Preferences::sharedPreferences()->angleUnit());
@@ -93,51 +96,12 @@ template<typename T> T Expression::epsilon() {
 }
 
 Expression * Expression::simplify() const {
+  ION_TRACE_SCOPE("simplify");
   /* We make sure that the simplification is deletable.
    * Indeed, we don't want an expression with some parts deletable and some not
    */
-
-  // If we have a leaf node nothing can be simplified.
-  if (this->numberOfOperands()==0) {
-    return this->clone();
-  }
-
-  Expression * result = this->clone();
-  Expression * tmp = nullptr;
-
-  bool simplification_pass_was_useful = true;
-  while (simplification_pass_was_useful) {
-    /* We recursively simplify the children expressions.
-     * Note that we are sure to get the samne number of children as we had before
-     */
-    Expression ** simplifiedOperands = new Expression * [result->numberOfOperands()];
-    for (int i = 0; i < result->numberOfOperands(); i++) {
-      simplifiedOperands[i] = result->operand(i)->simplify();
-    }
-
-    /* Note that we don't need to clone the simplified children because they are
-     * already cloned before. */
-    tmp = result->cloneWithDifferentOperands(simplifiedOperands, result->numberOfOperands(), false);
-    delete result;
-    result = tmp;
-
-    // The table is no longer needed.
-    delete [] simplifiedOperands;
-
-    simplification_pass_was_useful = false;
-    for (int i=0; i<knumberOfSimplifications; i++) {
-      const Simplification * simplification = (simplifications + i); // Pointer arithmetics
-      Expression * simplified = simplification->simplify(result);
-      if (simplified != nullptr) {
-        simplification_pass_was_useful = true;
-        delete result;
-        result = simplified;
-        break;
-      }
-    }
-  }
-
-  return result;
+  Simplifier simplifier;
+  return simplifier.simplify(this->clone());
 }
 
 bool Expression::sequentialOperandsIdentity(const Expression * e) const {
@@ -203,7 +167,10 @@ bool Expression::isIdenticalTo(const Expression * e) const {
   if (e->type() != this->type() || e->numberOfOperands() != this->numberOfOperands()) {
     return false;
   }
-  if (this->isCommutative()) {
+  /* The simplifier sorts the operands of the commutative expressions it
+   * marks, which can thus be compared in order. */
+  bool areSimplified = m_isSimplified && e->m_isSimplified;
+  if (!areSimplified && this->isCommutative()) {
     if (!this->commutativeOperandsIdentity(e)) {
       return false;
     }
@@ -236,6 +203,11 @@ bool Expression::isCommutative() const {
   return false;
 }
 
+void Expression::replaceOperand(int i, Expression * newOperand) {
+  // Expressions without operands have none to replace
+  assert(false);
+}
+
 int Expression::writeTextInBuffer(char * buffer, int bufferSize) const {
   return 0;
 }
@@ -0,0 +1,237 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#define yytext poincare_expression_yytext
+#define yyleng poincare_expression_yyleng
+#define yylex poincare_expression_yylex
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+char * poincare_expression_yytext = 0; int poincare_expression_yyleng = 0;
+
+/* Flex generate a lexer, a function that outputs tokens.
+ * Those tokens (and the optional value that they can be attached) are defined
+ * in the Bison grammar. To use those token definitions, we need to include the
+ * header generated by Bison.
+ * Also, since some tokens can have an "Expression *" value attached, we'll
+ * need "Expression" to be defined before including that header.
+ * We could use the '%code requires{}' directive to make sure that Expression is
+ * well defined in the parser header, but this directive only comes in bison 3,
+ * which is not installed by default on MacOS, we thus made the choice to prefer
+ * compatibility with MacOS's default version (2.3) instead of using the code
+ * requires feature. */
+#include <math.h>
+#include <poincare.h>
+#include "expression_parser.hpp"
+using namespace Poincare;
+
+/* Flex has provision for reading files. We'll never use this, so we're defining
+ * YY_INPUT which effectively disables taking input from a file. */
+#define YY_INPUT
+
+/* Flex can print to stdout what token it matches by calling the ECHO function.
+ * We don't want that feature : we don't even have printf ! */
+#define ECHO
+
+/* This defines the size of the flex buffer size.
+ * By default this buffer is of 16k, but we don't have the luxury to use so much
+ * memory on a microcontroller.
+ * The choice of 256 Bytes is the size of the input buffer given to flex in the
+ * current implementation (the app takes a maximum of 256).
+ */
+#undef YY_BUF_SIZE
+#define YY_BUF_SIZE 256
+
+#define fprintf(...) ((void)0)
+#define exit(...) abort()
+
+
+struct yy_buffer_state { char * base; int pos; int len; int holdPos; char hold; };
+static YY_BUFFER_STATE yy_current = 0;
+YY_BUFFER_STATE poincare_expression_yy_scan_string(const char * s) {
+  YY_BUFFER_STATE b = (YY_BUFFER_STATE)malloc(sizeof(struct yy_buffer_state));
+  b->len = strlen(s); b->base = (char *)malloc(b->len + 2); memcpy(b->base, s, b->len + 1); b->base[b->len+1] = 0;
+  b->pos = 0; b->holdPos = -1; b->hold = 0; yy_current = b; return b;
+}
+void poincare_expression_yy_delete_buffer(YY_BUFFER_STATE b) { if (b == 0) return; if (yy_current == b) yy_current = 0; free(b->base); free(b); }
+struct yy_atom { unsigned char set[32]; int min; int max; };
+static int yy_match(const struct yy_atom * atoms, int n, const unsigned char * s, int len) {
+  if (n == 0) return 0;
+  int k = 0;
+  while (k < len && (atoms[0].max < 0 || k < atoms[0].max) && (atoms[0].set[s[k]>>3] & (1<<(s[k]&7)))) k++;
+  for (; k >= atoms[0].min; k--) { int r = yy_match(atoms+1, n-1, s+k, len-k); if (r >= 0) return k + r; }
+  return -1;
+}
+static const struct yy_atom yy_rule_0[] = {{{0,0,0,0,0,0,255,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, -1},};
+static const struct yy_atom yy_rule_1[] = {{{0,0,0,0,0,0,0,0,254,255,255,7,0,64,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_2[] = {{{0,0,0,0,4,0,0,252,0,0,0,128,254,255,255,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_3[] = {{{0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,255,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_4[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_5[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_6[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_7[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_8[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_9[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_10[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_11[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_12[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_13[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_14[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_15[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_16[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_17[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_18[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_19[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_20[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_21[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_22[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_23[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_24[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_25[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_26[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_27[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_28[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_29[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_30[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_31[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_32[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_33[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_34[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_35[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_36[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_37[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_38[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_39[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_40[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_41[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_42[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_43[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_44[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_45[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_46[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_47[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_48[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_49[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_50[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_51[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_52[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_53[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_54[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_55[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_56[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_57[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_58[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_59[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_60[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_61[] = {{{0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_62[] = {{{0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_63[] = {{{0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_64[] = {{{0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_65[] = {{{0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_66[] = {{{0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_67[] = {{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_68[] = {{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_69[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_70[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_71[] = {{{0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_72[] = {{{0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_73[] = {{{0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_74[] = {{{0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom * const yy_rules[] = {yy_rule_0,yy_rule_1,yy_rule_2,yy_rule_3,yy_rule_4,yy_rule_5,yy_rule_6,yy_rule_7,yy_rule_8,yy_rule_9,yy_rule_10,yy_rule_11,yy_rule_12,yy_rule_13,yy_rule_14,yy_rule_15,yy_rule_16,yy_rule_17,yy_rule_18,yy_rule_19,yy_rule_20,yy_rule_21,yy_rule_22,yy_rule_23,yy_rule_24,yy_rule_25,yy_rule_26,yy_rule_27,yy_rule_28,yy_rule_29,yy_rule_30,yy_rule_31,yy_rule_32,yy_rule_33,yy_rule_34,yy_rule_35,yy_rule_36,yy_rule_37,yy_rule_38,yy_rule_39,yy_rule_40,yy_rule_41,yy_rule_42,yy_rule_43,yy_rule_44,yy_rule_45,yy_rule_46,yy_rule_47,yy_rule_48,yy_rule_49,yy_rule_50,yy_rule_51,yy_rule_52,yy_rule_53,yy_rule_54,yy_rule_55,yy_rule_56,yy_rule_57,yy_rule_58,yy_rule_59,yy_rule_60,yy_rule_61,yy_rule_62,yy_rule_63,yy_rule_64,yy_rule_65,yy_rule_66,yy_rule_67,yy_rule_68,yy_rule_69,yy_rule_70,yy_rule_71,yy_rule_72,yy_rule_73,yy_rule_74};
+static const int yy_rule_sizes[] = {1,1,1,2,4,6,4,6,4,6,4,5,3,3,3,4,5,4,5,8,4,10,4,3,3,4,3,4,5,4,3,2,3,7,3,2,3,7,12,10,7,3,2,3,4,5,3,4,3,3,4,5,9,5,3,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1};
+
+int yylex(void) {
+  if (yy_current == 0) {
+    size_t cap = 1024, n = 0; char * buf = (char *)malloc(cap); int c;
+    while ((c = getchar()) != EOF) { if (n + 2 >= cap) { cap *= 2; buf = (char *)realloc(buf, cap); } buf[n++] = (char)c; }
+    buf[n] = 0; poincare_expression_yy_scan_string(buf); free(buf);
+  }
+  YY_BUFFER_STATE b = yy_current;
+  for (;;) {
+    if (b->holdPos >= 0) { b->base[b->holdPos] = b->hold; b->holdPos = -1; }
+    if (b->pos >= b->len) return 0;
+    int best = -1, bestLen = 0;
+    for (int r = 0; r < 75; r++) {
+      int l = yy_match(yy_rules[r], yy_rule_sizes[r], (const unsigned char *)b->base + b->pos, b->len - b->pos);
+      if (l > bestLen) { best = r; bestLen = l; }
+    }
+    if (best < 0) { b->pos++; continue; }
+    yytext = b->base + b->pos; yyleng = bestLen;
+    b->pos += bestLen; b->holdPos = b->pos; b->hold = b->base[b->pos]; b->base[b->pos] = 0;
+    switch (best) {
+      case 0: { poincare_expression_yylval.string.address = yytext; poincare_expression_yylval.string.length = yyleng; return DIGITS; } break;
+      case 1: { poincare_expression_yylval.character = yytext[0]; return SYMBOL; } break;
+      case 2: { return UNDEFINED_SYMBOL; } break;
+      case 3: { poincare_expression_yylval.character = Symbol::matrixSymbol(yytext[1]); return SYMBOL; } break;
+      case 4: { poincare_expression_yylval.character = Symbol::SpecialSymbols::un; return SYMBOL; } break;
+      case 5: { poincare_expression_yylval.character = Symbol::SpecialSymbols::un1; return SYMBOL; } break;
+      case 6: { poincare_expression_yylval.character = Symbol::SpecialSymbols::vn; return SYMBOL; } break;
+      case 7: { poincare_expression_yylval.character = Symbol::SpecialSymbols::vn1; return SYMBOL; } break;
+      case 8: { poincare_expression_yylval.character = Symbol::SpecialSymbols::wn; return SYMBOL; } break;
+      case 9: { poincare_expression_yylval.character = Symbol::SpecialSymbols::wn1; return SYMBOL; } break;
+      case 10: { poincare_expression_yylval.expression = new ArcCosine(); return FUNCTION; } break;
+      case 11: { poincare_expression_yylval.expression = new HyperbolicArcCosine(); return FUNCTION; } break;
+      case 12: { poincare_expression_yylval.expression = new AbsoluteValue(); return FUNCTION; } break;
+      case 13: { poincare_expression_yylval.character = Symbol::SpecialSymbols::Ans; return SYMBOL; } break;
+      case 14: { poincare_expression_yylval.expression = new ComplexArgument(); return FUNCTION; } break;
+      case 15: { poincare_expression_yylval.expression = new ArcSine(); return FUNCTION; } break;
+      case 16: { poincare_expression_yylval.expression = new HyperbolicArcSine(); return FUNCTION; } break;
+      case 17: { poincare_expression_yylval.expression = new ArcTangent(); return FUNCTION; } break;
+      case 18: { poincare_expression_yylval.expression = new HyperbolicArcTangent(); return FUNCTION; } break;
+      case 19: { poincare_expression_yylval.expression = new BinomialCoefficient(); return FUNCTION; } break;
+      case 20: { poincare_expression_yylval.expression = new Ceiling(); return FUNCTION; } break;
+      case 21: { poincare_expression_yylval.expression = new ConfidenceInterval(); return FUNCTION; } break;
+      case 22: { poincare_expression_yylval.expression = new Derivative(); return FUNCTION; } break;
+      case 23: { poincare_expression_yylval.expression = new MatrixDimension(); return FUNCTION; } break;
+      case 24: { poincare_expression_yylval.expression = new Determinant(); return FUNCTION; } break;
+      case 25: { poincare_expression_yylval.expression = new Conjugate(); return FUNCTION; } break;
+      case 26: { poincare_expression_yylval.expression = new Cosine(); return FUNCTION; } break;
+      case 27: { poincare_expression_yylval.expression = new HyperbolicCosine(); return FUNCTION; } break;
+      case 28: { poincare_expression_yylval.expression = new Floor(); return FUNCTION; } break;
+      case 29: { poincare_expression_yylval.expression = new FracPart(); return FUNCTION; } break;
+      case 30: { poincare_expression_yylval.expression = new GreatCommonDivisor(); return FUNCTION; } break;
+      case 31: { poincare_expression_yylval.expression = new ImaginaryPart(); return FUNCTION; } break;
+      case 32: { poincare_expression_yylval.expression = new Integral(); return FUNCTION; } break;
+      case 33: { poincare_expression_yylval.expression = new MatrixInverse(); return FUNCTION; } break;
+      case 34: { poincare_expression_yylval.expression = new LeastCommonMultiple(); return FUNCTION; } break;
+      case 35: { poincare_expression_yylval.expression = new NaperianLogarithm(); return FUNCTION; } break;
+      case 36: { poincare_expression_yylval.expression = new Logarithm(); return FUNCTION; } break;
+      case 37: { poincare_expression_yylval.expression = new PermuteCoefficient(); return FUNCTION; } break;
+      case 38: { poincare_expression_yylval.expression = new PredictionInterval(); return FUNCTION; } break;
+      case 39: { poincare_expression_yylval.expression = new ConfidenceInterval(); return FUNCTION; } break;
+      case 40: { poincare_expression_yylval.expression = new Product(); return FUNCTION; } break;
+      case 41: { poincare_expression_yylval.expression = new DivisionQuotient(); return FUNCTION; } break;
+      case 42: { poincare_expression_yylval.expression = new ReelPart(); return FUNCTION; } break;
+      case 43: { poincare_expression_yylval.expression = new DivisionRemainder(); return FUNCTION; } break;
+      case 44: { poincare_expression_yylval.expression = new NthRoot(); return FUNCTION; } break;
+      case 45: { poincare_expression_yylval.expression = new Round(); return FUNCTION; } break;
+      case 46: { poincare_expression_yylval.expression = new Sine(); return FUNCTION; } break;
+      case 47: { poincare_expression_yylval.expression = new HyperbolicSine(); return FUNCTION; } break;
+      case 48: { poincare_expression_yylval.expression = new Sum(); return FUNCTION; } break;
+      case 49: { poincare_expression_yylval.expression = new Tangent(); return FUNCTION; } break;
+      case 50: { poincare_expression_yylval.expression = new HyperbolicTangent(); return FUNCTION; } break;
+      case 51: { poincare_expression_yylval.expression = new MatrixTrace(); return FUNCTION; } break;
+      case 52: { poincare_expression_yylval.expression = new MatrixTranspose(); return FUNCTION; } break;
+      case 53: { poincare_expression_yylval.expression = new Complex<double>(Complex<double>::Float(NAN)); return UNDEFINED; } break;
+      case 54: { poincare_expression_yylval.expression = new Complex<double>(Complex<double>::Float(INFINITY)); return UNDEFINED; } break;
+      case 55: { poincare_expression_yylval.character = yytext[0]; return SYMBOL; } break;
+      case 56: { return EE; } break;
+      case 57: { poincare_expression_yylval.expression = new SquareRoot(); return FUNCTION; } break;
+      case 58: { return ICOMPLEX; } break;
+      case 59: { poincare_expression_yylval.character = yytext[0]; return SYMBOL; } break;
+      case 60: { return STO; } break;
+      case 61: { return PLUS; } break;
+      case 62: { return MINUS; } break;
+      case 63: { return MULTIPLY; } break;
+      case 64: { return DIVIDE; } break;
+      case 65: { return POW; } break;
+      case 66: { return BANG; } break;
+      case 67: { return LEFT_PARENTHESIS; } break;
+      case 68: { return RIGHT_PARENTHESIS; } break;
+      case 69: { return LEFT_BRACE; } break;
+      case 70: { return RIGHT_BRACE; } break;
+      case 71: { return LEFT_BRACKET; } break;
+      case 72: { return RIGHT_BRACKET; } break;
+      case 73: { return COMMA; } break;
+      case 74: { return DOT; } break;
+    }
+  }
+}
@@ -0,0 +1,9 @@
+#ifndef YY_SHIM_HEADER
+#define YY_SHIM_HEADER
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+YY_BUFFER_STATE poincare_expression_yy_scan_string(const char * s);
+void poincare_expression_yy_delete_buffer(YY_BUFFER_STATE b);
+int poincare_expression_yylex(void);
+extern char * poincare_expression_yytext;
+extern int poincare_expression_yyleng;
+#endif
@@ -49,6 +49,12 @@ const Expression * ExpressionMatrix::operand(int i) const {
   return m_matrixData->operands()[i];
 }
 
+void ExpressionMatrix::replaceOperand(int i, Expression * newOperand) {
+  assert(i >= 0);
+  assert(i < numberOfOperands());
+  m_matrixData->operands()[i] = newOperand;
+}
+
 Expression * ExpressionMatrix::clone() const {
   return this->cloneWithDifferentOperands(m_matrixData->operands(), numberOfOperands(), true);
 }
@@ -0,0 +1,123 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_POINCARE_EXPRESSION_YY_POINCARE_SRC_EXPRESSION_PARSER_HPP_INCLUDED
+# define YY_POINCARE_EXPRESSION_YY_POINCARE_SRC_EXPRESSION_PARSER_HPP_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int poincare_expression_yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    DIGITS = 258,                  /* DIGITS  */
+    SYMBOL = 259,                  /* SYMBOL  */
+    FUNCTION = 260,                /* FUNCTION  */
+    UNDEFINED = 261,               /* UNDEFINED  */
+    PLUS = 262,                    /* PLUS  */
+    MINUS = 263,                   /* MINUS  */
+    MULTIPLY = 264,                /* MULTIPLY  */
+    DIVIDE = 265,                  /* DIVIDE  */
+    POW = 266,                     /* POW  */
+    BANG = 267,                    /* BANG  */
+    LEFT_PARENTHESIS = 268,        /* LEFT_PARENTHESIS  */
+    RIGHT_PARENTHESIS = 269,       /* RIGHT_PARENTHESIS  */
+    LEFT_BRACE = 270,              /* LEFT_BRACE  */
+    RIGHT_BRACE = 271,             /* RIGHT_BRACE  */
+    LEFT_BRACKET = 272,            /* LEFT_BRACKET  */
+    RIGHT_BRACKET = 273,           /* RIGHT_BRACKET  */
+    COMMA = 274,                   /* COMMA  */
+    DOT = 275,                     /* DOT  */
+    EE = 276,                      /* EE  */
+    ICOMPLEX = 277,                /* ICOMPLEX  */
+    STO = 278,                     /* STO  */
+    UNDEFINED_SYMBOL = 279,        /* UNDEFINED_SYMBOL  */
+    UNARY_MINUS = 280,             /* UNARY_MINUS  */
+    IMPLICIT_MULTIPLY = 281        /* IMPLICIT_MULTIPLY  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 30 "poincare/src/expression_parser.y"
+
+  Poincare::Expression * expression;
+  Poincare::Symbol * symbol;
+  Poincare::ListData * listData;
+  Poincare::MatrixData * matrixData;
+  Poincare::Function * function;
+  /* Caution: all the const char * are NOT guaranteed to be NULL-terminated!
+   * While Flex guarantees that yytext is NULL-terminated when building tokens,
+   * it does so by temporarily swapping in a NULL terminated in the input text.
+   * Of course that hack has vanished when the pointer is fed into Bison.
+   * We thus record the length of the char fed into Flex in a structure and give
+   * it to the object constructor called by Bison along with the char *. */
+  struct {
+     char * address;
+     int length;
+  } string;
+  char character;
+
+#line 109 "poincare/src/expression_parser.hpp"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE poincare_expression_yylval;
+
+
+int poincare_expression_yyparse (Poincare::Expression ** expressionOutput);
+
+
+#endif /* !YY_POINCARE_EXPRESSION_YY_POINCARE_SRC_EXPRESSION_PARSER_HPP_INCLUDED  */
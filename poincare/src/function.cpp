@@ -48,6 +48,11 @@ const Expression * Function::operand(int i) const {
   return m_args[i];
 }
 
+void Function::replaceOperand(int i, Expression * newOperand) {
+  assert(i >= 0 && i < m_numberOfArguments);
+  m_args[i] = newOperand;
+}
+
 int Function::numberOfOperands() const {
   return m_numberOfArguments;
 }
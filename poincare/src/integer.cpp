@@ -87,7 +87,8 @@ Integer::~Integer() {
 Integer::Integer(native_uint_t * digits, uint16_t numberOfDigits, bool negative) :
   m_digits(digits),
   m_numberOfDigits(numberOfDigits),
-  m_negative(negative) {
+  // Zero isn't negative, or it wouldn't be equal to zero
+  m_negative(negative && (numberOfDigits > 1 || digits[0] != 0)) {
 }
 
 int8_t Integer::ucmp(const Integer &other) const {
@@ -120,6 +121,14 @@ bool Integer::operator<(const Integer &other) const {
   return (sign(m_negative)*ucmp(other) < 0);
 }
 
+uint32_t Integer::hash() const {
+  uint32_t hash = m_negative;
+  for (uint16_t i = 0; i < m_numberOfDigits; i++) {
+    hash = 31*hash + m_digits[i];
+  }
+  return hash;
+}
+
 bool Integer::operator==(const Integer &other) const {
   if (m_negative != other.m_negative) {
     return false;
@@ -6,10 +6,10 @@ namespace Poincare {
 
 ExpressionLayout::ExpressionLayout() :
   m_baseline(0),
-  m_parent(nullptr),
+  m_frame(KDRectZero),
   m_sized(false),
   m_positioned(false),
-  m_frame(KDRectZero) {
+  m_parent(nullptr) {
 }
 
 KDCoordinate ExpressionLayout::baseline() {
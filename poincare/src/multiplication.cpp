@@ -5,6 +5,7 @@ extern "C" {
 #include <cmath>
 
 #include <poincare/multiplication.h>
+#include <poincare/symbol.h>
 #include "layout/string_layout.h"
 #include "layout/horizontal_layout.h"
 #include "layout/parenthesis_layout.h"
@@ -32,6 +33,31 @@ Expression * Multiplication::cloneWithDifferentOperands(Expression** newOperands
   return new Multiplication(newOperands, cloneOperands);
 }
 
+static bool mayBeMatrix(const Expression * e) {
+  switch (e->type()) {
+    case Expression::Type::ExpressionMatrix:
+    case Expression::Type::Evaluation:
+    case Expression::Type::ConfidenceInterval:
+    case Expression::Type::PredictionInterval:
+      return true;
+    case Expression::Type::Symbol:
+      return ((const Symbol *)e)->isMatrixSymbol() || ((const Symbol *)e)->name() == Symbol::SpecialSymbols::Ans;
+    case Expression::Type::Complex:
+      return false;
+    default:
+      for (int i = 0; i < e->numberOfOperands(); i++) {
+        if (mayBeMatrix(e->operand(i))) {
+          return true;
+        }
+      }
+      return false;
+  }
+}
+
+bool Multiplication::isCommutative() const {
+  return !mayBeMatrix(m_operands[0]) || !mayBeMatrix(m_operands[1]);
+}
+
 template<typename T>
 Complex<T> Multiplication::compute(const Complex<T> c, const Complex<T> d) {
   return Complex<T>::Cartesian(c.a()*d.a()-c.b()*d.b(), c.b()*d.a() + c.a()*d.b());
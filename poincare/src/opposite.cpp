@@ -34,6 +34,11 @@ const Expression * Opposite::operand(int i) const {
   return m_operand;
 }
 
+void Opposite::replaceOperand(int i, Expression * newOperand) {
+  assert(i == 0);
+  m_operand = newOperand;
+}
+
 int Opposite::numberOfOperands() const {
   return 1;
 }
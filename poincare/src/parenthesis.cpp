@@ -33,6 +33,11 @@ const Expression * Parenthesis::operand(int i) const {
   return m_operand;
 }
 
+void Parenthesis::replaceOperand(int i, Expression * newOperand) {
+  assert(i == 0);
+  m_operand = newOperand;
+}
+
 Expression * Parenthesis::clone() const {
   return this->cloneWithDifferentOperands((Expression**) &m_operand, 1, true);
 }
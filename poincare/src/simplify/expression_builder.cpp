@@ -1,4 +1,5 @@
 #include "expression_builder.h"
+#include "simplifier.h"
 #include <poincare/addition.h>
 #include <poincare/integer.h>
 #include <poincare/multiplication.h>
@@ -22,7 +23,7 @@ Expression * ExpressionBuilder::build(ExpressionMatch matches[]) {
     if (child->m_action == ExpressionBuilder::Action::BringUpWildcard) {
       for (int j=0; j<matches[child->m_matchIndex].numberOfExpressions(); j++) {
         children_expressions[numberOfChildrenExpressions++] =
-          matches[child->m_matchIndex].expression(j)->clone();
+          Simplifier::clone(matches[child->m_matchIndex].expression(j));
       }
     } else {
       children_expressions[numberOfChildrenExpressions++] = child->build(matches);
@@ -68,7 +69,7 @@ Expression * ExpressionBuilder::build(ExpressionMatch matches[]) {
     case ExpressionBuilder::Action::Clone:
       // It only makes sense to clone if the match has a single expression!
       assert(matches[m_matchIndex].numberOfExpressions() == 1);
-      result = matches[m_matchIndex].expression(0)->clone();
+      result = Simplifier::clone(matches[m_matchIndex].expression(0));
       break;
     case ExpressionBuilder::Action::CallExternalGenerator:
       result = m_generator(children_expressions, numberOfChildrenExpressions);
@@ -73,7 +73,9 @@ int ExpressionSelector::match(const Expression * e, ExpressionMatch * matches, i
       /* Here we assume that the match can only have a single child, as we
        * don't want to match on wildcards. */
       assert(matches[m_integerValue].numberOfExpressions() == 1);
-      if (!e->isEquivalentTo((Expression *)matches[m_sameAsPosition].expression(0))) {
+      /* The simplifier only matches expressions whose operands are already
+       * simplified, so they are equivalent only if they are identical. */
+      if (!e->isIdenticalTo(matches[m_sameAsPosition].expression(0))) {
         return 0;
       }
       break;
@@ -0,0 +1,247 @@
+#include "rules.h"
+#include "simplification_generator.h"
+
+using namespace Poincare;
+
+constexpr ExpressionSelector rule0Selector[2] = {
+ExpressionSelector::Type(Expression::Type::Parenthesis, 1), // #0
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #1
+};
+constexpr ExpressionBuilder rule0Builder[1] = {
+ExpressionBuilder::Clone(1, 0), // #0
+};
+
+constexpr ExpressionSelector rule1Selector[2] = {
+ExpressionSelector::Type(Expression::Type::Parenthesis, 1), // #0
+  ExpressionSelector::Type(Expression::Type::Symbol, 0), // #1
+};
+constexpr ExpressionBuilder rule1Builder[1] = {
+ExpressionBuilder::Clone(1, 0), // #0
+};
+
+constexpr ExpressionSelector rule2Selector[3] = {
+ExpressionSelector::Type(Expression::Type::Addition, 2), // #0
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #1
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #2
+};
+constexpr ExpressionBuilder rule2Builder[3] = {
+ExpressionBuilder::CallExternalGenerator(SimplificationGenerator::AddIntegers, 2), // #0
+  ExpressionBuilder::Clone(1, 0), // #1
+  ExpressionBuilder::Clone(2, 0), // #2
+};
+
+constexpr ExpressionSelector rule3Selector[4] = {
+ExpressionSelector::Type(Expression::Type::Addition, 3), // #0
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #1
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #2
+  ExpressionSelector::Wildcard(0), // #3
+};
+constexpr ExpressionBuilder rule3Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::CallExternalGenerator(SimplificationGenerator::AddIntegers, 2), // #1
+    ExpressionBuilder::Clone(1, 0), // #2
+    ExpressionBuilder::Clone(2, 0), // #3
+  ExpressionBuilder::BringUpWildcard(3, 0), // #4
+};
+
+constexpr ExpressionSelector rule4Selector[3] = {
+ExpressionSelector::Type(Expression::Type::Subtraction, 2), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Any(0), // #2
+};
+constexpr ExpressionBuilder rule4Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::Clone(1, 0), // #1
+  ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #2
+    ExpressionBuilder::Clone(2, 0), // #3
+    ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, -1, 0), // #4
+};
+
+constexpr ExpressionSelector rule5Selector[5] = {
+ExpressionSelector::Type(Expression::Type::Addition, 2), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #2
+    ExpressionSelector::SameAs(1, 0), // #3
+    ExpressionSelector::TypeAndValue(Expression::Type::Integer, -1, 0), // #4
+};
+constexpr ExpressionBuilder rule5Builder[1] = {
+ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 0, 0), // #0
+};
+
+constexpr ExpressionSelector rule6Selector[6] = {
+ExpressionSelector::Type(Expression::Type::Addition, 3), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #2
+    ExpressionSelector::SameAs(1, 0), // #3
+    ExpressionSelector::TypeAndValue(Expression::Type::Integer, -1, 0), // #4
+  ExpressionSelector::Any(0), // #5
+};
+constexpr ExpressionBuilder rule6Builder[1] = {
+ExpressionBuilder::Clone(5, 0), // #0
+};
+
+constexpr ExpressionSelector rule7Selector[7] = {
+ExpressionSelector::Type(Expression::Type::Addition, 4), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #2
+    ExpressionSelector::SameAs(1, 0), // #3
+    ExpressionSelector::TypeAndValue(Expression::Type::Integer, -1, 0), // #4
+  ExpressionSelector::Any(0), // #5
+  ExpressionSelector::Wildcard(0), // #6
+};
+constexpr ExpressionBuilder rule7Builder[3] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::Clone(5, 0), // #1
+  ExpressionBuilder::BringUpWildcard(6, 0), // #2
+};
+
+constexpr ExpressionSelector rule8Selector[4] = {
+ExpressionSelector::Type(Expression::Type::Addition, 3), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::SameAs(1, 0), // #2
+  ExpressionSelector::Wildcard(0), // #3
+};
+constexpr ExpressionBuilder rule8Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #1
+    ExpressionBuilder::Clone(1, 0), // #2
+    ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 2, 0), // #3
+  ExpressionBuilder::BringUpWildcard(3, 0), // #4
+};
+
+constexpr ExpressionSelector rule9Selector[6] = {
+ExpressionSelector::Type(Expression::Type::Addition, 3), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #2
+    ExpressionSelector::SameAs(1, 0), // #3
+    ExpressionSelector::Any(0), // #4
+  ExpressionSelector::Wildcard(0), // #5
+};
+constexpr ExpressionBuilder rule9Builder[7] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #1
+    ExpressionBuilder::Clone(1, 0), // #2
+    ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #3
+      ExpressionBuilder::Clone(4, 0), // #4
+      ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 1, 0), // #5
+  ExpressionBuilder::BringUpWildcard(5, 0), // #6
+};
+
+constexpr ExpressionSelector rule10Selector[8] = {
+ExpressionSelector::Type(Expression::Type::Addition, 3), // #0
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #1
+    ExpressionSelector::Any(0), // #2
+    ExpressionSelector::Any(0), // #3
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #4
+    ExpressionSelector::SameAs(2, 0), // #5
+    ExpressionSelector::Any(0), // #6
+  ExpressionSelector::Wildcard(0), // #7
+};
+constexpr ExpressionBuilder rule10Builder[7] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #0
+  ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #1
+    ExpressionBuilder::Clone(2, 0), // #2
+    ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #3
+      ExpressionBuilder::Clone(3, 0), // #4
+      ExpressionBuilder::Clone(6, 0), // #5
+  ExpressionBuilder::BringUpWildcard(7, 0), // #6
+};
+
+constexpr ExpressionSelector rule11Selector[3] = {
+ExpressionSelector::Type(Expression::Type::Addition, 2), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::SameAs(1, 0), // #2
+};
+constexpr ExpressionBuilder rule11Builder[3] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #0
+  ExpressionBuilder::Clone(1, 0), // #1
+  ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 2, 0), // #2
+};
+
+constexpr ExpressionSelector rule12Selector[5] = {
+ExpressionSelector::Type(Expression::Type::Addition, 2), // #0
+  ExpressionSelector::Any(0), // #1
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #2
+    ExpressionSelector::SameAs(1, 0), // #3
+    ExpressionSelector::Any(0), // #4
+};
+constexpr ExpressionBuilder rule12Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #0
+  ExpressionBuilder::Clone(1, 0), // #1
+  ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #2
+    ExpressionBuilder::Clone(4, 0), // #3
+    ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 1, 0), // #4
+};
+
+constexpr ExpressionSelector rule13Selector[7] = {
+ExpressionSelector::Type(Expression::Type::Addition, 2), // #0
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #1
+    ExpressionSelector::Any(0), // #2
+    ExpressionSelector::Any(0), // #3
+  ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #4
+    ExpressionSelector::SameAs(2, 0), // #5
+    ExpressionSelector::Any(0), // #6
+};
+constexpr ExpressionBuilder rule13Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #0
+  ExpressionBuilder::Clone(2, 0), // #1
+  ExpressionBuilder::BuildFromType(Expression::Type::Addition, 2), // #2
+    ExpressionBuilder::Clone(3, 0), // #3
+    ExpressionBuilder::Clone(6, 0), // #4
+};
+
+constexpr ExpressionSelector rule14Selector[3] = {
+ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #0
+  ExpressionSelector::TypeAndValue(Expression::Type::Integer, 0, 0), // #1
+  ExpressionSelector::Wildcard(0), // #2
+};
+constexpr ExpressionBuilder rule14Builder[1] = {
+ExpressionBuilder::BuildFromTypeAndValue(Expression::Type::Integer, 0, 0), // #0
+};
+
+constexpr ExpressionSelector rule15Selector[3] = {
+ExpressionSelector::Type(Expression::Type::Multiplication, 2), // #0
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #1
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #2
+};
+constexpr ExpressionBuilder rule15Builder[3] = {
+ExpressionBuilder::CallExternalGenerator(SimplificationGenerator::MultiplyIntegers, 2), // #0
+  ExpressionBuilder::Clone(1, 0), // #1
+  ExpressionBuilder::Clone(2, 0), // #2
+};
+
+constexpr ExpressionSelector rule16Selector[4] = {
+ExpressionSelector::Type(Expression::Type::Multiplication, 3), // #0
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #1
+  ExpressionSelector::Type(Expression::Type::Integer, 0), // #2
+  ExpressionSelector::Wildcard(0), // #3
+};
+constexpr ExpressionBuilder rule16Builder[5] = {
+ExpressionBuilder::BuildFromType(Expression::Type::Multiplication, 2), // #0
+  ExpressionBuilder::CallExternalGenerator(SimplificationGenerator::MultiplyIntegers, 2), // #1
+    ExpressionBuilder::Clone(1, 0), // #2
+    ExpressionBuilder::Clone(2, 0), // #3
+  ExpressionBuilder::BringUpWildcard(3, 0), // #4
+};
+
+constexpr Simplification Poincare::simplifications[17] = {
+  Simplification((ExpressionSelector *)rule0Selector, (ExpressionBuilder *)rule0Builder),
+  Simplification((ExpressionSelector *)rule1Selector, (ExpressionBuilder *)rule1Builder),
+  Simplification((ExpressionSelector *)rule2Selector, (ExpressionBuilder *)rule2Builder),
+  Simplification((ExpressionSelector *)rule3Selector, (ExpressionBuilder *)rule3Builder),
+  Simplification((ExpressionSelector *)rule4Selector, (ExpressionBuilder *)rule4Builder),
+  Simplification((ExpressionSelector *)rule5Selector, (ExpressionBuilder *)rule5Builder),
+  Simplification((ExpressionSelector *)rule6Selector, (ExpressionBuilder *)rule6Builder),
+  Simplification((ExpressionSelector *)rule7Selector, (ExpressionBuilder *)rule7Builder),
+  Simplification((ExpressionSelector *)rule8Selector, (ExpressionBuilder *)rule8Builder),
+  Simplification((ExpressionSelector *)rule9Selector, (ExpressionBuilder *)rule9Builder),
+  Simplification((ExpressionSelector *)rule10Selector, (ExpressionBuilder *)rule10Builder),
+  Simplification((ExpressionSelector *)rule11Selector, (ExpressionBuilder *)rule11Builder),
+  Simplification((ExpressionSelector *)rule12Selector, (ExpressionBuilder *)rule12Builder),
+  Simplification((ExpressionSelector *)rule13Selector, (ExpressionBuilder *)rule13Builder),
+  Simplification((ExpressionSelector *)rule14Selector, (ExpressionBuilder *)rule14Builder),
+  Simplification((ExpressionSelector *)rule15Selector, (ExpressionBuilder *)rule15Builder),
+  Simplification((ExpressionSelector *)rule16Selector, (ExpressionBuilder *)rule16Builder),
+};
+
+constexpr int Poincare::knumberOfSimplifications = 17;
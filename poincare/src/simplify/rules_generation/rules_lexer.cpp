@@ -0,0 +1,85 @@
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#define yytext yytext
+#define yyleng yyleng
+#define yylex yylex
+typedef struct yy_buffer_state * YY_BUFFER_STATE;
+char * yytext = 0; int yyleng = 0;
+
+
+#include "rule.h"
+#include "rules_tokens.h"
+
+
+struct yy_buffer_state { char * base; int pos; int len; int holdPos; char hold; };
+static YY_BUFFER_STATE yy_current = 0;
+YY_BUFFER_STATE yy_scan_string(const char * s) {
+  YY_BUFFER_STATE b = (YY_BUFFER_STATE)malloc(sizeof(struct yy_buffer_state));
+  b->len = strlen(s); b->base = (char *)malloc(b->len + 2); memcpy(b->base, s, b->len + 1); b->base[b->len+1] = 0;
+  b->pos = 0; b->holdPos = -1; b->hold = 0; yy_current = b; return b;
+}
+void yy_delete_buffer(YY_BUFFER_STATE b) { if (b == 0) return; if (yy_current == b) yy_current = 0; free(b->base); free(b); }
+struct yy_atom { unsigned char set[32]; int min; int max; };
+static int yy_match(const struct yy_atom * atoms, int n, const unsigned char * s, int len) {
+  if (n == 0) return 0;
+  int k = 0;
+  while (k < len && (atoms[0].max < 0 || k < atoms[0].max) && (atoms[0].set[s[k]>>3] & (1<<(s[k]&7)))) k++;
+  for (; k >= atoms[0].min; k--) { int r = yy_match(atoms+1, n-1, s+k, len-k); if (r >= 0) return k + r; }
+  return -1;
+}
+static const struct yy_atom yy_rule_0[] = {{{0,0,0,0,0,0,0,0,0,0,0,0,254,255,255,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, -1},};
+static const struct yy_atom yy_rule_1[] = {{{0,0,0,0,0,0,0,0,254,255,255,7,254,255,255,7,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, -1},};
+static const struct yy_atom yy_rule_2[] = {{{0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 0, 1},{{0,0,0,0,0,0,255,3,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, -1},};
+static const struct yy_atom yy_rule_3[] = {{{0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_4[] = {{{0,0,0,0,0,4,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_5[] = {{{0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_6[] = {{{0,0,0,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_7[] = {{{0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_8[] = {{{0,0,0,0,0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_9[] = {{{0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_10[] = {{{0,0,0,0,0,16,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_11[] = {{{0,0,0,0,0,0,0,8,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_12[] = {{{0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom yy_rule_13[] = {{{0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{0,0,0,0,0,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},{{254,251,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255}, 0, -1},};
+static const struct yy_atom yy_rule_14[] = {{{0,6,0,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, 1, 1},};
+static const struct yy_atom * const yy_rules[] = {yy_rule_0,yy_rule_1,yy_rule_2,yy_rule_3,yy_rule_4,yy_rule_5,yy_rule_6,yy_rule_7,yy_rule_8,yy_rule_9,yy_rule_10,yy_rule_11,yy_rule_12,yy_rule_13,yy_rule_14};
+static const int yy_rule_sizes[] = {1,1,2,1,1,2,1,1,1,1,1,1,1,3,1};
+
+int yylex(void) {
+  if (yy_current == 0) {
+    size_t cap = 1024, n = 0; char * buf = (char *)malloc(cap); int c;
+    while ((c = getchar()) != EOF) { if (n + 2 >= cap) { cap *= 2; buf = (char *)realloc(buf, cap); } buf[n++] = (char)c; }
+    buf[n] = 0; yy_scan_string(buf); free(buf);
+  }
+  YY_BUFFER_STATE b = yy_current;
+  for (;;) {
+    if (b->holdPos >= 0) { b->base[b->holdPos] = b->hold; b->holdPos = -1; }
+    if (b->pos >= b->len) return 0;
+    int best = -1, bestLen = 0;
+    for (int r = 0; r < 15; r++) {
+      int l = yy_match(yy_rules[r], yy_rule_sizes[r], (const unsigned char *)b->base + b->pos, b->len - b->pos);
+      if (l > bestLen) { best = r; bestLen = l; }
+    }
+    if (best < 0) { b->pos++; continue; }
+    yytext = b->base + b->pos; yyleng = bestLen;
+    b->pos += bestLen; b->holdPos = b->pos; b->hold = b->base[b->pos]; b->base[b->pos] = 0;
+    switch (best) {
+      case 0: { yylval.string = new std::string(yytext); return (IDENTIFIER); } break;
+      case 1: { yylval.string = new std::string(yytext); return (CAPITALIZED_IDENTIFIER); } break;
+      case 2: { yylval.string = new std::string(yytext); return (VALUE); } break;
+      case 3: { return(DOLLAR); } break;
+      case 4: { return (ASTERISK); } break;
+      case 5: { return(SIMPLIFIES_TO); } break;
+      case 6: { return(LEFT_PARENTHESIS); } break;
+      case 7: { return(RIGHT_PARENTHESIS); } break;
+      case 8: { return(LEFT_BRACKET); } break;
+      case 9: { return(RIGHT_BRACKET); } break;
+      case 10: { return(COMMA); } break;
+      case 11: { return(SEMICOLON); } break;
+      case 12: { return(PERIOD); } break;
+      case 13: {} break;
+      case 14: {} break;
+    }
+  }
+}
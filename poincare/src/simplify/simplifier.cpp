@@ -0,0 +1,280 @@
+#include "simplifier.h"
+#include "rules.h"
+#include <poincare/integer.h>
+#include <poincare/symbol.h>
+extern "C" {
+#include <assert.h>
+}
+
+namespace Poincare {
+
+Simplifier::Simplifier() {
+  for (int i = 0; i < k_numberOfMemoizedRewrites; i++) {
+    m_rewrites[i] = {0, nullptr, nullptr};
+  }
+}
+
+Simplifier::~Simplifier() {
+  for (int i = 0; i < k_numberOfMemoizedRewrites; i++) {
+    delete m_rewrites[i].input;
+    delete m_rewrites[i].output;
+  }
+}
+
+Expression * Simplifier::simplify(Expression * expression) {
+  if (expression->m_isSimplified) {
+    return expression;
+  }
+  if (isLeaf(expression)) {
+    expression->m_isSimplified = true;
+    return expression;
+  }
+  if (expression->isCommutative()) {
+    /* The operands of a chain are simplified and sorted at once, rather than
+     * every time one of its nodes is simplified. */
+    simplifyChainedOperands(expression, expression->type());
+    canonicalize(expression);
+  }
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    Expression * operand = (Expression *)expression->operand(i);
+    Expression * simplifiedOperand = simplify(operand);
+    if (simplifiedOperand != operand) {
+      expression->replaceOperand(i, simplifiedOperand);
+    }
+  }
+  return rewrite(expression);
+}
+
+Expression * Simplifier::clone(const Expression * expression) {
+  Expression * result = expression->clone();
+  copySimplifiedMarks(expression, result);
+  return result;
+}
+
+Expression * Simplifier::rewrite(Expression * expression) {
+  if (canonicalize(expression)) {
+    // Simplifying the rewired nodes may leave the chain out of order again
+    return simplify(expression);
+  }
+  uint32_t h = hash(expression, k_hashDepth);
+  Rewrite * memoizedRewrite = m_rewrites + h % k_numberOfMemoizedRewrites;
+  if (memoizedRewrite->input != nullptr && memoizedRewrite->hash == h && isIdentical(memoizedRewrite->input, expression)) {
+    delete expression;
+    return clone(memoizedRewrite->output);
+  }
+  for (int i = 0; i < knumberOfSimplifications; i++) {
+    const Simplification * simplification = (simplifications + i); // Pointer arithmetics
+    Expression * rewritten = simplification->simplify(expression);
+    if (rewritten != nullptr) {
+      Expression * result = simplify(rewritten);
+      /* The rewritten expression is kept as the input of the memoized rewrite
+       * rather than deleted. The recursive simplification may have used the
+       * same slot. */
+      delete memoizedRewrite->input;
+      delete memoizedRewrite->output;
+      *memoizedRewrite = {h, expression, clone(result)};
+      return result;
+    }
+  }
+  expression->m_isSimplified = true;
+  return expression;
+}
+
+void Simplifier::simplifyChainedOperands(Expression * expression, Expression::Type type) {
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    Expression * operand = (Expression *)expression->operand(i);
+    if (operand->type() == type && operand->isCommutative() && !operand->m_isSimplified) {
+      simplifyChainedOperands(operand, type);
+      continue;
+    }
+    Expression * simplifiedOperand = simplify(operand);
+    if (simplifiedOperand != operand) {
+      expression->replaceOperand(i, simplifiedOperand);
+    }
+  }
+}
+
+bool Simplifier::canonicalize(Expression * expression) {
+  if (!expression->isCommutative() || isCanonical(expression)) {
+    return false;
+  }
+  Expression::Type type = expression->type();
+  int numberOfOperands = numberOfChainedOperands(expression, type);
+  Expression ** operands = new Expression * [numberOfOperands];
+  Expression ** nodes = new Expression * [numberOfOperands-1];
+  int numberOfCollectedOperands = 0;
+  int numberOfNodes = 0;
+  collectChain(expression, type, operands, &numberOfCollectedOperands, nodes, &numberOfNodes);
+  assert(numberOfCollectedOperands == numberOfOperands);
+  assert(numberOfNodes == numberOfOperands-1 && nodes[numberOfNodes-1] == expression);
+
+  // Insertion sort: it is stable, and linear on the chains already sorted
+  for (int i = 1; i < numberOfOperands; i++) {
+    Expression * operand = operands[i];
+    int j = i;
+    while (j > 0 && compare(operands[j-1], operand) > 0) {
+      operands[j] = operands[j-1];
+      j--;
+    }
+    operands[j] = operand;
+  }
+
+  /* The first nodes of the chain keep their operands when these are already
+   * in place. From the first one which doesn't, the nodes are rewired and have
+   * to be simplified again. */
+  bool changed = false;
+  for (int i = 0; i < numberOfNodes; i++) {
+    Expression * left = i == 0 ? operands[0] : nodes[i-1];
+    Expression * right = operands[i+1];
+    changed = changed || nodes[i]->operand(0) != left || nodes[i]->operand(1) != right;
+    if (changed) {
+      nodes[i]->replaceOperand(0, left);
+      nodes[i]->replaceOperand(1, right);
+      nodes[i]->m_isSimplified = false;
+    }
+  }
+  delete[] operands;
+  delete[] nodes;
+  return changed;
+}
+
+bool Simplifier::isCanonical(const Expression * expression) {
+  // The chain leans left and each of its operands is sorted after the previous
+  Expression::Type type = expression->type();
+  const Expression * node = expression;
+  while (true) {
+    const Expression * right = node->operand(1);
+    if (right->type() == type && right->isCommutative()) {
+      return false;
+    }
+    const Expression * left = node->operand(0);
+    bool leftIsChained = left->type() == type && left->isCommutative();
+    if (compare(leftIsChained ? left->operand(1) : left, right) > 0) {
+      return false;
+    }
+    if (!leftIsChained) {
+      return true;
+    }
+    node = left;
+  }
+}
+
+int Simplifier::numberOfChainedOperands(const Expression * expression, Expression::Type type) {
+  int numberOfOperands = 0;
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    const Expression * operand = expression->operand(i);
+    if (operand->type() == type && operand->isCommutative()) {
+      numberOfOperands += numberOfChainedOperands(operand, type);
+    } else {
+      numberOfOperands++;
+    }
+  }
+  return numberOfOperands;
+}
+
+void Simplifier::collectChain(Expression * expression, Expression::Type type, Expression ** operands, int * numberOfOperands, Expression ** nodes, int * numberOfNodes) {
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    Expression * operand = (Expression *)expression->operand(i);
+    if (operand->type() == type && operand->isCommutative()) {
+      collectChain(operand, type, operands, numberOfOperands, nodes, numberOfNodes);
+    } else {
+      operands[(*numberOfOperands)++] = operand;
+    }
+  }
+  // The root of the chain comes last
+  nodes[(*numberOfNodes)++] = expression;
+}
+
+int Simplifier::compare(const Expression * e1, const Expression * e2) {
+  // Integers come first, so that they are added or multiplied together
+  bool isInteger1 = e1->type() == Expression::Type::Integer;
+  bool isInteger2 = e2->type() == Expression::Type::Integer;
+  if (isInteger1 != isInteger2) {
+    return isInteger1 ? -1 : 1;
+  }
+  if (e1->type() != e2->type()) {
+    return (int)e1->type() - (int)e2->type();
+  }
+  switch (e1->type()) {
+    case Expression::Type::Integer:
+    {
+      const Integer * i1 = (const Integer *)e1;
+      const Integer * i2 = (const Integer *)e2;
+      return *i1 < *i2 ? -1 : (*i2 < *i1 ? 1 : 0);
+    }
+    case Expression::Type::Symbol:
+      return ((const Symbol *)e1)->name() - ((const Symbol *)e2)->name();
+    default:
+      break;
+  }
+  // The values of complexes aren't compared, as in Expression::isIdenticalTo
+  if (isLeaf(e1)) {
+    return 0;
+  }
+  if (e1->numberOfOperands() != e2->numberOfOperands()) {
+    return e1->numberOfOperands() - e2->numberOfOperands();
+  }
+  for (int i = 0; i < e1->numberOfOperands(); i++) {
+    int comparison = compare(e1->operand(i), e2->operand(i));
+    if (comparison != 0) {
+      return comparison;
+    }
+  }
+  return 0;
+}
+
+bool Simplifier::isLeaf(const Expression * expression) {
+  // Complexes and matrices of complexes are their own operands
+  return expression->numberOfOperands() == 0 || expression->type() == Expression::Type::Complex || expression->type() == Expression::Type::Evaluation;
+}
+
+uint32_t Simplifier::hash(const Expression * expression, int depth) {
+  uint32_t h = (uint32_t)expression->type();
+  switch (expression->type()) {
+    case Expression::Type::Integer:
+      return 31*h + ((const Integer *)expression)->hash();
+    case Expression::Type::Symbol:
+      return 31*h + ((const Symbol *)expression)->name();
+    default:
+      break;
+  }
+  if (isLeaf(expression) || depth == 0) {
+    return h;
+  }
+  for (int i = 0; i < expression->numberOfOperands(); i++) {
+    h = 31*h + hash(expression->operand(i), depth-1);
+  }
+  return h;
+}
+
+bool Simplifier::isIdentical(const Expression * e1, const Expression * e2) {
+  /* Unlike Expression::isIdenticalTo, the operands are compared in order: a
+   * rule may not rewrite the same operands in another order alike. Complexes
+   * are never identical, as their values aren't compared. */
+  if (e1->type() != e2->type() || e1->numberOfOperands() != e2->numberOfOperands()) {
+    return false;
+  }
+  if (e1->type() == Expression::Type::Complex || e1->type() == Expression::Type::Evaluation) {
+    return false;
+  }
+  for (int i = 0; i < e1->numberOfOperands(); i++) {
+    if (!isIdentical(e1->operand(i), e2->operand(i))) {
+      return false;
+    }
+  }
+  return e1->valueEquals(e2);
+}
+
+void Simplifier::copySimplifiedMarks(const Expression * source, Expression * destination) {
+  assert(source->type() == destination->type());
+  destination->m_isSimplified = source->m_isSimplified;
+  if (isLeaf(source)) {
+    return;
+  }
+  assert(source->numberOfOperands() == destination->numberOfOperands());
+  for (int i = 0; i < source->numberOfOperands(); i++) {
+    copySimplifiedMarks(source->operand(i), (Expression *)destination->operand(i));
+  }
+}
+
+}
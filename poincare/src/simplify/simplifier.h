@@ -0,0 +1,61 @@
+#ifndef POINCARE_SIMPLIFY_SIMPLIFIER_H
+#define POINCARE_SIMPLIFY_SIMPLIFIER_H
+
+#include <poincare/expression.h>
+#include <stdint.h>
+
+namespace Poincare {
+
+/* The simplifier rewrites an expression bottom-up, in place. The operands of a
+ * node are simplified before the node itself, and are only replaced when they
+ * changed. Once no rule applies to a node, it is marked as simplified and is
+ * never visited again, so that only the nodes built by a rewrite are.
+ *
+ * Before the rules are tried, nested sums and nested products are flattened
+ * and their operands sorted in a canonical order, as a chain leaning left:
+ * ((a+b)+c)+d. The nodes of the chain are reused, and only the ones which got
+ * other operands are simplified again. Simplified sums and products can thus
+ * be compared operand by operand.
+ *
+ * A small table memoizes the last rewrites by the structural hash of the node
+ * they started from: a subtree which appears several times in an expression is
+ * only rewritten once. */
+
+class Simplifier {
+public:
+  Simplifier();
+  ~Simplifier();
+  Simplifier(const Simplifier& other) = delete;
+  Simplifier(Simplifier&& other) = delete;
+  Simplifier& operator=(const Simplifier& other) = delete;
+  Simplifier& operator=(Simplifier&& other) = delete;
+  /* Takes ownership of the expression, which may be deleted, and returns its
+   * simplification. */
+  Expression * simplify(Expression * expression);
+  // Clones the expression along with the simplified marks of its nodes
+  static Expression * clone(const Expression * expression);
+private:
+  constexpr static int k_numberOfMemoizedRewrites = 16;
+  constexpr static int k_hashDepth = 4;
+  struct Rewrite {
+    uint32_t hash;
+    Expression * input;
+    Expression * output;
+  };
+  Expression * rewrite(Expression * expression);
+  void simplifyChainedOperands(Expression * expression, Expression::Type type);
+  static bool canonicalize(Expression * expression);
+  static bool isCanonical(const Expression * expression);
+  static int numberOfChainedOperands(const Expression * expression, Expression::Type type);
+  static void collectChain(Expression * expression, Expression::Type type, Expression ** operands, int * numberOfOperands, Expression ** nodes, int * numberOfNodes);
+  static int compare(const Expression * e1, const Expression * e2);
+  static bool isLeaf(const Expression * expression);
+  static uint32_t hash(const Expression * expression, int depth);
+  static bool isIdentical(const Expression * e1, const Expression * e2);
+  static void copySimplifiedMarks(const Expression * source, Expression * destination);
+  Rewrite m_rewrites[k_numberOfMemoizedRewrites];
+};
+
+}
+
+#endif
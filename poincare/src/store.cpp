@@ -43,6 +43,12 @@ const Expression * Store::operand(int i) const {
   return m_value;
 }
 
+void Store::replaceOperand(int i, Expression * newOperand) {
+  // The symbol is never rewritten
+  assert(i == 1);
+  m_value = newOperand;
+}
+
 int Store::numberOfOperands() const {
   return 2;
 }
@@ -0,0 +1,147 @@
+#include <quiz.h>
+#include <poincare.h>
+#include <string.h>
+#include <assert.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+/* The benchmark corpus times each of its expressions through the stages of a
+ * calculation: parse, simplify, evaluate, layout and print. Built with
+ * QUIZ_RUN_BENCHMARKS=1, the test runner prints one BENCH line per case and
+ * stage, named poincare_corpus_<case>_<stage>. On Linux, the blackbox runs it
+ * headless:
+ *   make PLATFORM=blackbox QUIZ_USE_CONSOLE=1 QUIZ_RUN_BENCHMARKS=1 test.bin
+ *   ./test.bin > run.txt
+ *
+ * Baselines are compared case by case, so a case is never edited: to change
+ * one, add it under a new name, remove the old one and bump the version. */
+
+constexpr static const char * k_corpusVersion = "poincare benchmark corpus, version 2";
+
+struct CorpusCase {
+  const char * name;
+  const char * text; // In the notation of translate_in_special_chars
+  bool simplify;
+};
+
+static const CorpusCase sCorpus[] = {
+  {"arithmetic", "1+2*3-4/5+6^2", true},
+  {"long_sum", "1+2+3+4+5+6+7+8+9+10+11+12+13+14+15+16+17+18+19+20", true},
+  {"fractions", "1/2+1/3+1/4+1/5+1/6+1/7", true},
+  {"large_integers", "123456789012345678901234567890*987654321098765432109876543210", true},
+  {"large_integer_sum", "99999999999999999999999999+1-12345678901234567890", true},
+  {"deep_nesting", "((((((((((1+2)*3)-4)/5)^2)+6)*7)-8)/9)^2)", true},
+  {"nested_functions", "sin(cos(tan(sin(cos(tan(ln(log(abs(-5)))))))))", false},
+  {"trigonometry", "sin(P/7)^2+cos(P/7)^2", false},
+  {"powers_and_roots", "R(2)^3+root(27,3)+X^ln(2)", false},
+  {"complex", "(3+2*I)*(1-I)/(2+I)", false},
+  {"matrix_product", "[[1,2,3][4,5,6][7,8,9]]*[[9,8,7][6,5,4][3,2,1]]", false},
+  {"matrix_inverse", "inverse([[2,1,1][1,3,2][1,0,0]])", false},
+  {"matrix_determinant", "det([[1,2,3,4][5,6,7,8][2,6,4,8][3,1,1,2]])", false},
+  {"integral", "int(x^2*sin(x),0,P)", false},
+  {"sum", "sum(1/n^2,1,100)", false},
+  {"product", "product(n,1,20)", false},
+  {"derivative", "diff(sin(x)^2,1)", false},
+  /* Pathological simplifications. The products of the first version weren't
+   * simplified, as Multiplication wasn't commutative then. */
+  {"repeated_terms", "x+x+x+x+x+x+x+x", true},
+  {"repeated_factors", "x*x*x*x*x*x*x*x", false},
+  {"cancelling_products", "(x+1)*(x+2)*(x+3)-(x+1)*(x+2)*(x+3)", false},
+  {"distributed_factors", "2*x+3*x+4*x+5*x+6*x", true},
+  // Since version 2
+  {"shuffled_sum_4", "x+3+A+2", true},
+  {"shuffled_sum_8", "x+3+A+2+B+5+C+7", true},
+  {"shuffled_product_8", "x*3*A*2*B*5*C*7", true},
+  {"cancelling_products_simplified", "(x+1)*(x+2)*(x+3)-(x+1)*(x+2)*(x+3)", true},
+};
+
+static GlobalContext * sContext;
+static char sText[128];
+static Expression * sExpression;
+static Evaluation<double> * sEvaluation;
+static volatile int sSink;
+
+static void parse() {
+  Expression * e = Expression::parse(sText);
+  sSink = e->numberOfOperands();
+  delete e;
+}
+
+static void simplify() {
+  Expression * e = sExpression->simplify();
+  sSink = e->numberOfOperands();
+  delete e;
+}
+
+static void evaluate() {
+  Evaluation<double> * e = sExpression->evaluate<double>(*sContext);
+  sSink = e->numberOfOperands();
+  delete e;
+}
+
+static void layout() {
+  ExpressionLayout * l = sExpression->createLayout();
+  sSink = l->size().width();
+  delete l;
+}
+
+static void print() {
+  char buffer[256];
+  sSink = sEvaluation->writeTextInBuffer(buffer, sizeof(buffer));
+}
+
+static void bench(const CorpusCase * c, const char * stage, void (*body)(void)) {
+  constexpr static const char * prefix = "poincare_corpus_";
+  char name[64];
+  int length = strlcpy(name, prefix, sizeof(name));
+  length += strlcpy(name + length, c->name, sizeof(name) - length);
+  name[length++] = '_';
+  strlcpy(name + length, stage, sizeof(name) - length);
+  quiz_bench(name, body);
+}
+
+QUIZ_CASE(poincare_benchmark_corpus) {
+  quiz_print(k_corpusVersion);
+  GlobalContext context;
+  sContext = &context;
+  for (const CorpusCase & c : sCorpus) {
+    strlcpy(sText, c.text, sizeof(sText));
+    translate_in_special_chars(sText);
+    sExpression = Expression::parse(sText);
+    assert(sExpression != nullptr);
+    sEvaluation = sExpression->evaluate<double>(context);
+    assert(sEvaluation != nullptr);
+    bench(&c, "parse", parse);
+    if (c.simplify) {
+      bench(&c, "simplify", simplify);
+    }
+    bench(&c, "evaluate", evaluate);
+    bench(&c, "layout", layout);
+    bench(&c, "print", print);
+    delete sEvaluation;
+    delete sExpression;
+  }
+}
+
+static const Integer & largeInteger() {
+  static Integer i("123456789012345678901234567890123456789");
+  return i;
+}
+
+static const Integer & otherLargeInteger() {
+  static Integer i("987654321098765432109876543210");
+  return i;
+}
+
+QUIZ_BENCH(poincare_integer_add_bench) {
+  sSink = largeInteger().add(otherLargeInteger()) < largeInteger();
+}
+
+QUIZ_BENCH(poincare_integer_multiply_bench) {
+  sSink = largeInteger().multiply_by(otherLargeInteger()) < largeInteger();
+}
+
+QUIZ_BENCH(poincare_integer_divide_bench) {
+  sSink = largeInteger().divide_by(otherLargeInteger()) < largeInteger();
+}
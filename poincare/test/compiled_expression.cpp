@@ -0,0 +1,116 @@
+#include <quiz.h>
+#include <poincare.h>
+#include <string.h>
+#include <math.h>
+#include <assert.h>
+#include "helper.h"
+
+using namespace Poincare;
+
+#if POINCARE_JIT && defined(__x86_64__) && (defined(__linux__) || defined(__APPLE__))
+constexpr static bool k_hasCompiler = true;
+#else
+constexpr static bool k_hasCompiler = false;
+#endif
+
+static const double sAbscissae[] = {-100.0, -3.0, -1.0, -0.5, -0.0, 0.0, 0.25, 1.0, 2.0, 7.5, 1E10, INFINITY, NAN};
+
+template<typename T>
+static void assert_compiled_expression_approximates_as_interpreted(const char * text, bool compilable, Expression::AngleUnit angleUnit = Expression::AngleUnit::Radian) {
+  GlobalContext globalContext;
+  char buffer[128];
+  strlcpy(buffer, text, sizeof(buffer));
+  translate_in_special_chars(buffer);
+  Expression * e = Expression::parse(buffer);
+  assert(e != nullptr);
+  CompiledExpression compiledExpression(e, 'x', globalContext, angleUnit);
+  assert(compiledExpression.isCompiled() == (compilable && k_hasCompiler));
+  VariableContext<T> variableContext('x', &globalContext);
+  Symbol xSymbol('x');
+  for (double abscissa : sAbscissae) {
+    T x = abscissa;
+    Complex<T> value = Complex<T>::Float(x);
+    variableContext.setExpressionForSymbolName(&value, &xSymbol);
+    T expected = e->approximate<T>(variableContext, angleUnit);
+    T result = compiledExpression.approximate<T>(x);
+    if (isnan(expected)) {
+      assert(isnan(result));
+    } else {
+      // Down to the sign of zeros
+      assert(memcmp(&result, &expected, sizeof(T)) == 0);
+    }
+  }
+  delete e;
+}
+
+QUIZ_CASE(poincare_compiled_expression_arithmetic) {
+  assert_compiled_expression_approximates_as_interpreted<double>("x", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("3*x^2-2*x+1", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("(x+1)/(x-1)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("-x*0", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("1/(x*(1/0))", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("x^0.5+x^(1/3)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("(-x)^2", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("P*x+X^x", true);
+  assert_compiled_expression_approximates_as_interpreted<float>("3*x^2-2*x+1", true);
+}
+
+QUIZ_CASE(poincare_compiled_expression_functions) {
+  assert_compiled_expression_approximates_as_interpreted<double>("sin(x)*cos(2*x)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("sin(x)+tan(x)", true, Expression::AngleUnit::Degree);
+  assert_compiled_expression_approximates_as_interpreted<double>("ln(x+1)/(x+1)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("R(x)^2", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("im(R(x))+abs(x)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("floor(x)+frac(x)+ceil(x)", true);
+  assert_compiled_expression_approximates_as_interpreted<float>("sin(x)*cos(2*x)", true);
+  assert_compiled_expression_approximates_as_interpreted<float>("R(x)^2", true);
+}
+
+QUIZ_CASE(poincare_compiled_expression_interpreted_nodes) {
+  // Nodes which aren't compiled are approximated by the interpreter
+  assert_compiled_expression_approximates_as_interpreted<double>("log(x)+x", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("root(x,3)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("x+int(x,0,1)", true);
+  assert_compiled_expression_approximates_as_interpreted<double>("x*sum(n,1,4)", true);
+  // Constant subtrees which aren't real make the whole expression interpreted
+  assert_compiled_expression_approximates_as_interpreted<double>("x*I", false);
+  assert_compiled_expression_approximates_as_interpreted<double>("x+[[1,2]]", false);
+}
+
+static GlobalContext * sBenchContext;
+static Expression * sBenchExpression;
+static CompiledExpression * sBenchCompiledExpression;
+static volatile double sSink;
+
+static void approximateCompiled() {
+  double sum = 0.0;
+  for (int i = 0; i < 100; i++) {
+    sum += sBenchCompiledExpression->approximate<double>(0.1*i);
+  }
+  sSink = sum;
+}
+
+static void approximateInterpreted() {
+  VariableContext<double> context('x', sBenchContext);
+  Symbol xSymbol('x');
+  double sum = 0.0;
+  for (int i = 0; i < 100; i++) {
+    Complex<double> x = Complex<double>::Float(0.1*i);
+    context.setExpressionForSymbolName(&x, &xSymbol);
+    sum += sBenchExpression->approximate<double>(context);
+  }
+  sSink = sum;
+}
+
+QUIZ_CASE(poincare_compiled_expression_benchmark) {
+  // A hundred points of a plot, compiled or interpreted
+  GlobalContext globalContext;
+  sBenchContext = &globalContext;
+  sBenchExpression = Expression::parse("sin(x)*cos(2*x)+0.5*x^2-3*x+1");
+  assert(sBenchExpression != nullptr);
+  CompiledExpression compiledExpression(sBenchExpression, 'x', globalContext);
+  sBenchCompiledExpression = &compiledExpression;
+  quiz_bench("poincare_compiled_expression_approximate", approximateCompiled);
+  quiz_bench("poincare_interpreted_expression_approximate", approximateInterpreted);
+  delete sBenchExpression;
+}
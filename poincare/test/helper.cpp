@@ -8,11 +8,8 @@
 
 using namespace Poincare;
 
-static Expression * parse_expression(const char * expression) {
-  quiz_print(expression);
-  char buffer[200];
-  strlcpy(buffer, expression, sizeof(buffer));
-  for (char *c = buffer; *c; c++) {
+void translate_in_special_chars(char * expression) {
+  for (char *c = expression; *c; c++) {
     switch (*c) {
       case 'E': *c = Ion::Charset::Exponent; break;
       case 'X': *c = Ion::Charset::Exponential; break;
@@ -21,6 +18,13 @@ static Expression * parse_expression(const char * expression) {
       case 'P': *c = Ion::Charset::SmallPi; break;
     }
   }
+}
+
+static Expression * parse_expression(const char * expression) {
+  quiz_print(expression);
+  char buffer[200];
+  strlcpy(buffer, expression, sizeof(buffer));
+  translate_in_special_chars(buffer);
   Expression * result = Expression::parse(buffer);
   assert(result);
   return result;
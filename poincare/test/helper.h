@@ -3,6 +3,10 @@
 constexpr Poincare::Expression::AngleUnit Degree = Poincare::Expression::AngleUnit::Degree;
 constexpr Poincare::Expression::AngleUnit Radian = Poincare::Expression::AngleUnit::Radian;
 
+/* Replaces E, X, I, R and P with the exponent, exponential, complex i, root
+ * and pi characters of the calculator's charset. */
+void translate_in_special_chars(char * expression);
+
 void assert_parsed_expression_type(const char * expression, Poincare::Expression::Type type);
 void assert_parsed_simplified_expression_type(const char * expression, Poincare::Expression::Type type);
 template<typename T>
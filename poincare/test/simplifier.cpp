@@ -0,0 +1,53 @@
+#include <quiz.h>
+#include <poincare.h>
+#include <assert.h>
+#include "simplify_utils.h"
+
+using namespace Poincare;
+
+QUIZ_CASE(poincare_simplifier_bottom_up) {
+  assert(simplifies_to("x-x", "0"));
+  assert(simplifies_to("(x+1)-(x+1)", "0"));
+  assert(simplifies_to("x+x+x+x+x+x+x+x", "x*8"));
+  assert(simplifies_to("1+2+3+4+5+A+6+7", "28+A"));
+  assert(simplifies_to("3*(5+4)", "27"));
+  assert(simplifies_to("sin(x+x)+cos(2*3)", "sin(x*2)+cos(6)"));
+}
+
+QUIZ_CASE(poincare_simplifier_repeated_subtrees) {
+  // The second x+x is the memoized rewrite of the first one
+  assert(simplifies_to("sin(x+x)+sin(x+x)", "sin(x*2)*2"));
+  assert(simplifies_to("(1+2+3)*(1+2+3)", "36"));
+}
+
+QUIZ_CASE(poincare_simplifier_fixed_point) {
+  const char * texts[] = {"1+2*3-4/5+6^2", "2*x+3*x+4*x+5*x+6*x", "sin(x+x)+cos(2*3)"};
+  for (const char * text : texts) {
+    Expression * e = Expression::parse(text);
+    assert(e != nullptr);
+    Expression * simplified = e->simplify();
+    Expression * simplifiedTwice = simplified->simplify();
+    assert(simplifiedTwice->isIdenticalTo(simplified));
+    delete simplifiedTwice;
+    delete simplified;
+    delete e;
+  }
+}
+
+QUIZ_CASE(poincare_simplifier_canonical_order) {
+  assert(simplifies_to("x*2*A*3", "6*A*x"));
+  assert(simplifies_to("A*x+x*A", "2*A*x"));
+  // Simplified expressions are compared operand by operand
+  const char * texts[][2] = {{"x+3+A+2+B+5+C+7", "7+C+5+B+2+A+3+x"}, {"x*3*A*2", "A*2*x*3"}};
+  for (auto & pair : texts) {
+    Expression * e1 = Expression::parse(pair[0]);
+    Expression * e2 = Expression::parse(pair[1]);
+    Expression * simplified1 = e1->simplify();
+    Expression * simplified2 = e2->simplify();
+    assert(simplified1->isIdenticalTo(simplified2));
+    delete simplified1;
+    delete simplified2;
+    delete e1;
+    delete e2;
+  }
+}
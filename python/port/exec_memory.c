@@ -0,0 +1,48 @@
+/* MAP_ANON isn't part of C99 */
+#define _DEFAULT_SOURCE
+#define _DARWIN_C_SOURCE
+
+#include "py/mpconfig.h"
+
+#if MICROPY_EMIT_X64
+
+#include <sys/mman.h>
+#include "py/misc.h"
+
+/* Native code is bump-allocated in a single executable region, mapped on first
+ * use. Only the last allocation can be given back, which is what happens when
+ * the compiler throws away the code it just emitted. */
+
+#define EXEC_MEMORY_SIZE (64*1024)
+
+static byte * exec_memory = NULL;
+static size_t exec_memory_used = 0;
+
+void mp_port_alloc_exec(size_t min_size, void **ptr, size_t *size) {
+    if (exec_memory == NULL) {
+        void * region = mmap(NULL, EXEC_MEMORY_SIZE, PROT_READ | PROT_WRITE | PROT_EXEC, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if (region == MAP_FAILED) {
+            m_malloc_fail(min_size);
+        }
+        exec_memory = region;
+    }
+    size_t aligned_size = (min_size + 15) & ~(size_t)15;
+    if (aligned_size > EXEC_MEMORY_SIZE - exec_memory_used) {
+        m_malloc_fail(min_size);
+    }
+    *ptr = exec_memory + exec_memory_used;
+    *size = aligned_size;
+    exec_memory_used += aligned_size;
+}
+
+void mp_port_free_exec(void *ptr, size_t size) {
+    if ((byte *)ptr + size == exec_memory + exec_memory_used) {
+        exec_memory_used -= size;
+    }
+}
+
+void mp_port_reset_exec(void) {
+    exec_memory_used = 0;
+}
+
+#endif
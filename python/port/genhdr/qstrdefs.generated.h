@@ -0,0 +1,270 @@
+// This file was automatically generated by makeqstrdata.py
+
+QDEF(MP_QSTR_NULL, (const byte*)"\x00\x00" "")
+QDEF(MP_QSTR__percent__hash_o, (const byte*)"\x6c\x03" "%#o")
+QDEF(MP_QSTR__percent__hash_x, (const byte*)"\x7b\x03" "%#x")
+QDEF(MP_QSTR_, (const byte*)"\x05\x00" "")
+QDEF(MP_QSTR__star_, (const byte*)"\x8f\x01" "*")
+QDEF(MP_QSTR__slash_, (const byte*)"\x8a\x01" "/")
+QDEF(MP_QSTR__lt_dictcomp_gt_, (const byte*)"\xcc\x0a" "<dictcomp>")
+QDEF(MP_QSTR__lt_genexpr_gt_, (const byte*)"\x34\x09" "<genexpr>")
+QDEF(MP_QSTR__lt_lambda_gt_, (const byte*)"\x80\x08" "<lambda>")
+QDEF(MP_QSTR__lt_listcomp_gt_, (const byte*)"\xd4\x0a" "<listcomp>")
+QDEF(MP_QSTR__lt_module_gt_, (const byte*)"\xbd\x08" "<module>")
+QDEF(MP_QSTR__lt_setcomp_gt_, (const byte*)"\x54\x09" "<setcomp>")
+QDEF(MP_QSTR__lt_stdin_gt_, (const byte*)"\xe3\x07" "<stdin>")
+QDEF(MP_QSTR__lt_string_gt_, (const byte*)"\x52\x08" "<string>")
+QDEF(MP_QSTR_ArithmeticError, (const byte*)"\x2d\x0f" "ArithmeticError")
+QDEF(MP_QSTR_AssertionError, (const byte*)"\x97\x0e" "AssertionError")
+QDEF(MP_QSTR_AttributeError, (const byte*)"\x21\x0e" "AttributeError")
+QDEF(MP_QSTR_BaseException, (const byte*)"\x07\x0d" "BaseException")
+QDEF(MP_QSTR_BufferError, (const byte*)"\x1d\x0b" "BufferError")
+QDEF(MP_QSTR_acos, (const byte*)"\x1b\x04" "acos")
+QDEF(MP_QSTR_array, (const byte*)"\x7c\x05" "array")
+QDEF(MP_QSTR_asin, (const byte*)"\x50\x04" "asin")
+QDEF(MP_QSTR_atan, (const byte*)"\x1f\x04" "atan")
+QDEF(MP_QSTR_atan2, (const byte*)"\xcd\x05" "atan2")
+QDEF(MP_QSTR_blit, (const byte*)"\xf6\x04" "blit")
+QDEF(MP_QSTR_bytearray, (const byte*)"\x76\x09" "bytearray")
+QDEF(MP_QSTR_ceil, (const byte*)"\x06\x04" "ceil")
+QDEF(MP_QSTR_cmath, (const byte*)"\xb6\x05" "cmath")
+QDEF(MP_QSTR_collect, (const byte*)"\x9b\x07" "collect")
+QDEF(MP_QSTR_complex, (const byte*)"\xc5\x07" "complex")
+QDEF(MP_QSTR_EOFError, (const byte*)"\x91\x08" "EOFError")
+QDEF(MP_QSTR_Ellipsis, (const byte*)"\xf0\x08" "Ellipsis")
+QDEF(MP_QSTR_Exception, (const byte*)"\xf2\x09" "Exception")
+QDEF(MP_QSTR_FileExistsError, (const byte*)"\x5b\x0f" "FileExistsError")
+QDEF(MP_QSTR_FileNotFoundError, (const byte*)"\x78\x11" "FileNotFoundError")
+QDEF(MP_QSTR_copysign, (const byte*)"\x33\x08" "copysign")
+QDEF(MP_QSTR_cos, (const byte*)"\x7a\x03" "cos")
+QDEF(MP_QSTR_degrees, (const byte*)"\x02\x07" "degrees")
+QDEF(MP_QSTR_disable, (const byte*)"\x91\x07" "disable")
+QDEF(MP_QSTR_draw_line, (const byte*)"\x54\x09" "draw_line")
+QDEF(MP_QSTR_draw_polyline, (const byte*)"\x5e\x0d" "draw_polyline")
+QDEF(MP_QSTR_e, (const byte*)"\xc0\x01" "e")
+QDEF(MP_QSTR_enable, (const byte*)"\x04\x06" "enable")
+QDEF(MP_QSTR_evaluate, (const byte*)"\xbe\x08" "evaluate")
+QDEF(MP_QSTR_exp, (const byte*)"\xc8\x03" "exp")
+QDEF(MP_QSTR_fabs, (const byte*)"\x93\x04" "fabs")
+QDEF(MP_QSTR_fill_rect, (const byte*)"\x35\x09" "fill_rect")
+QDEF(MP_QSTR_float, (const byte*)"\x35\x05" "float")
+QDEF(MP_QSTR_FloatingPointError, (const byte*)"\x01\x12" "FloatingPointError")
+QDEF(MP_QSTR_GeneratorExit, (const byte*)"\x16\x0d" "GeneratorExit")
+QDEF(MP_QSTR_floor, (const byte*)"\x7d\x05" "floor")
+QDEF(MP_QSTR_fmod, (const byte*)"\xe5\x04" "fmod")
+QDEF(MP_QSTR_frexp, (const byte*)"\x1c\x05" "frexp")
+QDEF(MP_QSTR_gc, (const byte*)"\x61\x02" "gc")
+QDEF(MP_QSTR_imag, (const byte*)"\x47\x04" "imag")
+QDEF(MP_QSTR_ImportError, (const byte*)"\x20\x0b" "ImportError")
+QDEF(MP_QSTR_IndentationError, (const byte*)"\x5c\x10" "IndentationError")
+QDEF(MP_QSTR_IndexError, (const byte*)"\x83\x0a" "IndexError")
+QDEF(MP_QSTR_KeyError, (const byte*)"\xea\x08" "KeyError")
+QDEF(MP_QSTR_KeyboardInterrupt, (const byte*)"\xaf\x11" "KeyboardInterrupt")
+QDEF(MP_QSTR_LookupError, (const byte*)"\xff\x0b" "LookupError")
+QDEF(MP_QSTR_MemoryError, (const byte*)"\xdc\x0b" "MemoryError")
+QDEF(MP_QSTR_NameError, (const byte*)"\xba\x09" "NameError")
+QDEF(MP_QSTR_None, (const byte*)"\x6f\x04" "None")
+QDEF(MP_QSTR_NoneType, (const byte*)"\x17\x08" "NoneType")
+QDEF(MP_QSTR_NotImplementedError, (const byte*)"\xc6\x13" "NotImplementedError")
+QDEF(MP_QSTR_OSError, (const byte*)"\xa1\x07" "OSError")
+QDEF(MP_QSTR_OverflowError, (const byte*)"\x81\x0d" "OverflowError")
+QDEF(MP_QSTR_isenabled, (const byte*)"\x9a\x09" "isenabled")
+QDEF(MP_QSTR_isfinite, (const byte*)"\xa6\x08" "isfinite")
+QDEF(MP_QSTR_isinf, (const byte*)"\x3e\x05" "isinf")
+QDEF(MP_QSTR_isnan, (const byte*)"\x9e\x05" "isnan")
+QDEF(MP_QSTR_ldexp, (const byte*)"\x40\x05" "ldexp")
+QDEF(MP_QSTR_log, (const byte*)"\x21\x03" "log")
+QDEF(MP_QSTR_math, (const byte*)"\x35\x04" "math")
+QDEF(MP_QSTR_mem_alloc, (const byte*)"\x52\x09" "mem_alloc")
+QDEF(MP_QSTR_mem_free, (const byte*)"\xcb\x08" "mem_free")
+QDEF(MP_QSTR_memoryview, (const byte*)"\x69\x0a" "memoryview")
+QDEF(MP_QSTR_modf, (const byte*)"\x25\x04" "modf")
+QDEF(MP_QSTR_native, (const byte*)"\x84\x06" "native")
+QDEF(MP_QSTR_phase, (const byte*)"\x6a\x05" "phase")
+QDEF(MP_QSTR_pi, (const byte*)"\x1c\x02" "pi")
+QDEF(MP_QSTR_poincare, (const byte*)"\x08\x08" "poincare")
+QDEF(MP_QSTR_polar, (const byte*)"\x05\x05" "polar")
+QDEF(MP_QSTR_ptr, (const byte*)"\x53\x03" "ptr")
+QDEF(MP_QSTR_ptr16, (const byte*)"\xf4\x05" "ptr16")
+QDEF(MP_QSTR_ptr32, (const byte*)"\xb2\x05" "ptr32")
+QDEF(MP_QSTR_ptr8, (const byte*)"\x8b\x04" "ptr8")
+QDEF(MP_QSTR_radians, (const byte*)"\x87\x07" "radians")
+QDEF(MP_QSTR_real, (const byte*)"\xbf\x04" "real")
+QDEF(MP_QSTR_RuntimeError, (const byte*)"\x61\x0c" "RuntimeError")
+QDEF(MP_QSTR_StopIteration, (const byte*)"\xea\x0d" "StopIteration")
+QDEF(MP_QSTR_SyntaxError, (const byte*)"\x94\x0b" "SyntaxError")
+QDEF(MP_QSTR_SystemExit, (const byte*)"\x20\x0a" "SystemExit")
+QDEF(MP_QSTR_TypeError, (const byte*)"\x25\x09" "TypeError")
+QDEF(MP_QSTR_UnboundLocalError, (const byte*)"\x99\x11" "UnboundLocalError")
+QDEF(MP_QSTR_ValueError, (const byte*)"\x96\x0a" "ValueError")
+QDEF(MP_QSTR_ViperTypeError, (const byte*)"\xdd\x0e" "ViperTypeError")
+QDEF(MP_QSTR_ZeroDivisionError, (const byte*)"\xb6\x11" "ZeroDivisionError")
+QDEF(MP_QSTR__0x0a_, (const byte*)"\xaf\x01" "\x0a")
+QDEF(MP_QSTR__, (const byte*)"\xfa\x01" "_")
+QDEF(MP_QSTR___add__, (const byte*)"\xc4\x07" "__add__")
+QDEF(MP_QSTR___bool__, (const byte*)"\x2b\x08" "__bool__")
+QDEF(MP_QSTR___build_class__, (const byte*)"\x42\x0f" "__build_class__")
+QDEF(MP_QSTR___call__, (const byte*)"\xa7\x08" "__call__")
+QDEF(MP_QSTR___class__, (const byte*)"\x2b\x09" "__class__")
+QDEF(MP_QSTR___contains__, (const byte*)"\xc6\x0c" "__contains__")
+QDEF(MP_QSTR___delitem__, (const byte*)"\xfd\x0b" "__delitem__")
+QDEF(MP_QSTR___enter__, (const byte*)"\x6d\x09" "__enter__")
+QDEF(MP_QSTR___eq__, (const byte*)"\x71\x06" "__eq__")
+QDEF(MP_QSTR___exit__, (const byte*)"\x45\x08" "__exit__")
+QDEF(MP_QSTR___ge__, (const byte*)"\xa7\x06" "__ge__")
+QDEF(MP_QSTR___getattr__, (const byte*)"\x40\x0b" "__getattr__")
+QDEF(MP_QSTR___getitem__, (const byte*)"\x26\x0b" "__getitem__")
+QDEF(MP_QSTR___gt__, (const byte*)"\xb6\x06" "__gt__")
+QDEF(MP_QSTR___hash__, (const byte*)"\xf7\x08" "__hash__")
+QDEF(MP_QSTR___import__, (const byte*)"\x38\x0a" "__import__")
+QDEF(MP_QSTR___init__, (const byte*)"\x5f\x08" "__init__")
+QDEF(MP_QSTR___iter__, (const byte*)"\xcf\x08" "__iter__")
+QDEF(MP_QSTR___le__, (const byte*)"\xcc\x06" "__le__")
+QDEF(MP_QSTR___len__, (const byte*)"\xe2\x07" "__len__")
+QDEF(MP_QSTR___locals__, (const byte*)"\x7b\x0a" "__locals__")
+QDEF(MP_QSTR___lt__, (const byte*)"\x5d\x06" "__lt__")
+QDEF(MP_QSTR___main__, (const byte*)"\x8e\x08" "__main__")
+QDEF(MP_QSTR___module__, (const byte*)"\xff\x0a" "__module__")
+QDEF(MP_QSTR___name__, (const byte*)"\xe2\x08" "__name__")
+QDEF(MP_QSTR___new__, (const byte*)"\x79\x07" "__new__")
+QDEF(MP_QSTR___next__, (const byte*)"\x02\x08" "__next__")
+QDEF(MP_QSTR___path__, (const byte*)"\xc8\x08" "__path__")
+QDEF(MP_QSTR___qualname__, (const byte*)"\x6b\x0c" "__qualname__")
+QDEF(MP_QSTR___repl_print__, (const byte*)"\x01\x0e" "__repl_print__")
+QDEF(MP_QSTR___repr__, (const byte*)"\x10\x08" "__repr__")
+QDEF(MP_QSTR___setitem__, (const byte*)"\x32\x0b" "__setitem__")
+QDEF(MP_QSTR___str__, (const byte*)"\xd0\x07" "__str__")
+QDEF(MP_QSTR___sub__, (const byte*)"\x21\x07" "__sub__")
+QDEF(MP_QSTR___traceback__, (const byte*)"\x4f\x0d" "__traceback__")
+QDEF(MP_QSTR__brace_open__colon__hash_b_brace_close_, (const byte*)"\xf6\x27" "_brace_open__colon__hash_b_brace_close_")
+QDEF(MP_QSTR_abs, (const byte*)"\x95\x03" "abs")
+QDEF(MP_QSTR_all, (const byte*)"\x44\x03" "all")
+QDEF(MP_QSTR_any, (const byte*)"\x13\x03" "any")
+QDEF(MP_QSTR_append, (const byte*)"\x6b\x06" "append")
+QDEF(MP_QSTR_args, (const byte*)"\xc2\x04" "args")
+QDEF(MP_QSTR_bin, (const byte*)"\xe0\x03" "bin")
+QDEF(MP_QSTR_bool, (const byte*)"\xeb\x04" "bool")
+QDEF(MP_QSTR_bound_method, (const byte*)"\x97\x0c" "bound_method")
+QDEF(MP_QSTR_builtins, (const byte*)"\xf7\x08" "builtins")
+QDEF(MP_QSTR_bytecode, (const byte*)"\x22\x08" "bytecode")
+QDEF(MP_QSTR_bytes, (const byte*)"\x5c\x05" "bytes")
+QDEF(MP_QSTR_callable, (const byte*)"\x0d\x08" "callable")
+QDEF(MP_QSTR_chr, (const byte*)"\xdc\x03" "chr")
+QDEF(MP_QSTR_classmethod, (const byte*)"\xb4\x0b" "classmethod")
+QDEF(MP_QSTR_clear, (const byte*)"\x7c\x05" "clear")
+QDEF(MP_QSTR_close, (const byte*)"\x33\x05" "close")
+QDEF(MP_QSTR_closure, (const byte*)"\x74\x07" "closure")
+QDEF(MP_QSTR_color, (const byte*)"\xd8\x05" "color")
+QDEF(MP_QSTR_const, (const byte*)"\xc0\x05" "const")
+QDEF(MP_QSTR_copy, (const byte*)"\xe0\x04" "copy")
+QDEF(MP_QSTR_count, (const byte*)"\xa6\x05" "count")
+QDEF(MP_QSTR_dict, (const byte*)"\x3f\x04" "dict")
+QDEF(MP_QSTR_dict_view, (const byte*)"\x2d\x09" "dict_view")
+QDEF(MP_QSTR_dir, (const byte*)"\xfa\x03" "dir")
+QDEF(MP_QSTR_divmod, (const byte*)"\xb8\x06" "divmod")
+QDEF(MP_QSTR_draw_string, (const byte*)"\xaf\x0b" "draw_string")
+QDEF(MP_QSTR_end, (const byte*)"\x0a\x03" "end")
+QDEF(MP_QSTR_endswith, (const byte*)"\x1b\x08" "endswith")
+QDEF(MP_QSTR_eval, (const byte*)"\x9b\x04" "eval")
+QDEF(MP_QSTR_exec, (const byte*)"\x1e\x04" "exec")
+QDEF(MP_QSTR_extend, (const byte*)"\x63\x06" "extend")
+QDEF(MP_QSTR_find, (const byte*)"\x01\x04" "find")
+QDEF(MP_QSTR_format, (const byte*)"\x26\x06" "format")
+QDEF(MP_QSTR_from_bytes, (const byte*)"\x35\x0a" "from_bytes")
+QDEF(MP_QSTR_fromkeys, (const byte*)"\x37\x08" "fromkeys")
+QDEF(MP_QSTR_function, (const byte*)"\x27\x08" "function")
+QDEF(MP_QSTR_generator, (const byte*)"\x96\x09" "generator")
+QDEF(MP_QSTR_get, (const byte*)"\x33\x03" "get")
+QDEF(MP_QSTR_get_pixel, (const byte*)"\xa4\x09" "get_pixel")
+QDEF(MP_QSTR_getattr, (const byte*)"\xc0\x07" "getattr")
+QDEF(MP_QSTR_globals, (const byte*)"\x9d\x07" "globals")
+QDEF(MP_QSTR_hasattr, (const byte*)"\x8c\x07" "hasattr")
+QDEF(MP_QSTR_hash, (const byte*)"\xb7\x04" "hash")
+QDEF(MP_QSTR_heap_lock, (const byte*)"\xad\x09" "heap_lock")
+QDEF(MP_QSTR_heap_unlock, (const byte*)"\x56\x0b" "heap_unlock")
+QDEF(MP_QSTR_hex, (const byte*)"\x70\x03" "hex")
+QDEF(MP_QSTR_id, (const byte*)"\x28\x02" "id")
+QDEF(MP_QSTR_index, (const byte*)"\x7b\x05" "index")
+QDEF(MP_QSTR_insert, (const byte*)"\x12\x06" "insert")
+QDEF(MP_QSTR_int, (const byte*)"\x16\x03" "int")
+QDEF(MP_QSTR_isalpha, (const byte*)"\xeb\x07" "isalpha")
+QDEF(MP_QSTR_isdigit, (const byte*)"\xa8\x07" "isdigit")
+QDEF(MP_QSTR_isinstance, (const byte*)"\xb6\x0a" "isinstance")
+QDEF(MP_QSTR_islower, (const byte*)"\xfc\x07" "islower")
+QDEF(MP_QSTR_isspace, (const byte*)"\x5b\x07" "isspace")
+QDEF(MP_QSTR_issubclass, (const byte*)"\xb5\x0a" "issubclass")
+QDEF(MP_QSTR_isupper, (const byte*)"\xdd\x07" "isupper")
+QDEF(MP_QSTR_items, (const byte*)"\xe3\x05" "items")
+QDEF(MP_QSTR_iter, (const byte*)"\x8f\x04" "iter")
+QDEF(MP_QSTR_iterator, (const byte*)"\x47\x08" "iterator")
+QDEF(MP_QSTR_join, (const byte*)"\xa7\x04" "join")
+QDEF(MP_QSTR_kandinsky, (const byte*)"\x43\x09" "kandinsky")
+QDEF(MP_QSTR_kbd_intr, (const byte*)"\xf6\x08" "kbd_intr")
+QDEF(MP_QSTR_key, (const byte*)"\x32\x03" "key")
+QDEF(MP_QSTR_keys, (const byte*)"\x01\x04" "keys")
+QDEF(MP_QSTR_len, (const byte*)"\x62\x03" "len")
+QDEF(MP_QSTR_list, (const byte*)"\x27\x04" "list")
+QDEF(MP_QSTR_little, (const byte*)"\x89\x06" "little")
+QDEF(MP_QSTR_locals, (const byte*)"\x3b\x06" "locals")
+QDEF(MP_QSTR_lower, (const byte*)"\xc6\x05" "lower")
+QDEF(MP_QSTR_lstrip, (const byte*)"\xe5\x06" "lstrip")
+QDEF(MP_QSTR_map, (const byte*)"\xb9\x03" "map")
+QDEF(MP_QSTR_maximum_space_recursion_space_depth_space_exceeded, (const byte*)"\x73\x20" "maximum recursion depth exceeded")
+QDEF(MP_QSTR_micropython, (const byte*)"\x0b\x0b" "micropython")
+QDEF(MP_QSTR_module, (const byte*)"\xbf\x06" "module")
+QDEF(MP_QSTR_next, (const byte*)"\x42\x04" "next")
+QDEF(MP_QSTR_object, (const byte*)"\x90\x06" "object")
+QDEF(MP_QSTR_oct, (const byte*)"\xfd\x03" "oct")
+QDEF(MP_QSTR_open, (const byte*)"\xd1\x04" "open")
+QDEF(MP_QSTR_opt_level, (const byte*)"\x87\x09" "opt_level")
+QDEF(MP_QSTR_ord, (const byte*)"\x1c\x03" "ord")
+QDEF(MP_QSTR_pop, (const byte*)"\x2a\x03" "pop")
+QDEF(MP_QSTR_popitem, (const byte*)"\xbf\x07" "popitem")
+QDEF(MP_QSTR_pow, (const byte*)"\x2d\x03" "pow")
+QDEF(MP_QSTR_print, (const byte*)"\x54\x05" "print")
+QDEF(MP_QSTR_range, (const byte*)"\x1a\x05" "range")
+QDEF(MP_QSTR_rect, (const byte*)"\xe5\x04" "rect")
+QDEF(MP_QSTR_remove, (const byte*)"\x63\x06" "remove")
+QDEF(MP_QSTR_replace, (const byte*)"\x49\x07" "replace")
+QDEF(MP_QSTR_repr, (const byte*)"\xd0\x04" "repr")
+QDEF(MP_QSTR_reverse, (const byte*)"\x25\x07" "reverse")
+QDEF(MP_QSTR_rfind, (const byte*)"\xd2\x05" "rfind")
+QDEF(MP_QSTR_rindex, (const byte*)"\xe9\x06" "rindex")
+QDEF(MP_QSTR_round, (const byte*)"\xe7\x05" "round")
+QDEF(MP_QSTR_rsplit, (const byte*)"\xa5\x06" "rsplit")
+QDEF(MP_QSTR_rstrip, (const byte*)"\x3b\x06" "rstrip")
+QDEF(MP_QSTR_schedule, (const byte*)"\xe0\x08" "schedule")
+QDEF(MP_QSTR_send, (const byte*)"\xb9\x04" "send")
+QDEF(MP_QSTR_sep, (const byte*)"\x23\x03" "sep")
+QDEF(MP_QSTR_set_pixel, (const byte*)"\xb0\x09" "set_pixel")
+QDEF(MP_QSTR_setattr, (const byte*)"\xd4\x07" "setattr")
+QDEF(MP_QSTR_setdefault, (const byte*)"\x6c\x0a" "setdefault")
+QDEF(MP_QSTR_sin, (const byte*)"\xb1\x03" "sin")
+QDEF(MP_QSTR_sort, (const byte*)"\xbf\x04" "sort")
+QDEF(MP_QSTR_sorted, (const byte*)"\x5e\x06" "sorted")
+QDEF(MP_QSTR_split, (const byte*)"\xb7\x05" "split")
+QDEF(MP_QSTR_sqrt, (const byte*)"\x21\x04" "sqrt")
+QDEF(MP_QSTR_start, (const byte*)"\x85\x05" "start")
+QDEF(MP_QSTR_startswith, (const byte*)"\x74\x0a" "startswith")
+QDEF(MP_QSTR_staticmethod, (const byte*)"\x62\x0c" "staticmethod")
+QDEF(MP_QSTR_step, (const byte*)"\x57\x04" "step")
+QDEF(MP_QSTR_stop, (const byte*)"\x9d\x04" "stop")
+QDEF(MP_QSTR_str, (const byte*)"\x50\x03" "str")
+QDEF(MP_QSTR_strip, (const byte*)"\x29\x05" "strip")
+QDEF(MP_QSTR_sum, (const byte*)"\x2e\x03" "sum")
+QDEF(MP_QSTR_super, (const byte*)"\xc4\x05" "super")
+QDEF(MP_QSTR_tan, (const byte*)"\xfe\x03" "tan")
+QDEF(MP_QSTR_threshold, (const byte*)"\xf2\x09" "threshold")
+QDEF(MP_QSTR_throw, (const byte*)"\xb3\x05" "throw")
+QDEF(MP_QSTR_to_bytes, (const byte*)"\xd8\x08" "to_bytes")
+QDEF(MP_QSTR_trunc, (const byte*)"\x5b\x05" "trunc")
+QDEF(MP_QSTR_tuple, (const byte*)"\xfd\x05" "tuple")
+QDEF(MP_QSTR_type, (const byte*)"\x9d\x04" "type")
+QDEF(MP_QSTR_uint, (const byte*)"\xe3\x04" "uint")
+QDEF(MP_QSTR_update, (const byte*)"\xb4\x06" "update")
+QDEF(MP_QSTR_upper, (const byte*)"\x27\x05" "upper")
+QDEF(MP_QSTR_utf_hyphen_8, (const byte*)"\xb7\x05" "utf-8")
+QDEF(MP_QSTR_value, (const byte*)"\x4e\x05" "value")
+QDEF(MP_QSTR_values, (const byte*)"\x7d\x06" "values")
+QDEF(MP_QSTR_viper, (const byte*)"\x5d\x05" "viper")
+QDEF(MP_QSTR_zip, (const byte*)"\xe6\x03" "zip")
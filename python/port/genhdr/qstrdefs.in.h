@@ -24,15 +24,41 @@ Q(AssertionError)
 Q(AttributeError)
 Q(BaseException)
 Q(BufferError)
+Q(acos)
+Q(array)
+Q(asin)
+Q(atan)
+Q(atan2)
+Q(blit)
+Q(bytearray)
+Q(ceil)
+Q(cmath)
+Q(collect)
 Q(complex)
 Q(EOFError)
 Q(Ellipsis)
 Q(Exception)
 Q(FileExistsError)
 Q(FileNotFoundError)
+Q(copysign)
+Q(cos)
+Q(degrees)
+Q(disable)
+Q(draw_line)
+Q(draw_polyline)
+Q(e)
+Q(enable)
+Q(evaluate)
+Q(exp)
+Q(fabs)
+Q(fill_rect)
 Q(float)
 Q(FloatingPointError)
 Q(GeneratorExit)
+Q(floor)
+Q(fmod)
+Q(frexp)
+Q(gc)
 Q(imag)
 Q(ImportError)
 Q(IndentationError)
@@ -42,10 +68,32 @@ Q(KeyboardInterrupt)
 Q(LookupError)
 Q(MemoryError)
 Q(NameError)
+Q(None)
 Q(NoneType)
 Q(NotImplementedError)
 Q(OSError)
 Q(OverflowError)
+Q(isenabled)
+Q(isfinite)
+Q(isinf)
+Q(isnan)
+Q(ldexp)
+Q(log)
+Q(math)
+Q(mem_alloc)
+Q(mem_free)
+Q(memoryview)
+Q(modf)
+Q(native)
+Q(phase)
+Q(pi)
+Q(poincare)
+Q(polar)
+Q(ptr)
+Q(ptr16)
+Q(ptr32)
+Q(ptr8)
+Q(radians)
 Q(real)
 Q(RuntimeError)
 Q(StopIteration)
@@ -54,6 +102,7 @@ Q(SystemExit)
 Q(TypeError)
 Q(UnboundLocalError)
 Q(ValueError)
+Q(ViperTypeError)
 Q(ZeroDivisionError)
 Q(\n)
 Q(_)
@@ -189,6 +238,7 @@ Q(popitem)
 Q(pow)
 Q(print)
 Q(range)
+Q(rect)
 Q(remove)
 Q(replace)
 Q(repr)
@@ -204,9 +254,11 @@ Q(sep)
 Q(set_pixel)
 Q(setattr)
 Q(setdefault)
+Q(sin)
 Q(sort)
 Q(sorted)
 Q(split)
+Q(sqrt)
 Q(start)
 Q(startswith)
 Q(staticmethod)
@@ -216,15 +268,20 @@ Q(str)
 Q(strip)
 Q(sum)
 Q(super)
+Q(tan)
+Q(threshold)
 Q(throw)
 Q(to_bytes)
+Q(trunc)
 Q(tuple)
 Q(type)
+Q(uint)
 Q(update)
 Q(upper)
 Q(utf-8)
 Q(value)
 Q(values)
+Q(viper)
 Q(zip)
 Q({:#b})
 
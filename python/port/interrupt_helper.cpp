@@ -2,15 +2,41 @@
 #include <ion.h>
 extern "C" {
 #include "mphalport.h"
+#include "profiler.h"
 }
 
-void shouldInterrupt() {
+static void (*sCheckpointHandler)(void) = nullptr;
+
+void setCheckpointHandler(void (*handler)(void)) {
+  sCheckpointHandler = handler;
+}
+
+/* Reading the clock after each bytecode would slow scripts down, so it is
+ * only read every k_bytecodesBetweenClockReadings bytecodes. */
+static constexpr int k_bytecodesBetweenClockReadings = 1000;
+static constexpr int k_bytecodesBetweenKeyboardScans = 20000;
+static constexpr uint32_t k_checkpointsPerSecond = 20;
+
+void shouldInterrupt(const mp_code_state_t * codeState) {
+  mp_port_profiler_checkpoint(codeState);
   static int c = 0;
   c++;
-  if (c%20000 != 0) {
+  if (c%k_bytecodesBetweenClockReadings != 0) {
+    return;
+  }
+  static uint32_t sLastCheckpointTicks = 0;
+  uint32_t ticks = Ion::Timing::ticks();
+  if (sCheckpointHandler != nullptr && ticks - sLastCheckpointTicks >= Ion::Timing::ticksPerSecond()/k_checkpointsPerSecond) {
+    sLastCheckpointTicks = ticks;
+    sCheckpointHandler();
+  }
+  if (c%k_bytecodesBetweenKeyboardScans != 0) {
     return;
   }
   c = 0;
+  if (mp_interrupt_char < 0) {
+    return;
+  }
   Ion::Keyboard::State scan = Ion::Keyboard::scan();
   if (scan.keyDown((Ion::Keyboard::Key)mp_interrupt_char)) {
     mp_keyboard_interrupt();
@@ -5,10 +5,19 @@
 extern "C" {
 #endif
 
-/* shouldInterrupt effectively does something once every 20000 calls. It checks
- * if a key is down to raise an interruption flag. */
+/* shouldInterrupt is called by the VM after each bytecode, with the state of
+ * the code being run. It hands it to the profiler when that is running, and
+ * otherwise effectively does something once every 20000 calls: it checks if a
+ * key is down to raise an interruption flag. */
 
-void shouldInterrupt();
+struct _mp_code_state_t;
+void shouldInterrupt(const struct _mp_code_state_t * codeState);
+
+/* The checkpoint handler, if any, is called about 20 times per second, however
+ * fast the script runs. It lets the app running a script catch up with what
+ * the script did in the meantime. */
+
+void setCheckpointHandler(void (*handler)(void));
 
 #ifdef __cplusplus
 }
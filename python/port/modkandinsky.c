@@ -5,7 +5,11 @@
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(kandinsky_color_obj, kandinsky_color);
 STATIC MP_DEFINE_CONST_FUN_OBJ_2(kandinsky_get_pixel_obj, kandinsky_get_pixel);
 STATIC MP_DEFINE_CONST_FUN_OBJ_3(kandinsky_set_pixel_obj, kandinsky_set_pixel);
-STATIC MP_DEFINE_CONST_FUN_OBJ_3(kandinsky_draw_string_obj, kandinsky_draw_string);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(kandinsky_draw_string_obj, 3, 5, kandinsky_draw_string);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(kandinsky_fill_rect_obj, 5, 5, kandinsky_fill_rect);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(kandinsky_draw_line_obj, 5, 5, kandinsky_draw_line);
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(kandinsky_draw_polyline_obj, kandinsky_draw_polyline);
+STATIC MP_DEFINE_CONST_FUN_OBJ_VAR_BETWEEN(kandinsky_blit_obj, 5, 5, kandinsky_blit);
 
 STATIC const mp_rom_map_elem_t kandinsky_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_kandinsky) },
@@ -13,6 +17,10 @@ STATIC const mp_rom_map_elem_t kandinsky_module_globals_table[] = {
     { MP_ROM_QSTR(MP_QSTR_get_pixel), (mp_obj_t)&kandinsky_get_pixel_obj },
     { MP_ROM_QSTR(MP_QSTR_set_pixel), (mp_obj_t)&kandinsky_set_pixel_obj },
     { MP_ROM_QSTR(MP_QSTR_draw_string), (mp_obj_t)&kandinsky_draw_string_obj },
+    { MP_ROM_QSTR(MP_QSTR_fill_rect), (mp_obj_t)&kandinsky_fill_rect_obj },
+    { MP_ROM_QSTR(MP_QSTR_draw_line), (mp_obj_t)&kandinsky_draw_line_obj },
+    { MP_ROM_QSTR(MP_QSTR_draw_polyline), (mp_obj_t)&kandinsky_draw_polyline_obj },
+    { MP_ROM_QSTR(MP_QSTR_blit), (mp_obj_t)&kandinsky_blit_obj },
 };
 
 STATIC MP_DEFINE_CONST_DICT(kandinsky_module_globals, kandinsky_module_globals_table);
@@ -2,12 +2,25 @@
 
 /*
  * kandinsky.color(12,0,233);
- * kandinsky.getPixel(x, y);
- * kandinsky.setPixel(x, y, color);
- * kandinsky.drawString(text, x, y);
+ * kandinsky.get_pixel(x, y);
+ * kandinsky.set_pixel(x, y, color);
+ * kandinsky.draw_string(text, x, y[, color[, background]]);
+ * kandinsky.fill_rect(x, y, width, height, color);
+ * kandinsky.draw_line(x1, y1, x2, y2, color);
+ * kandinsky.draw_polyline(((x1, y1), (x2, y2), ...), color);
+ * kandinsky.blit(pixels, x, y, width, height);
+ *
+ * The last four draw a whole shape with a single call, instead of one
+ * interpreter call and one LCD window per pixel. blit reads 16-bit RGB565
+ * pixels from any object exposing a buffer, row by row. draw_polyline also
+ * accepts an array('h') of interleaved coordinates. Both read arrays in place.
  */
 
 mp_obj_t kandinsky_color(mp_obj_t red, mp_obj_t green, mp_obj_t blue);
 mp_obj_t kandinsky_get_pixel(mp_obj_t x, mp_obj_t y);
 mp_obj_t kandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color);
-mp_obj_t kandinsky_draw_string(mp_obj_t text, mp_obj_t x, mp_obj_t y);
+mp_obj_t kandinsky_draw_string(size_t n_args, const mp_obj_t * args);
+mp_obj_t kandinsky_fill_rect(size_t n_args, const mp_obj_t * args);
+mp_obj_t kandinsky_draw_line(size_t n_args, const mp_obj_t * args);
+mp_obj_t kandinsky_draw_polyline(mp_obj_t points, mp_obj_t color);
+mp_obj_t kandinsky_blit(size_t n_args, const mp_obj_t * args);
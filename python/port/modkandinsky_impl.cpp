@@ -1,5 +1,6 @@
 extern "C" {
 #include "modkandinsky.h"
+#include "py/runtime.h"
 }
 #include <kandinsky.h>
 
@@ -28,10 +29,89 @@ mp_obj_t kandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t color) {
   return mp_const_none;
 }
 
-mp_obj_t kandinsky_draw_string(mp_obj_t text, mp_obj_t x, mp_obj_t y) {
+static KDColor colorFromObj(mp_obj_t color) {
+  return KDColor::RGB16(mp_obj_get_int(color));
+}
+
+mp_obj_t kandinsky_draw_string(size_t n_args, const mp_obj_t * args) {
   KDIonContext::sharedContext()->drawString(
-    mp_obj_str_get_str(text),
-    KDPoint(mp_obj_get_int(x), mp_obj_get_int(y))
+    mp_obj_str_get_str(args[0]),
+    KDPoint(mp_obj_get_int(args[1]), mp_obj_get_int(args[2])),
+    KDText::FontSize::Large,
+    n_args > 3 ? colorFromObj(args[3]) : KDColorBlack,
+    n_args > 4 ? colorFromObj(args[4]) : KDColorWhite
   );
   return mp_const_none;
 }
+
+mp_obj_t kandinsky_fill_rect(size_t n_args, const mp_obj_t * args) {
+  KDIonContext::sharedContext()->fillRect(
+    KDRect(mp_obj_get_int(args[0]), mp_obj_get_int(args[1]), mp_obj_get_int(args[2]), mp_obj_get_int(args[3])),
+    colorFromObj(args[4])
+  );
+  return mp_const_none;
+}
+
+mp_obj_t kandinsky_draw_line(size_t n_args, const mp_obj_t * args) {
+  KDPoint p1(mp_obj_get_int(args[0]), mp_obj_get_int(args[1]));
+  KDPoint p2(mp_obj_get_int(args[2]), mp_obj_get_int(args[3]));
+  KDColor c = colorFromObj(args[4]);
+  KDContext * ctx = KDIonContext::sharedContext();
+  // KDContext::drawLine omits the last point
+  ctx->drawLine(p1, p2, c);
+  ctx->setPixel(p2, c);
+  return mp_const_none;
+}
+
+static KDPoint pointFromObj(mp_obj_t point) {
+  mp_obj_t * coordinates;
+  mp_obj_get_array_fixed_n(point, 2, &coordinates);
+  return KDPoint(mp_obj_get_int(coordinates[0]), mp_obj_get_int(coordinates[1]));
+}
+
+mp_obj_t kandinsky_draw_polyline(mp_obj_t points, mp_obj_t color) {
+  KDColor c = colorFromObj(color);
+  KDContext * ctx = KDIonContext::sharedContext();
+  /* An array('h') of interleaved x and y coordinates is read in place, without
+   * creating any Python object. */
+  mp_buffer_info_t bufferInfo;
+  if (mp_get_buffer(points, &bufferInfo, MP_BUFFER_READ) && bufferInfo.typecode == 'h') {
+    const int16_t * coordinates = (const int16_t *)bufferInfo.buf;
+    size_t numberOfPoints = bufferInfo.len/(2*sizeof(int16_t));
+    if (numberOfPoints == 0) {
+      return mp_const_none;
+    }
+    for (size_t i = 1; i < numberOfPoints; i++) {
+      ctx->drawLine(KDPoint(coordinates[2*i-2], coordinates[2*i-1]), KDPoint(coordinates[2*i], coordinates[2*i+1]), c);
+    }
+    ctx->setPixel(KDPoint(coordinates[2*numberOfPoints-2], coordinates[2*numberOfPoints-1]), c);
+    return mp_const_none;
+  }
+  size_t numberOfPoints;
+  mp_obj_t * items;
+  mp_obj_get_array(points, &numberOfPoints, &items);
+  if (numberOfPoints == 0) {
+    return mp_const_none;
+  }
+  KDPoint previous = pointFromObj(items[0]);
+  for (size_t i = 1; i < numberOfPoints; i++) {
+    KDPoint p = pointFromObj(items[i]);
+    ctx->drawLine(previous, p, c);
+    previous = p;
+  }
+  ctx->setPixel(previous, c);
+  return mp_const_none;
+}
+
+mp_obj_t kandinsky_blit(size_t n_args, const mp_obj_t * args) {
+  mp_buffer_info_t bufferInfo;
+  mp_get_buffer_raise(args[0], &bufferInfo, MP_BUFFER_READ);
+  KDRect rect(mp_obj_get_int(args[1]), mp_obj_get_int(args[2]), mp_obj_get_int(args[3]), mp_obj_get_int(args[4]));
+  if (rect.width() < 0 || rect.height() < 0 || bufferInfo.len < (size_t)rect.width()*rect.height()*sizeof(KDColor)) {
+    mp_raise_ValueError("buffer too small");
+  }
+  /* Without a working buffer, clipped pixels are pushed row by row, which
+   * doesn't use any heap. */
+  KDIonContext::sharedContext()->fillRectWithPixels(rect, (const KDColor *)bufferInfo.buf, nullptr);
+  return mp_const_none;
+}
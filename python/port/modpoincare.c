@@ -0,0 +1,17 @@
+#include "py/obj.h"
+#include "py/mphal.h"
+#include "modpoincare.h"
+
+STATIC MP_DEFINE_CONST_FUN_OBJ_2(poincare_evaluate_obj, poincare_evaluate);
+
+STATIC const mp_rom_map_elem_t poincare_module_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_poincare) },
+    { MP_ROM_QSTR(MP_QSTR_evaluate), (mp_obj_t)&poincare_evaluate_obj },
+};
+
+STATIC MP_DEFINE_CONST_DICT(poincare_module_globals, poincare_module_globals_table);
+
+const mp_obj_module_t poincare_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&poincare_module_globals,
+};
@@ -0,0 +1,13 @@
+#include "py/obj.h"
+
+/*
+ * poincare.evaluate(expression, abscissae);
+ *
+ * Parses expression once, the way the calculation and graph apps do, and
+ * evaluates it for each value of x in abscissae. abscissae is either an array
+ * of floats, read in place, or any sequence of numbers. The result is an array
+ * of the same length: array('d') if abscissae is one, array('f') otherwise.
+ * pi may be spelled out. Variables A to Z are 0, as in a fresh calculator.
+ */
+
+mp_obj_t poincare_evaluate(mp_obj_t expression, mp_obj_t abscissae);
@@ -0,0 +1,84 @@
+extern "C" {
+#include "modpoincare.h"
+#include "py/objarray.h"
+#include "py/runtime.h"
+}
+#include <poincare.h>
+#include <ion/charset.h>
+#include <string.h>
+
+static constexpr size_t k_maxExpressionLength = 255;
+
+template<typename T>
+static void evaluateInPlace(const char * text, T * values, size_t length) {
+  Poincare::Expression * expression = Poincare::Expression::parse(text);
+  if (expression == nullptr) {
+    mp_raise_ValueError("invalid expression");
+  }
+  /* Symbols other than x are looked up in a fresh global context, which
+   * provides pi and e. */
+  Poincare::GlobalContext globalContext;
+  Poincare::CompiledExpression compiledExpression(expression, 'x', globalContext);
+  for (size_t i = 0; i < length; i++) {
+    values[i] = compiledExpression.approximate<T>(values[i]);
+  }
+  delete expression;
+}
+
+static mp_obj_array_t * newArray(char typecode, size_t length, size_t itemSize) {
+  mp_obj_array_t * array = m_new_obj(mp_obj_array_t);
+  array->base.type = &mp_type_array;
+  array->typecode = typecode;
+  array->free = 0;
+  array->len = length;
+  array->items = m_new(byte, itemSize * length);
+  return array;
+}
+
+mp_obj_t poincare_evaluate(mp_obj_t expression, mp_obj_t abscissae) {
+  // Scripts can't easily type the calculator's pi character, so accept "pi"
+  size_t textLength;
+  const char * source = mp_obj_str_get_data(expression, &textLength);
+  if (textLength > k_maxExpressionLength) {
+    mp_raise_ValueError("expression too long");
+  }
+  char text[k_maxExpressionLength+1];
+  size_t j = 0;
+  for (size_t i = 0; i < textLength; i++) {
+    if (source[i] == 'p' && i+1 < textLength && source[i+1] == 'i') {
+      text[j++] = Ion::Charset::SmallPi;
+      i++;
+    } else {
+      text[j++] = source[i];
+    }
+  }
+  text[j] = 0;
+  /* All Python objects are read before the expression is parsed: nothing can
+   * raise while the parsed expression is alive, so it can't leak. */
+  mp_buffer_info_t bufinfo;
+  if (mp_get_buffer(abscissae, &bufinfo, MP_BUFFER_READ) && bufinfo.typecode == 'd') {
+    size_t length = bufinfo.len / sizeof(double);
+    mp_obj_array_t * result = newArray('d', length, sizeof(double));
+    memcpy(result->items, bufinfo.buf, length * sizeof(double));
+    evaluateInPlace<double>(text, (double *)result->items, length);
+    return MP_OBJ_FROM_PTR(result);
+  }
+  if (mp_get_buffer(abscissae, &bufinfo, MP_BUFFER_READ) && bufinfo.typecode == 'f') {
+    size_t length = bufinfo.len / sizeof(float);
+    mp_obj_array_t * result = newArray('f', length, sizeof(float));
+    memcpy(result->items, bufinfo.buf, length * sizeof(float));
+    evaluateInPlace<float>(text, (float *)result->items, length);
+    return MP_OBJ_FROM_PTR(result);
+  }
+  size_t length = mp_obj_get_int(mp_obj_len(abscissae));
+  mp_obj_array_t * result = newArray('f', length, sizeof(float));
+  float * values = (float *)result->items;
+  mp_obj_iter_buf_t iterBuf;
+  mp_obj_t iterable = mp_getiter(abscissae, &iterBuf);
+  mp_obj_t item;
+  for (size_t i = 0; i < length && (item = mp_iternext(iterable)) != MP_OBJ_STOP_ITERATION; i++) {
+    values[i] = mp_obj_get_float(item);
+  }
+  evaluateInPlace<float>(text, values, length);
+  return MP_OBJ_FROM_PTR(result);
+}
@@ -0,0 +1,57 @@
+# Pseudo-random number generator, frozen into the firmware as bytecode.
+#
+# Small ints are 31 bits wide and there is no long int support, so the
+# generator is a 24-bit linear congruential generator whose multiplication is
+# split in 12-bit halves to never overflow.
+
+_A_HIGH = 0xfd4
+_A_LOW = 0x3fd
+_C = 0xc39ec3
+_state = 0x50000
+
+def seed(a=0):
+    global _state
+    _state = a & 0xffffff
+
+def _next():
+    global _state
+    high = _state >> 12
+    low = _state & 0xfff
+    _state = (low * _A_LOW + (((high * _A_LOW + low * _A_HIGH) & 0xfff) << 12) + _C) & 0xffffff
+    return _state
+
+def getrandbits(k):
+    if k <= 0 or k > 30:
+        raise ValueError
+    if k > 24:
+        return (_next() >> (48 - k)) << 24 | _next()
+    return _next() >> (24 - k)
+
+def _randbelow(n):
+    if n <= 0:
+        raise ValueError
+    k = 1
+    while (1 << k) < n:
+        k += 1
+    r = getrandbits(k)
+    while r >= n:
+        r = getrandbits(k)
+    return r
+
+def random():
+    return getrandbits(24) / 16777216
+
+def uniform(a, b):
+    return a + (b - a) * random()
+
+def randrange(start, stop=None, step=1):
+    if stop is None:
+        return _randbelow(start)
+    n = (stop - start + step - 1) // step if step > 0 else (stop - start + step + 1) // step
+    return start + step * _randbelow(n)
+
+def randint(a, b):
+    return a + _randbelow(b - a + 1)
+
+def choice(seq):
+    return seq[_randbelow(len(seq))]
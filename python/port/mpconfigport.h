@@ -8,11 +8,22 @@
 #define MICROPY_ENABLE_COMPILER     (1)
 
 #define MICROPY_QSTR_BYTES_IN_HASH  (1)
-//#define MICROPY_QSTR_EXTRA_POOL     mp_qstr_frozen_const_pool
+#define MICROPY_QSTR_EXTRA_POOL     mp_qstr_frozen_const_pool
 #define MICROPY_ALLOC_PATH_MAX      (256)
 #define MICROPY_ALLOC_PARSE_CHUNK_INIT (16)
+/* The native emitters back the @micropython.native and @micropython.viper
+ * decorators: x64 when running on the host (blackbox and simulator), Thumb on
+ * the device. */
+#if defined(__x86_64__) && !defined(_WIN32)
+#define MICROPY_EMIT_X64            (1)
+#else
 #define MICROPY_EMIT_X64            (0)
+#endif
+#if defined(__thumb2__)
+#define MICROPY_EMIT_THUMB          (1)
+#else
 #define MICROPY_EMIT_THUMB          (0)
+#endif
 #define MICROPY_EMIT_INLINE_THUMB   (0)
 #define MICROPY_COMP_MODULE_CONST   (0)
 #define MICROPY_COMP_CONST          (0)
@@ -21,17 +32,17 @@
 #define MICROPY_MEM_STATS           (0)
 #define MICROPY_DEBUG_PRINTERS      (0)
 #define MICROPY_ENABLE_GC           (1)
-#define MICROPY_GC_ALLOC_THRESHOLD  (0)
+#define MICROPY_GC_ALLOC_THRESHOLD  (1)
 #define MICROPY_REPL_EVENT_DRIVEN   (0)
 #define MICROPY_HELPER_REPL         (1)
 #define MICROPY_HELPER_LEXER_UNIX   (0)
-#define MICROPY_ENABLE_SOURCE_LINE  (0)
+#define MICROPY_ENABLE_SOURCE_LINE  (1)
 #define MICROPY_ENABLE_DOC_STRING   (0)
 #define MICROPY_ERROR_REPORTING     (MICROPY_ERROR_REPORTING_TERSE)
 #define MICROPY_BUILTIN_METHOD_CHECK_SELF_ARG (0)
 #define MICROPY_PY_ASYNC_AWAIT      (0)
-#define MICROPY_PY_BUILTINS_BYTEARRAY (0)
-#define MICROPY_PY_BUILTINS_MEMORYVIEW (0)
+#define MICROPY_PY_BUILTINS_BYTEARRAY (1)
+#define MICROPY_PY_BUILTINS_MEMORYVIEW (1)
 #define MICROPY_PY_BUILTINS_ENUMERATE (0)
 #define MICROPY_PY_BUILTINS_FILTER  (0)
 #define MICROPY_PY_BUILTINS_FROZENSET (0)
@@ -41,23 +52,27 @@
 #define MICROPY_PY_BUILTINS_PROPERTY (0)
 #define MICROPY_PY_BUILTINS_MIN_MAX (0)
 #define MICROPY_PY___FILE__         (0)
-#define MICROPY_PY_GC               (0)
-#define MICROPY_PY_ARRAY            (0)
+#define MICROPY_PY_GC               (1)
+#define MICROPY_PY_GC_COLLECT_RETVAL (1)
+#define MICROPY_PY_ARRAY            (1)
 #define MICROPY_PY_ATTRTUPLE        (0)
 #define MICROPY_PY_COLLECTIONS      (0)
-#define MICROPY_PY_MATH             (0)
-#define MICROPY_PY_CMATH            (0)
+#define MICROPY_PY_MATH             (1)
+#define MICROPY_PY_CMATH            (1)
 #define MICROPY_PY_IO               (0)
 #define MICROPY_PY_STRUCT           (0)
 #define MICROPY_PY_SYS              (0)
-#define MICROPY_MODULE_FROZEN_MPY   (0)
+#define MICROPY_MODULE_FROZEN_MPY   (1)
 #define MICROPY_CPYTHON_COMPAT      (0)
 #define MICROPY_LONGINT_IMPL        (MICROPY_LONGINT_IMPL_NONE)
 #define MICROPY_FLOAT_IMPL          (MICROPY_FLOAT_IMPL_FLOAT)
 
 // type definitions for the specific machine
 
+// Thumb code is called through addresses with the lowest bit set
+#if defined(__thumb__)
 #define MICROPY_MAKE_POINTER_CALLABLE(p) ((void*)((mp_uint_t)(p) | 1))
+#endif
 
 // This port is intended to be 32-bit, but unfortunately, int32_t for
 // different targets may be defined in different ways - either as int
@@ -95,13 +110,28 @@ typedef long mp_off_t;
 
 #define MP_STATE_PORT MP_STATE_VM
 
+/* On the host, the Python heap isn't executable so native code is written to a
+ * dedicated region, which is recycled each time the interpreter is reset. On
+ * the device, the RAM is executable and native code simply lives on the heap. */
+#if MICROPY_EMIT_X64
+void mp_port_alloc_exec(size_t min_size, void **ptr, size_t *size);
+void mp_port_free_exec(void *ptr, size_t size);
+void mp_port_reset_exec(void);
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size) mp_port_alloc_exec(min_size, ptr, size)
+#define MP_PLAT_FREE_EXEC(ptr, size) mp_port_free_exec(ptr, size)
+#define MICROPY_PORT_INIT_FUNC mp_port_reset_exec()
+#define MICROPY_PORT_DEINIT_FUNC mp_port_reset_exec()
+#endif
+
 #define MICROPY_PORT_ROOT_POINTERS \
     const char *readline_hist[8];
 
 
 extern const struct _mp_obj_module_t kandinsky_module;
+extern const struct _mp_obj_module_t poincare_module;
 
 #define MICROPY_PORT_BUILTIN_MODULES \
-    { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&kandinsky_module) }
+    { MP_ROM_QSTR(MP_QSTR_kandinsky), MP_ROM_PTR(&kandinsky_module) }, \
+    { MP_ROM_QSTR(MP_QSTR_poincare), MP_ROM_PTR(&poincare_module) }
 
 #define MICROPY_KBD_EXCEPTION       (1)
@@ -17,3 +17,10 @@ void mp_keyboard_interrupt(void) {
 }
 
 #endif
+
+// Defined by Ion, see Ion::Timing::microseconds
+uint32_t ion_microseconds(void);
+
+mp_uint_t mp_hal_ticks_us(void) {
+  return ion_microseconds();
+}
@@ -1,6 +1,44 @@
 #ifndef PYTHON_PORT_H
 #define PYTHON_PORT_H
 
-void mp_port_init_stack_top();
+#include <stddef.h>
+#include <stdint.h>
+
+/* The collector looks for Python objects on the stack up to top. It must be
+ * the address of a local variable of a function that encloses every call into
+ * the interpreter, so that the frames of these calls are all below it. */
+void mp_port_init_stack_top(void * top);
+
+/* The Python heap is a single block taken from liba's allocator when a script
+ * is launched. It gets as much memory as the allocator can hand out, within
+ * these bounds. MicroPython's GC manages one contiguous area, so the heap can't
+ * be extended once the script runs.
+ * A block of at least the headroom is left to the allocator: escher and the
+ * poincare module keep allocating while the script runs, for instance to parse
+ * expressions. */
+#define MP_PORT_HEAP_MIN_SIZE (8*1024)
+#define MP_PORT_HEAP_MAX_SIZE (64*1024)
+#define MP_PORT_HEAP_CHUNK_SIZE (4*1024)
+#define MP_PORT_HEAP_HEADROOM (4*1024)
+
+/* Returns the heap size to use given the largest block malloc can provide, or
+ * 0 if that's not enough to run a script. max_available_after returns the
+ * largest block left once a heap of the given size is allocated, see
+ * malloc_max_available_after. */
+size_t mp_port_heap_size(size_t max_available, size_t (*max_available_after)(size_t size));
+
+/* Like gc_init, but also sets the automatic collection threshold and resets
+ * the statistics below. */
+void mp_port_gc_init(void * start, void * end);
+
+typedef struct {
+  size_t heap_size;
+  uint32_t collections;
+  uint32_t last_pause_us;
+  uint32_t max_pause_us;
+  uint32_t total_pause_us;
+} mp_port_gc_stats_t;
+
+const mp_port_gc_stats_t * mp_port_gc_stats();
 
 #endif
@@ -0,0 +1,206 @@
+#include <string.h>
+#include "py/mphal.h"
+#include "profiler.h"
+
+static bool profiler_running = false;
+static mp_port_profiler_line_t profiler_lines[MP_PORT_PROFILER_MAX_LINES];
+static size_t profiler_number_of_lines = 0;
+static uint32_t profiler_dropped_bytecodes = 0;
+
+/* Looking up the line and reading the clock after each bytecode would make
+ * scripts several times slower. Instead, the location is sampled every 64
+ * bytecodes on average, and the bytecodes and time since the previous sample
+ * are charged to it. The period is jittered so that it can't follow the
+ * period of a loop and always land on the same line. */
+static uint32_t profiler_random = 0;
+static int profiler_sample_period = 0;
+static int profiler_bytecodes_until_sample = 0;
+static mp_uint_t profiler_last_ticks = 0;
+
+static int next_sample_period() {
+  profiler_random = profiler_random * 1103515245 + 12345;
+  return 32 + ((profiler_random >> 16) & 0x3F);
+}
+
+/* Samples in a loop often land on the line of the previous one: the bytecode
+ * range of the last line is kept to skip decoding it again. */
+static const mp_obj_fun_bc_t * profiler_line_function = NULL;
+static const byte * profiler_line_start = NULL;
+static const byte * profiler_line_end = NULL;
+static mp_port_profiler_line_t * profiler_current_line = NULL;
+
+void mp_port_profiler_start() {
+  profiler_number_of_lines = 0;
+  profiler_dropped_bytecodes = 0;
+  profiler_line_function = NULL;
+  profiler_current_line = NULL;
+  profiler_random = 0;
+  profiler_sample_period = next_sample_period();
+  profiler_bytecodes_until_sample = profiler_sample_period;
+  profiler_last_ticks = mp_hal_ticks_us();
+  profiler_running = true;
+}
+
+static int compare_lines(const mp_port_profiler_line_t * a, const mp_port_profiler_line_t * b) {
+  if (a->bytecodes != b->bytecodes) {
+    return a->bytecodes > b->bytecodes ? -1 : 1;
+  }
+  return a->line < b->line ? -1 : a->line > b->line;
+}
+
+void mp_port_profiler_stop() {
+  profiler_running = false;
+  profiler_line_function = NULL;
+  profiler_current_line = NULL;
+  // Insertion sort, there are only a few lines
+  for (size_t i = 1; i < profiler_number_of_lines; i++) {
+    mp_port_profiler_line_t line = profiler_lines[i];
+    size_t j = i;
+    while (j > 0 && compare_lines(&line, &profiler_lines[j-1]) < 0) {
+      profiler_lines[j] = profiler_lines[j-1];
+      j--;
+    }
+    profiler_lines[j] = line;
+  }
+}
+
+bool mp_port_profiler_is_running() {
+  return profiler_running;
+}
+
+/* Same decoding as the VM does for tracebacks, which also finds the range of
+ * bytecode generated for the line */
+static size_t source_line(const mp_code_state_t * code_state, qstr * block_name, const byte ** start, const byte ** end) {
+  const byte * ip = code_state->fun_bc->bytecode;
+  ip = mp_decode_uint_skip(ip); // skip n_state
+  ip = mp_decode_uint_skip(ip); // skip n_exc_stack
+  ip += 4; // skip scope_params, n_pos_args, n_kwonly_args and n_def_pos_args
+  size_t bc = code_state->ip - ip;
+  size_t code_info_size = mp_decode_uint_value(ip);
+  const byte * code = ip + code_info_size;
+  ip = mp_decode_uint_skip(ip);
+  bc -= code_info_size;
+#if MICROPY_PERSISTENT_CODE
+  *block_name = ip[0] | (ip[1] << 8);
+  ip += 4;
+#else
+  *block_name = mp_decode_uint_value(ip);
+  ip = mp_decode_uint_skip(ip);
+  ip = mp_decode_uint_skip(ip);
+#endif
+  size_t line = 1;
+  *start = code;
+  *end = NULL;
+  size_t c;
+  while ((c = *ip)) {
+    size_t b, l;
+    if ((c & 0x80) == 0) {
+      b = c & 0x1f;
+      l = c >> 5;
+      ip += 1;
+    } else {
+      b = c & 0xf;
+      l = ((c << 4) & 0x700) | ip[1];
+      ip += 2;
+    }
+    if (bc < b) {
+      *end = *start + b;
+      break;
+    }
+    bc -= b;
+    *start += b;
+    line += l;
+  }
+  if (*end == NULL) {
+    // The last line runs to the end of the bytecode
+    *end = (const byte *)-1;
+  }
+  return line;
+}
+
+static mp_port_profiler_line_t * find_line(const mp_code_state_t * code_state) {
+  qstr block_name;
+  size_t line = source_line(code_state, &block_name, &profiler_line_start, &profiler_line_end);
+  for (size_t i = 0; i < profiler_number_of_lines; i++) {
+    if (profiler_lines[i].line == line && profiler_lines[i].block_name == block_name) {
+      return &profiler_lines[i];
+    }
+  }
+  if (profiler_number_of_lines == MP_PORT_PROFILER_MAX_LINES) {
+    return NULL;
+  }
+  mp_port_profiler_line_t * l = &profiler_lines[profiler_number_of_lines++];
+  l->block_name = block_name;
+  strlcpy(l->function, qstr_str(block_name), sizeof(l->function));
+  l->line = line;
+  l->bytecodes = 0;
+  l->time_us = 0;
+  return l;
+}
+
+void mp_port_profiler_checkpoint(const mp_code_state_t * code_state) {
+  if (!profiler_running || --profiler_bytecodes_until_sample > 0) {
+    return;
+  }
+  uint32_t bytecodes = profiler_sample_period;
+  profiler_sample_period = next_sample_period();
+  profiler_bytecodes_until_sample = profiler_sample_period;
+  mp_uint_t ticks = mp_hal_ticks_us();
+  mp_uint_t elapsed = ticks - profiler_last_ticks;
+  profiler_last_ticks = ticks;
+  mp_port_profiler_line_t * line = profiler_current_line;
+  if (code_state->fun_bc != profiler_line_function || code_state->ip < profiler_line_start || code_state->ip >= profiler_line_end) {
+    line = find_line(code_state);
+    profiler_line_function = code_state->fun_bc;
+    profiler_current_line = line;
+  }
+  if (line == NULL) {
+    profiler_dropped_bytecodes += bytecodes;
+    return;
+  }
+  line->bytecodes += bytecodes;
+  line->time_us += elapsed;
+}
+
+size_t mp_port_profiler_number_of_lines() {
+  return profiler_number_of_lines;
+}
+
+const mp_port_profiler_line_t * mp_port_profiler_line(size_t i) {
+  return &profiler_lines[i];
+}
+
+uint32_t mp_port_profiler_dropped_bytecodes() {
+  return profiler_dropped_bytecodes;
+}
+
+void mp_port_profiler_print(const mp_print_t * print, size_t max_number_of_lines) {
+  mp_printf(print, " line   count     ms function\n");
+  for (size_t i = 0; i < profiler_number_of_lines && i < max_number_of_lines; i++) {
+    const mp_port_profiler_line_t * l = &profiler_lines[i];
+    mp_printf(print, "%5u %7u %6u %s\n", (unsigned)l->line, (unsigned)l->bytecodes, (unsigned)(l->time_us/1000), l->function);
+  }
+  mp_printf(print, "function     count     ms\n");
+  for (size_t i = 0; i < profiler_number_of_lines; i++) {
+    qstr block_name = profiler_lines[i].block_name;
+    bool alreadyPrinted = false;
+    for (size_t j = 0; j < i; j++) {
+      alreadyPrinted |= profiler_lines[j].block_name == block_name;
+    }
+    if (alreadyPrinted) {
+      continue;
+    }
+    uint32_t bytecodes = 0;
+    uint32_t time_us = 0;
+    for (size_t j = i; j < profiler_number_of_lines; j++) {
+      if (profiler_lines[j].block_name == block_name) {
+        bytecodes += profiler_lines[j].bytecodes;
+        time_us += profiler_lines[j].time_us;
+      }
+    }
+    mp_printf(print, "%-10s %7u %6u\n", profiler_lines[i].function, (unsigned)bytecodes, (unsigned)(time_us/1000));
+  }
+  if (profiler_dropped_bytecodes > 0) {
+    mp_printf(print, "dropped    %7u\n", (unsigned)profiler_dropped_bytecodes);
+  }
+}
@@ -0,0 +1,45 @@
+#ifndef PYTHON_PROFILER_H
+#define PYTHON_PROFILER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "py/bc.h"
+#include "py/mpprint.h"
+
+/* While it runs, the profiler is handed the VM state after each bytecode by the
+ * interrupt helper. It samples the source line and function the VM is at every
+ * few bytecodes, and charges them the bytecodes run and the time elapsed since
+ * the previous sample: counts per line are estimates, totals are exact up to
+ * the last sample. Native and viper functions don't go through the VM and
+ * aren't accounted for.
+ * Locations are decoded while the script runs and function names are copied,
+ * as bytecode and qstrs are freed with the Python heap. Lines beyond
+ * MP_PORT_PROFILER_MAX_LINES are counted as dropped. */
+
+#define MP_PORT_PROFILER_MAX_LINES 48
+#define MP_PORT_PROFILER_NAME_LENGTH 10
+
+typedef struct {
+  qstr block_name;
+  char function[MP_PORT_PROFILER_NAME_LENGTH+1];
+  uint16_t line;
+  uint32_t bytecodes;
+  uint32_t time_us;
+} mp_port_profiler_line_t;
+
+void mp_port_profiler_start();
+void mp_port_profiler_stop();
+bool mp_port_profiler_is_running();
+void mp_port_profiler_checkpoint(const mp_code_state_t * code_state);
+
+/* Once stopped, lines are sorted by decreasing number of bytecodes. */
+size_t mp_port_profiler_number_of_lines();
+const mp_port_profiler_line_t * mp_port_profiler_line(size_t i);
+uint32_t mp_port_profiler_dropped_bytecodes();
+
+/* Prints the busiest lines, then the totals per function, on lines of at most
+ * 32 characters. */
+void mp_port_profiler_print(const mp_print_t * print, size_t max_number_of_lines);
+
+#endif
@@ -0,0 +1,99 @@
+/* mpy-cross compiles Python source files to .mpy bytecode files on the host.
+ * The bytecode is then frozen into the firmware by tools/mpy-tool.py.
+ *
+ * Usage: mpy-cross [-o output.mpy] [-s source_name] [-msmall-int-bits=N] input.py */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "py/compile.h"
+#include "py/persistentcode.h"
+#include "py/runtime.h"
+#include "py/stackctrl.h"
+#include "py/mperrno.h"
+#include "interrupt_helper.h"
+
+STATIC void stderr_print_strn(void *env, const char *str, size_t len) {
+    (void)env;
+    fwrite(str, 1, len, stderr);
+}
+
+STATIC const mp_print_t mp_stderr_print = {NULL, stderr_print_strn};
+
+STATIC int compile_and_save(const char *file, const char *output_file, const char *source_file) {
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_lexer_t *lex = mp_lexer_new_from_file(file);
+        qstr source_name = (source_file == NULL) ? lex->source_name : qstr_from_str(source_file);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_raw_code_t *rc = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+        mp_raw_code_save_file(rc, output_file);
+        nlr_pop();
+        return 0;
+    } else {
+        // uncaught exception
+        mp_obj_print_exception(&mp_stderr_print, (mp_obj_t)nlr.ret_val);
+        return 1;
+    }
+}
+
+STATIC int usage(const char *progname) {
+    fprintf(stderr, "usage: %s [-o output.mpy] [-s source_name] [-msmall-int-bits=N] input.py\n", progname);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    mp_stack_ctrl_init();
+    mp_stack_set_limit(40000 * (sizeof(void*) / 4));
+    mp_init();
+
+    mp_dynamic_compiler.small_int_bits = 31;
+    mp_dynamic_compiler.opt_cache_map_lookup_in_bytecode = 0;
+    mp_dynamic_compiler.py_builtins_str_unicode = 0;
+
+    const char *input_file = NULL;
+    const char *output_file = NULL;
+    const char *source_file = NULL;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "-o") == 0 && a + 1 < argc) {
+            output_file = argv[++a];
+        } else if (strcmp(argv[a], "-s") == 0 && a + 1 < argc) {
+            source_file = argv[++a];
+        } else if (strncmp(argv[a], "-msmall-int-bits=", sizeof("-msmall-int-bits=") - 1) == 0) {
+            mp_dynamic_compiler.small_int_bits = atoi(argv[a] + sizeof("-msmall-int-bits=") - 1);
+        } else if (argv[a][0] == '-' || input_file != NULL) {
+            return usage(argv[0]);
+        } else {
+            input_file = argv[a];
+        }
+    }
+    if (input_file == NULL || output_file == NULL) {
+        return usage(argv[0]);
+    }
+
+    int ret = compile_and_save(input_file, output_file, source_file);
+
+    mp_deinit();
+    return ret;
+}
+
+mp_import_stat_t mp_import_stat(const char *path) {
+    (void)path;
+    return MP_IMPORT_STAT_NO_EXIST;
+}
+
+mp_obj_t mp_builtin_open(size_t n_args, const mp_obj_t *args, mp_map_t *kwargs) {
+    return mp_const_none;
+}
+MP_DEFINE_CONST_FUN_OBJ_KW(mp_builtin_open_obj, 1, mp_builtin_open);
+
+void nlr_jump_fail(void *val) {
+    fprintf(stderr, "FATAL: uncaught NLR %p\n", val);
+    exit(1);
+}
+
+/* mpy-cross never executes bytecode, but vm.c calls into the port's interrupt
+ * helper. */
+void shouldInterrupt(const struct _mp_code_state_t * codeState) {
+}
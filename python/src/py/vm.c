@@ -1287,7 +1287,7 @@ pending_exception_check:
  * shouldInterrupt every now and then in the loop executing byte code without
  * editing this file.
  * Begining of the edited part */
-                shouldInterrupt();
+                shouldInterrupt(code_state);
 /* End of the edited part */
 
                 #if MICROPY_ENABLE_SCHEDULER
@@ -0,0 +1,434 @@
+#!/usr/bin/env python
+#
+# Converts .mpy files produced by mpy-cross into a C source file that can be
+# linked into the firmware. The bytecode, constant tables and raw code
+# descriptors all end up in read-only memory, and importing a frozen module
+# neither parses nor compiles anything on the Python heap.
+#
+# Usage: mpy-tool.py -q qstrdefs.in.h file1.mpy [file2.mpy ...] > frozen_mpy.c
+
+from __future__ import print_function
+import argparse
+import os
+import sys
+
+sys.path.append(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'py'))
+import makeqstrdata as qstrutil
+
+MPY_VERSION = 2
+
+# Must match the configuration of python/port/mpconfigport.h
+MPY_FEATURE_FLAGS = 0
+
+MP_OPCODE_BYTE = 0
+MP_OPCODE_QSTR = 1
+MP_OPCODE_VAR_UINT = 2
+MP_OPCODE_OFFSET = 3
+
+MP_BC_RAISE_VARARGS = 0x5c
+MP_BC_MAKE_CLOSURE = 0x62
+MP_BC_MAKE_CLOSURE_DEFARGS = 0x63
+
+# Copy of opcode_format_table from py/bc.c
+def OC4(a, b, c, d):
+    return a | (b << 2) | (c << 4) | (d << 6)
+U = 0
+B = MP_OPCODE_BYTE
+Q = MP_OPCODE_QSTR
+V = MP_OPCODE_VAR_UINT
+O = MP_OPCODE_OFFSET
+opcode_format_table = [
+    OC4(U, U, U, U), # 0x00-0x03
+    OC4(U, U, U, U), # 0x04-0x07
+    OC4(U, U, U, U), # 0x08-0x0b
+    OC4(U, U, U, U), # 0x0c-0x0f
+    OC4(B, B, B, U), # 0x10-0x13
+    OC4(V, U, Q, V), # 0x14-0x17
+    OC4(B, V, V, Q), # 0x18-0x1b
+    OC4(Q, Q, Q, Q), # 0x1c-0x1f
+    OC4(B, B, V, V), # 0x20-0x23
+    OC4(Q, Q, Q, B), # 0x24-0x27
+    OC4(V, V, Q, Q), # 0x28-0x2b
+    OC4(U, U, U, U), # 0x2c-0x2f
+    OC4(B, B, B, B), # 0x30-0x33
+    OC4(B, O, O, O), # 0x34-0x37
+    OC4(O, O, U, U), # 0x38-0x3b
+    OC4(U, O, B, O), # 0x3c-0x3f
+    OC4(O, B, B, O), # 0x40-0x43
+    OC4(B, B, O, U), # 0x44-0x47
+    OC4(U, U, U, U), # 0x48-0x4b
+    OC4(U, U, U, U), # 0x4c-0x4f
+    OC4(V, V, U, V), # 0x50-0x53
+    OC4(B, U, V, V), # 0x54-0x57
+    OC4(V, V, V, B), # 0x58-0x5b
+    OC4(B, B, B, U), # 0x5c-0x5f
+    OC4(V, V, V, V), # 0x60-0x63
+    OC4(V, V, V, V), # 0x64-0x67
+    OC4(Q, Q, B, U), # 0x68-0x6b
+    OC4(U, U, U, U), # 0x6c-0x6f
+] + [OC4(B, B, B, B)] * 34 + [
+    OC4(B, B, B, U), # 0xf8-0xfb
+    OC4(U, U, U, U), # 0xfc-0xff
+]
+
+def mp_opcode_format(bytecode, ip):
+    opcode = bytecode[ip]
+    f = (opcode_format_table[opcode >> 2] >> (2 * (opcode & 3))) & 3
+    if f == MP_OPCODE_QSTR:
+        return f, 3
+    ip_start = ip
+    extra_byte = opcode in (MP_BC_RAISE_VARARGS, MP_BC_MAKE_CLOSURE, MP_BC_MAKE_CLOSURE_DEFARGS)
+    ip += 1
+    if f == MP_OPCODE_VAR_UINT:
+        while bytecode[ip] & 0x80:
+            ip += 1
+        ip += 1
+    elif f == MP_OPCODE_OFFSET:
+        ip += 2
+    ip += extra_byte
+    return f, ip - ip_start
+
+def decode_uint(bytecode, ip):
+    unum = 0
+    while True:
+        val = bytecode[ip]
+        ip += 1
+        unum = (unum << 7) | (val & 0x7f)
+        if not (val & 0x80):
+            break
+    return ip, unum
+
+def extract_prelude(bytecode):
+    ip = 0
+    ip, n_state = decode_uint(bytecode, ip)
+    ip, n_exc_stack = decode_uint(bytecode, ip)
+    scope_flags = bytecode[ip]; ip += 1
+    n_pos_args = bytecode[ip]; ip += 1
+    n_kwonly_args = bytecode[ip]; ip += 1
+    n_def_pos_args = bytecode[ip]; ip += 1
+    ip2, code_info_size = decode_uint(bytecode, ip)
+    ip += code_info_size
+    while bytecode[ip] != 0xff:
+        ip += 1
+    ip += 1
+    # ip now points to first opcode
+    # ip2 points to simple_name qstr
+    return ip, ip2, (n_state, n_exc_stack, scope_flags, n_pos_args, n_kwonly_args, n_def_pos_args, code_info_size)
+
+class QStrPool:
+    def __init__(self, qstrdefs_file):
+        qcfgs, qstrs = qstrutil.parse_input_headers([qstrdefs_file])
+        self.bytes_in_len = int(qcfgs['BYTES_IN_LEN'])
+        self.bytes_in_hash = int(qcfgs['BYTES_IN_HASH'])
+        # Index 0 is MP_QSTR_NULL, static qstrs follow in file order
+        self.static = {}
+        for order, ident, qstr in qstrs.values():
+            self.static[qstr] = (order + 1, 'MP_QSTR_' + ident)
+        self.frozen = []
+        self.frozen_idents = {}
+
+    def add(self, qstr):
+        if qstr in self.static:
+            return self.static[qstr][1]
+        if qstr not in self.frozen_idents:
+            self.frozen_idents[qstr] = 'MP_QSTR_' + qstrutil.qstr_escape(qstr)
+            self.frozen.append(qstr)
+        return self.frozen_idents[qstr]
+
+class RawCode:
+    # a set of all escaped names, to make sure they are unique
+    escaped_names = set()
+
+    def __init__(self, bytecode, qstrs, objs, raw_codes):
+        # set core variables
+        self.bytecode = bytecode
+        self.qstrs = qstrs
+        self.objs = objs
+        self.raw_codes = raw_codes
+
+        # extract prelude
+        self.ip, self.ip2, self.prelude = extract_prelude(bytecode)
+        self.simple_name = self.qstrs[0]
+        self.source_file = self.qstrs[1]
+
+    def freeze(self, parent_name, pool):
+        self.escaped_name = parent_name + qstrutil.qstr_escape(self.simple_name)
+
+        # make sure the escaped name is unique
+        i = 2
+        while self.escaped_name in RawCode.escaped_names:
+            self.escaped_name = parent_name + qstrutil.qstr_escape(self.simple_name) + str(i)
+            i += 1
+        RawCode.escaped_names.add(self.escaped_name)
+
+        # emit children first
+        for rc in self.raw_codes:
+            rc.freeze(self.escaped_name + '_', pool)
+
+        # generate bytecode data
+        print()
+        print('// frozen bytecode for file %s, scope %s%s' % (self.source_file, parent_name, self.simple_name))
+        print('STATIC const byte bytecode_data_%s[%u] = {' % (self.escaped_name, len(self.bytecode)))
+        print('   ', end='')
+        for i in range(self.ip2):
+            print(' 0x%02x,' % self.bytecode[i], end='')
+        print()
+        print('   ', self.qstr_bytes(pool.add(self.simple_name)), end='')
+        print('', self.qstr_bytes(pool.add(self.source_file)))
+        print('   ', end='')
+        for i in range(self.ip2 + 4, self.ip):
+            print(' 0x%02x,' % self.bytecode[i], end='')
+        print()
+        ip = self.ip
+        qstr_index = 2
+        while ip < len(self.bytecode):
+            f, sz = mp_opcode_format(self.bytecode, ip)
+            if f == MP_OPCODE_QSTR:
+                print('    0x%02x, %s' % (self.bytecode[ip], self.qstr_bytes(pool.add(self.qstrs[qstr_index]))))
+                qstr_index += 1
+            else:
+                print('   ' + ''.join(' 0x%02x,' % b for b in self.bytecode[ip:ip + sz]))
+            ip += sz
+        print('};')
+
+        # generate constant objects
+        for i, obj in enumerate(self.objs):
+            obj_name = 'const_obj_%s_%u' % (self.escaped_name, i)
+            if obj is Ellipsis:
+                continue
+            elif isinstance(obj, (str, bytes)):
+                if isinstance(obj, str):
+                    obj = obj.encode('utf8')
+                    obj_type = 'mp_type_str'
+                else:
+                    obj_type = 'mp_type_bytes'
+                print('STATIC const mp_obj_str_t %s = {{&%s}, %u, %u, (const byte*)"%s"};'
+                    % (obj_name, obj_type, qstrutil.compute_hash(obj, pool.bytes_in_hash),
+                        len(obj), ''.join(('\\x%02x' % b) for b in obj)))
+            elif isinstance(obj, float):
+                print('STATIC const mp_obj_float_t %s = {{&mp_type_float}, %.16g};' % (obj_name, obj))
+            else:
+                # integers which don't fit in a small int would need a long
+                # int implementation, which this port doesn't have
+                raise FreezeError(self, 'freezing of object %r is not implemented' % (obj,))
+
+        # generate constant table, if it has any entries
+        const_table_len = len(self.qstrs) - 2 - len(self.qstrs_in_bytecode()) + len(self.objs) + len(self.raw_codes)
+        if const_table_len:
+            print('STATIC const mp_rom_obj_t const_table_data_%s[%u] = {'
+                % (self.escaped_name, const_table_len))
+            for qst in self.qstrs[2 + len(self.qstrs_in_bytecode()):]:
+                print('    MP_ROM_QSTR(%s),' % pool.add(qst))
+            for i, obj in enumerate(self.objs):
+                if obj is Ellipsis:
+                    print('    MP_ROM_PTR(&mp_const_ellipsis_obj),')
+                else:
+                    print('    MP_ROM_PTR(&const_obj_%s_%u),' % (self.escaped_name, i))
+            for rc in self.raw_codes:
+                print('    MP_ROM_PTR(&raw_code_%s),' % rc.escaped_name)
+            print('};')
+
+        # generate raw code descriptor
+        print()
+        print('const mp_raw_code_t raw_code_%s = {' % self.escaped_name)
+        print('    .kind = MP_CODE_BYTECODE,')
+        print('    .scope_flags = 0x%02x,' % self.prelude[2])
+        print('    .n_pos_args = %u,' % self.prelude[3])
+        print('    .data.u_byte = {')
+        print('        .bytecode = bytecode_data_%s,' % self.escaped_name)
+        if const_table_len:
+            print('        .const_table = (mp_uint_t*)(void*)const_table_data_%s,' % self.escaped_name)
+        else:
+            print('        .const_table = NULL,')
+        print('        #if MICROPY_PERSISTENT_CODE_SAVE')
+        print('        .bc_len = %u,' % len(self.bytecode))
+        print('        .n_obj = %u,' % len(self.objs))
+        print('        .n_raw_code = %u,' % len(self.raw_codes))
+        print('        #endif')
+        print('    },')
+        print('};')
+
+    def qstrs_in_bytecode(self):
+        n = 0
+        ip = self.ip
+        while ip < len(self.bytecode):
+            f, sz = mp_opcode_format(self.bytecode, ip)
+            if f == MP_OPCODE_QSTR:
+                n += 1
+            ip += sz
+        return range(n)
+
+    @staticmethod
+    def qstr_bytes(ident):
+        return '(byte)(%s & 0xff), (byte)(%s >> 8),' % (ident, ident)
+
+class FreezeError(Exception):
+    def __init__(self, rawcode, msg):
+        self.rawcode = rawcode
+        self.msg = msg
+
+    def __str__(self):
+        return 'error while freezing %s: %s' % (self.rawcode.source_file, self.msg)
+
+class MPYReader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+
+    def read_byte(self):
+        b = self.data[self.pos]
+        self.pos += 1
+        return b
+
+    def read_bytes(self, n):
+        b = self.data[self.pos:self.pos + n]
+        self.pos += n
+        return b
+
+    def read_uint(self):
+        i = 0
+        while True:
+            b = self.read_byte()
+            i = (i << 7) | (b & 0x7f)
+            if b & 0x80 == 0:
+                break
+        return i
+
+    def read_qstr(self):
+        ln = self.read_uint()
+        return self.read_bytes(ln).decode('utf8')
+
+    def read_obj(self):
+        obj_type = chr(self.read_byte())
+        if obj_type == 'e':
+            return Ellipsis
+        buf = self.read_bytes(self.read_uint())
+        if obj_type == 's':
+            return buf.decode('utf8')
+        elif obj_type == 'b':
+            return bytes(buf)
+        elif obj_type == 'i':
+            return int(buf.decode('utf8'), 10)
+        elif obj_type == 'f':
+            return float(buf.decode('utf8'))
+        elif obj_type == 'c':
+            return complex(buf.decode('utf8'))
+        else:
+            assert 0
+
+    def read_raw_code(self):
+        bc_len = self.read_uint()
+        bytecode = bytearray(self.read_bytes(bc_len))
+        ip, ip2, prelude = extract_prelude(bytecode)
+        qstrs = [self.read_qstr(), self.read_qstr()] # simple_name, source_file
+        pos = ip
+        while pos < len(bytecode):
+            f, sz = mp_opcode_format(bytecode, pos)
+            if f == MP_OPCODE_QSTR:
+                qstrs.append(self.read_qstr())
+            pos += sz
+        n_obj = self.read_uint()
+        n_raw_code = self.read_uint()
+        qstrs += [self.read_qstr() for _ in range(prelude[3] + prelude[4])]
+        objs = [self.read_obj() for _ in range(n_obj)]
+        raw_codes = [self.read_raw_code() for _ in range(n_raw_code)]
+        return RawCode(bytecode, qstrs, objs, raw_codes)
+
+def read_mpy(filename, small_int_bits):
+    with open(filename, 'rb') as f:
+        reader = MPYReader(bytearray(f.read()))
+    header = reader.read_bytes(4)
+    if header[0] != ord('M'):
+        raise Exception('not a valid .mpy file')
+    if header[1] != MPY_VERSION:
+        raise Exception('incompatible .mpy version')
+    if header[2] != MPY_FEATURE_FLAGS:
+        raise Exception('.mpy feature flags do not match the port configuration')
+    if header[3] > small_int_bits:
+        raise Exception('.mpy was compiled for a larger small int than the target')
+    return reader.read_raw_code()
+
+def freeze_mpy(pool, raw_codes):
+    print('#include "py/mpconfig.h"')
+    print('#include "py/objint.h"')
+    print('#include "py/objstr.h"')
+    print('#include "py/emitglue.h"')
+    print()
+    print('#if MICROPY_LONGINT_IMPL != MICROPY_LONGINT_IMPL_NONE')
+    print('#error "incompatible MICROPY_LONGINT_IMPL"')
+    print('#endif')
+    print()
+    print('#if MICROPY_FLOAT_IMPL == MICROPY_FLOAT_IMPL_FLOAT')
+    print('typedef struct _mp_obj_float_t {')
+    print('    mp_obj_base_t base;')
+    print('    mp_float_t value;')
+    print('} mp_obj_float_t;')
+    print('#endif')
+
+    # The frozen bytecode is emitted in a first pass so that all the qstrs it
+    # needs are known before the qstr enum and pool are printed.
+    import io
+    stdout = sys.stdout
+    sys.stdout = body = io.StringIO()
+    for rc in raw_codes:
+        rc.freeze(rc.source_file.replace('/', '_')[:-3] + '_', pool)
+    # Interning module names saves a heap qstr on each import
+    for rc in raw_codes:
+        pool.add(os.path.basename(rc.source_file)[:-3])
+    sys.stdout = stdout
+
+    print()
+    print('enum {')
+    for i, qstr in enumerate(pool.frozen):
+        if i == 0:
+            print('    %s = MP_QSTRnumber_of,' % pool.frozen_idents[qstr])
+        else:
+            print('    %s,' % pool.frozen_idents[qstr])
+    print('};')
+
+    # As in qstr.c, alloc must be <= len so that the runtime never adds
+    # dynamic qstrs to this const pool
+    assert len(pool.frozen) > 0
+    print()
+    print('extern const qstr_pool_t mp_qstr_const_pool;')
+    print('const qstr_pool_t mp_qstr_frozen_const_pool = {')
+    print('    (qstr_pool_t*)&mp_qstr_const_pool, // previous pool')
+    print('    MP_QSTRnumber_of, // previous pool size')
+    print('    %u, // allocated entries' % min(len(pool.frozen), 10))
+    print('    %u, // used entries' % len(pool.frozen))
+    print('    {')
+    for qstr in pool.frozen:
+        print('        %s,' % qstrutil.make_bytes(pool.bytes_in_len, pool.bytes_in_hash, qstr))
+    print('    },')
+    print('};')
+
+    sys.stdout.write(body.getvalue())
+
+    print()
+    print('const char mp_frozen_mpy_names[] = {')
+    for rc in raw_codes:
+        print('"%s\\0"' % rc.source_file)
+    print('"\\0"};')
+    print()
+    print('const mp_raw_code_t *const mp_frozen_mpy_content[] = {')
+    for rc in raw_codes:
+        print('    &raw_code_%s,' % rc.escaped_name)
+    print('};')
+
+def main():
+    parser = argparse.ArgumentParser(description='Freeze .mpy files into a C source file')
+    parser.add_argument('-q', '--qstr-header', required=True, help='qstrdefs.in.h of the port')
+    parser.add_argument('-msmall-int-bits', type=int, default=31)
+    parser.add_argument('files', nargs='+', help='input .mpy files')
+    args = parser.parse_args()
+
+    pool = QStrPool(args.qstr_header)
+    try:
+        raw_codes = [read_mpy(f, args.msmall_int_bits) for f in args.files]
+        freeze_mpy(pool, raw_codes)
+    except Exception as er:
+        sys.stderr.write('%s\n' % er)
+        sys.exit(1)
+
+if __name__ == '__main__':
+    main()
@@ -9,12 +9,22 @@
 #define QUIZ_CASE(name) void quiz_case_##name()
 #endif
 
+/* A benchmark is a test case whose body is timed over many iterations. The
+ * body is run once in a normal test run, and timed with QUIZ_RUN_BENCHMARKS=1.
+ * It must be repeatable, and store its results somewhere volatile so that the
+ * compiler keeps the work. */
+#define QUIZ_BENCH(name) \
+  static void quiz_bench_##name(); \
+  QUIZ_CASE(name) { quiz_bench(#name, quiz_bench_##name); } \
+  static void quiz_bench_##name()
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
 void quiz_assert_true(bool condition);
 void quiz_print(const char * message);
+void quiz_bench(const char * name, void (*body)(void));
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,96 @@
+#include "quiz.h"
+#include <ion.h>
+#include <stdlib.h>
+
+#if QUIZ_RUN_BENCHMARKS
+
+/* Each benchmark is run in samples of the same number of iterations, long
+ * enough for the timer resolution and the call overhead to be negligible. */
+
+constexpr static int k_numberOfSamples = 9;
+constexpr static uint32_t k_maximalNumberOfIterations = 1 << 24;
+
+static char * appendUnsigned(char * buffer, uint32_t value) {
+  char digits[10];
+  int numberOfDigits = 0;
+  do {
+    digits[numberOfDigits++] = '0' + value % 10;
+    value /= 10;
+  } while (value > 0);
+  while (numberOfDigits > 0) {
+    *buffer++ = digits[--numberOfDigits];
+  }
+  return buffer;
+}
+
+static char * appendNanoseconds(char * buffer, float nanoseconds) {
+  // Tenths of nanoseconds, as long as they fit
+  if (nanoseconds >= 1E8f) {
+    return appendUnsigned(buffer, nanoseconds + 0.5f);
+  }
+  uint32_t tenths = nanoseconds * 10.0f + 0.5f;
+  buffer = appendUnsigned(buffer, tenths / 10);
+  *buffer++ = '.';
+  return appendUnsigned(buffer, tenths % 10);
+}
+
+static uint32_t sample(void (*body)(void), uint32_t numberOfIterations) {
+  uint32_t start = Ion::Timing::ticks();
+  for (uint32_t i = 0; i < numberOfIterations; i++) {
+    body();
+  }
+  return Ion::Timing::ticks() - start;
+}
+
+#endif
+
+void quiz_bench(const char * name, void (*body)(void)) {
+#if QUIZ_RUN_BENCHMARKS
+  /* A first run warms up the caches and builds any lazily built state, so
+   * that the allocations are counted on the second one. */
+  body();
+  size_t allocations = malloc_number_of_allocations();
+  body();
+  allocations = malloc_number_of_allocations() - allocations;
+
+  uint32_t minimalSampleDuration = Ion::Timing::ticksPerSecond() / 1000;
+  uint32_t numberOfIterations = 1;
+  while (sample(body, numberOfIterations) < minimalSampleDuration && numberOfIterations < k_maximalNumberOfIterations) {
+    numberOfIterations *= 2;
+  }
+  uint32_t durations[k_numberOfSamples];
+  for (int i = 0; i < k_numberOfSamples; i++) {
+    uint32_t duration = sample(body, numberOfIterations);
+    int j = i;
+    while (j > 0 && durations[j-1] > duration) {
+      durations[j] = durations[j-1];
+      j--;
+    }
+    durations[j] = duration;
+  }
+
+  float nanosecondsPerTick = 1E9f / Ion::Timing::ticksPerSecond();
+  float median = durations[k_numberOfSamples/2] * nanosecondsPerTick / numberOfIterations;
+  float min = durations[0] * nanosecondsPerTick / numberOfIterations;
+  float throughput = median > 0.0f ? 1E9f / median : 4E9f;
+
+  // BENCH <name> <median ns> <min ns> <iterations per second> <allocations>
+  char line[128] = "BENCH ";
+  char * c = line + 6;
+  for (const char * n = name; *n != 0 && c < line + 64; n++) {
+    *c++ = *n;
+  }
+  *c++ = ' ';
+  c = appendNanoseconds(c, median);
+  *c++ = ' ';
+  c = appendNanoseconds(c, min);
+  *c++ = ' ';
+  c = appendUnsigned(c, throughput < 4E9f ? throughput : 4E9f);
+  *c++ = ' ';
+  c = appendUnsigned(c, allocations);
+  *c = 0;
+  quiz_print(line);
+#else
+  body();
+#endif
+}
@@ -0,0 +1,39 @@
+# Compares the benchmarks of a test run with a baseline, both being outputs of
+# test runs built with QUIZ_RUN_BENCHMARKS=1.
+# Usage: awk -f quiz/src/bench_compare.awk [-v threshold=5] baseline.txt run.txt
+# Exits with 1 if a median time grew by more than threshold percent.
+
+BEGIN {
+  if (threshold == "") {
+    threshold = 5
+  }
+  printf "%-48s %12s %12s %8s %13s\n", "BENCHMARK", "BASELINE ns", "MEDIAN ns", "CHANGE", "ALLOCATIONS"
+}
+
+$1 != "BENCH" { next }
+
+NR == FNR { baseline[$2] = $3; baselineAllocations[$2] = $6; next }
+
+{
+  if (!($2 in baseline) || baseline[$2] == 0) {
+    printf "%-48s %12s %12s %8s %13s\n", $2, "-", $3, "new", $6
+    next
+  }
+  change = 100 * ($3 - baseline[$2]) / baseline[$2]
+  flag = ""
+  if (change > threshold) {
+    flag = " REGRESSION"
+    regressions++
+  }
+  allocations = $6
+  if (baselineAllocations[$2] != "" && baselineAllocations[$2] != $6) {
+    allocations = baselineAllocations[$2] " -> " $6
+  }
+  printf "%-48s %12s %12s %+7.1f%% %13s%s\n", $2, baseline[$2], $3, change, allocations, flag
+}
+
+END {
+  if (regressions > 0) {
+    exit 1
+  }
+}
@@ -7,6 +7,7 @@ BEGIN {
 #FIXME: Is there a way to capture subexpression in awk? The following gsub is
 #       kind of ugly
 /QUIZ_CASE\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_CASE\()|(\))/, "", $1); tests = tests "quiz_case_" $1 "," }
+/QUIZ_BENCH\(([a-z0-9_]+)\)/ { gsub(/(QUIZ_BENCH\()|(\))/, "", $1); tests = tests "quiz_case_" $1 "," }
 
 END {
   declarations = tests;
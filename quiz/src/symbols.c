@@ -0,0 +1,257 @@
+#include <string.h>
+#include "symbols.h"
+
+void quiz_case_liba_vmath_float();
+void quiz_case_liba_vmath_double();
+void quiz_case_liba_vmath_special_values();
+void quiz_case_ion_crc32();
+void quiz_case_ion_crc32_bench();
+void quiz_case_ion_events_from_keyboard();
+void quiz_case_ion_keyboard();
+void quiz_case_ion_timing();
+void quiz_case_kandinsky_color_rgb();
+void quiz_case_kandinsky_color_blend();
+void quiz_case_kandinsky_rect_intersect();
+void quiz_case_kandinsky_rect_union();
+void quiz_case_kandinsky_rect_empty_union();
+void quiz_case_poincare_addition_evaluate();
+void quiz_case_poincare_benchmark_corpus();
+void quiz_case_poincare_integer_add_bench();
+void quiz_case_poincare_integer_multiply_bench();
+void quiz_case_poincare_integer_divide_bench();
+void quiz_case_poincare_compiled_expression_arithmetic();
+void quiz_case_poincare_compiled_expression_functions();
+void quiz_case_poincare_compiled_expression_interpreted_nodes();
+void quiz_case_poincare_compiled_expression_benchmark();
+void quiz_case_poincare_complex_to_text();
+void quiz_case_poincare_complex_cartesian_to_text();
+void quiz_case_poincare_complex_evaluate();
+void quiz_case_poincare_complex_constructor();
+void quiz_case_poincare_fraction_evaluate();
+void quiz_case_poincare_parse_function();
+void quiz_case_poincare_function_evaluate();
+void quiz_case_poincare_identity_simple_term();
+void quiz_case_poincare_identity_commutativity();
+void quiz_case_poincare_integer();
+void quiz_case_poincare_integer_compare();
+void quiz_case_poincare_integer_add();
+void quiz_case_poincare_integer_subtract();
+void quiz_case_poincare_integer_multiply();
+void quiz_case_poincare_integer_divide();
+void quiz_case_poincare_integer_evaluate();
+void quiz_case_poincare_matrix_evaluate();
+void quiz_case_poincare_parser();
+void quiz_case_poincare_product_evaluate();
+void quiz_case_poincare_power_evaluate();
+void quiz_case_poincare_simplifier_bottom_up();
+void quiz_case_poincare_simplifier_repeated_subtrees();
+void quiz_case_poincare_simplifier_fixed_point();
+void quiz_case_poincare_simplifier_canonical_order();
+void quiz_case_poincare_substraction_evaluate();
+void quiz_case_poincare_parse_symbol();
+void quiz_case_poincare_symbol_approximate();
+void quiz_case_poincare_parse_trigo();
+void quiz_case_poincare_trigo_evaluate();
+void quiz_case_escher_run_loop_runs_task_after_each_step();
+void quiz_case_calculation_store();
+void quiz_case_calculation_store_full();
+void quiz_case_shared_lazy_snapshot_constructs_on_first_use();
+void quiz_case_shared_lazy_snapshot_compacts_inactive_snapshots();
+void quiz_case_shared_record_store_compacts();
+void quiz_case_shared_record_store_full();
+void quiz_case_shared_text_record();
+void quiz_case_shared_text_record_full_store();
+void quiz_case_code_array_storage();
+void quiz_case_code_memoryview_shares_buffer();
+void quiz_case_code_bench_math();
+void quiz_case_code_bench_native();
+void quiz_case_code_bench_gc();
+void quiz_case_code_bench_poincare();
+void quiz_case_code_bench_profiler();
+void quiz_case_code_console_store_lines();
+void quiz_case_code_console_store_wraps_long_lines();
+void quiz_case_code_console_store_drops_oldest_lines();
+void quiz_case_code_frozen_module();
+void quiz_case_code_heap_size();
+void quiz_case_code_gc_module();
+void quiz_case_code_gc_collects_before_heap_is_full();
+void quiz_case_code_kandinsky_batch_drawing();
+void quiz_case_code_math_module();
+void quiz_case_code_cmath_module();
+void quiz_case_code_native_emitter();
+void quiz_case_code_native_code_memory_is_recycled();
+void quiz_case_code_poincare_evaluate();
+void quiz_case_code_profiler_lines();
+void quiz_case_code_profiler_records_nothing_once_stopped();
+
+QuizCase quiz_cases[] = {
+  quiz_case_liba_vmath_float,
+  quiz_case_liba_vmath_double,
+  quiz_case_liba_vmath_special_values,
+  quiz_case_ion_crc32,
+  quiz_case_ion_crc32_bench,
+  quiz_case_ion_events_from_keyboard,
+  quiz_case_ion_keyboard,
+  quiz_case_ion_timing,
+  quiz_case_kandinsky_color_rgb,
+  quiz_case_kandinsky_color_blend,
+  quiz_case_kandinsky_rect_intersect,
+  quiz_case_kandinsky_rect_union,
+  quiz_case_kandinsky_rect_empty_union,
+  quiz_case_poincare_addition_evaluate,
+  quiz_case_poincare_benchmark_corpus,
+  quiz_case_poincare_integer_add_bench,
+  quiz_case_poincare_integer_multiply_bench,
+  quiz_case_poincare_integer_divide_bench,
+  quiz_case_poincare_compiled_expression_arithmetic,
+  quiz_case_poincare_compiled_expression_functions,
+  quiz_case_poincare_compiled_expression_interpreted_nodes,
+  quiz_case_poincare_compiled_expression_benchmark,
+  quiz_case_poincare_complex_to_text,
+  quiz_case_poincare_complex_cartesian_to_text,
+  quiz_case_poincare_complex_evaluate,
+  quiz_case_poincare_complex_constructor,
+  quiz_case_poincare_fraction_evaluate,
+  quiz_case_poincare_parse_function,
+  quiz_case_poincare_function_evaluate,
+  quiz_case_poincare_identity_simple_term,
+  quiz_case_poincare_identity_commutativity,
+  quiz_case_poincare_integer,
+  quiz_case_poincare_integer_compare,
+  quiz_case_poincare_integer_add,
+  quiz_case_poincare_integer_subtract,
+  quiz_case_poincare_integer_multiply,
+  quiz_case_poincare_integer_divide,
+  quiz_case_poincare_integer_evaluate,
+  quiz_case_poincare_matrix_evaluate,
+  quiz_case_poincare_parser,
+  quiz_case_poincare_product_evaluate,
+  quiz_case_poincare_power_evaluate,
+  quiz_case_poincare_simplifier_bottom_up,
+  quiz_case_poincare_simplifier_repeated_subtrees,
+  quiz_case_poincare_simplifier_fixed_point,
+  quiz_case_poincare_simplifier_canonical_order,
+  quiz_case_poincare_substraction_evaluate,
+  quiz_case_poincare_parse_symbol,
+  quiz_case_poincare_symbol_approximate,
+  quiz_case_poincare_parse_trigo,
+  quiz_case_poincare_trigo_evaluate,
+  quiz_case_escher_run_loop_runs_task_after_each_step,
+  quiz_case_calculation_store,
+  quiz_case_calculation_store_full,
+  quiz_case_shared_lazy_snapshot_constructs_on_first_use,
+  quiz_case_shared_lazy_snapshot_compacts_inactive_snapshots,
+  quiz_case_shared_record_store_compacts,
+  quiz_case_shared_record_store_full,
+  quiz_case_shared_text_record,
+  quiz_case_shared_text_record_full_store,
+  quiz_case_code_array_storage,
+  quiz_case_code_memoryview_shares_buffer,
+  quiz_case_code_bench_math,
+  quiz_case_code_bench_native,
+  quiz_case_code_bench_gc,
+  quiz_case_code_bench_poincare,
+  quiz_case_code_bench_profiler,
+  quiz_case_code_console_store_lines,
+  quiz_case_code_console_store_wraps_long_lines,
+  quiz_case_code_console_store_drops_oldest_lines,
+  quiz_case_code_frozen_module,
+  quiz_case_code_heap_size,
+  quiz_case_code_gc_module,
+  quiz_case_code_gc_collects_before_heap_is_full,
+  quiz_case_code_kandinsky_batch_drawing,
+  quiz_case_code_math_module,
+  quiz_case_code_cmath_module,
+  quiz_case_code_native_emitter,
+  quiz_case_code_native_code_memory_is_recycled,
+  quiz_case_code_poincare_evaluate,
+  quiz_case_code_profiler_lines,
+  quiz_case_code_profiler_records_nothing_once_stopped,
+  NULL
+};
+
+char * quiz_case_names[] = {
+  "liba_vmath_float",
+  "liba_vmath_double",
+  "liba_vmath_special_values",
+  "ion_crc32",
+  "ion_crc32_bench",
+  "ion_events_from_keyboard",
+  "ion_keyboard",
+  "ion_timing",
+  "kandinsky_color_rgb",
+  "kandinsky_color_blend",
+  "kandinsky_rect_intersect",
+  "kandinsky_rect_union",
+  "kandinsky_rect_empty_union",
+  "poincare_addition_evaluate",
+  "poincare_benchmark_corpus",
+  "poincare_integer_add_bench",
+  "poincare_integer_multiply_bench",
+  "poincare_integer_divide_bench",
+  "poincare_compiled_expression_arithmetic",
+  "poincare_compiled_expression_functions",
+  "poincare_compiled_expression_interpreted_nodes",
+  "poincare_compiled_expression_benchmark",
+  "poincare_complex_to_text",
+  "poincare_complex_cartesian_to_text",
+  "poincare_complex_evaluate",
+  "poincare_complex_constructor",
+  "poincare_fraction_evaluate",
+  "poincare_parse_function",
+  "poincare_function_evaluate",
+  "poincare_identity_simple_term",
+  "poincare_identity_commutativity",
+  "poincare_integer",
+  "poincare_integer_compare",
+  "poincare_integer_add",
+  "poincare_integer_subtract",
+  "poincare_integer_multiply",
+  "poincare_integer_divide",
+  "poincare_integer_evaluate",
+  "poincare_matrix_evaluate",
+  "poincare_parser",
+  "poincare_product_evaluate",
+  "poincare_power_evaluate",
+  "poincare_simplifier_bottom_up",
+  "poincare_simplifier_repeated_subtrees",
+  "poincare_simplifier_fixed_point",
+  "poincare_simplifier_canonical_order",
+  "poincare_substraction_evaluate",
+  "poincare_parse_symbol",
+  "poincare_symbol_approximate",
+  "poincare_parse_trigo",
+  "poincare_trigo_evaluate",
+  "escher_run_loop_runs_task_after_each_step",
+  "calculation_store",
+  "calculation_store_full",
+  "shared_lazy_snapshot_constructs_on_first_use",
+  "shared_lazy_snapshot_compacts_inactive_snapshots",
+  "shared_record_store_compacts",
+  "shared_record_store_full",
+  "shared_text_record",
+  "shared_text_record_full_store",
+  "code_array_storage",
+  "code_memoryview_shares_buffer",
+  "code_bench_math",
+  "code_bench_native",
+  "code_bench_gc",
+  "code_bench_poincare",
+  "code_bench_profiler",
+  "code_console_store_lines",
+  "code_console_store_wraps_long_lines",
+  "code_console_store_drops_oldest_lines",
+  "code_frozen_module",
+  "code_heap_size",
+  "code_gc_module",
+  "code_gc_collects_before_heap_is_full",
+  "code_kandinsky_batch_drawing",
+  "code_math_module",
+  "code_cmath_module",
+  "code_native_emitter",
+  "code_native_code_memory_is_recycled",
+  "code_poincare_evaluate",
+  "code_profiler_lines",
+  "code_profiler_records_nothing_once_stopped",
+  NULL
+};